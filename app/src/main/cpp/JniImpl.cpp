@@ -2,6 +2,8 @@
 // Created by ByteFlow on 2019/7/9.
 //
 #include "util/LogUtil.h"
+#include "util/TraceRecorder.h"
+#include "util/ProgramBinaryCache.h"
 #include <MyGLRenderContext.h>
 #include <EGLRender.h>
 #include "jni.h"
@@ -33,6 +35,53 @@ JNIEXPORT void JNICALL native_UnInit(JNIEnv *env, jobject instance)
 	MyGLRenderContext::DestroyInstance();
 }
 
+/*
+ * Class:     com_byteflow_app_MyNativeRender
+ * Method:    native_SetCacheDir
+ * Signature: (Ljava/lang/String;)V
+ * 传入 Context.getCacheDir()，program binary 缓存写在其下的 program_cache 目录
+ */
+JNIEXPORT void JNICALL native_SetCacheDir(JNIEnv *env, jobject instance, jstring cacheDir)
+{
+	if (cacheDir == nullptr) return;
+	const char *pDir = env->GetStringUTFChars(cacheDir, nullptr);
+	if (pDir == nullptr) return;
+	std::string dir = std::string(pDir) + "/" + PROGRAM_CACHE_DIR_NAME;
+	env->ReleaseStringUTFChars(cacheDir, pDir);
+	ProgramBinaryCache::SetCacheDir(dir.c_str());
+}
+
+/*
+ * 为 true 时 byte[] 通过 GetPrimitiveArrayCritical 直接访问。临界区覆盖整个 LoadImage，
+ * 其中会等待 GL 线程持有的样例锁、从内存池分配并打日志，JNI 不允许在临界区内阻塞，
+ * 可能与 GC 死锁或让 GC 停顿一帧，因此默认关闭，只用于测量；零拷贝请使用 native_SetDirectImageData。
+ */
+static bool g_UseCriticalArray = false;
+
+static void SetImageDataFromArray(JNIEnv *env, jint index, jint format, jint width, jint height, jbyteArray imageData)
+{
+	TRACE_SCOPE("JNI::SetImageData");
+	if (g_UseCriticalArray)
+	{
+		uint8_t* buf = static_cast<uint8_t *>(env->GetPrimitiveArrayCritical(imageData, nullptr));
+		if (buf == nullptr) return;
+		if (index < 0) MyGLRenderContext::GetInstance()->SetImageData(format, width, height, buf);
+		else MyGLRenderContext::GetInstance()->SetImageDataWithIndex(index, format, width, height, buf);
+		env->ReleasePrimitiveArrayCritical(imageData, buf, JNI_ABORT);
+	}
+	else
+	{
+		// 不进入临界区，虚拟机可能固定数组也可能返回一份拷贝，只读访问用 JNI_ABORT 释放
+		jbyte *pElements = env->GetByteArrayElements(imageData, nullptr);
+		if (pElements == nullptr) return;
+		uint8_t *buf = reinterpret_cast<uint8_t *>(pElements);
+		if (index < 0) MyGLRenderContext::GetInstance()->SetImageData(format, width, height, buf);
+		else MyGLRenderContext::GetInstance()->SetImageDataWithIndex(index, format, width, height, buf);
+		env->ReleaseByteArrayElements(imageData, pElements, JNI_ABORT);
+	}
+	env->DeleteLocalRef(imageData);
+}
+
 /*
  * Class:     com_byteflow_app_MyNativeRender
  * Method:    native_SetImageData
@@ -41,12 +90,7 @@ JNIEXPORT void JNICALL native_UnInit(JNIEnv *env, jobject instance)
 JNIEXPORT void JNICALL native_SetImageData
 (JNIEnv *env, jobject instance, jint format, jint width, jint height, jbyteArray imageData)
 {
-	int len = env->GetArrayLength (imageData);
-	uint8_t* buf = new uint8_t[len];
-	env->GetByteArrayRegion(imageData, 0, len, reinterpret_cast<jbyte*>(buf));
-	MyGLRenderContext::GetInstance()->SetImageData(format, width, height, buf);
-	delete[] buf;
-	env->DeleteLocalRef(imageData);
+	SetImageDataFromArray(env, -1, format, width, height, imageData);
 }
 
 /*
@@ -57,12 +101,64 @@ JNIEXPORT void JNICALL native_SetImageData
 JNIEXPORT void JNICALL native_SetImageDataWithIndex
 		(JNIEnv *env, jobject instance, jint index, jint format, jint width, jint height, jbyteArray imageData)
 {
-	int len = env->GetArrayLength (imageData);
-	uint8_t* buf = new uint8_t[len];
-	env->GetByteArrayRegion(imageData, 0, len, reinterpret_cast<jbyte*>(buf));
-	MyGLRenderContext::GetInstance()->SetImageDataWithIndex(index, format, width, height, buf);
-	delete[] buf;
-	env->DeleteLocalRef(imageData);
+	SetImageDataFromArray(env, index, format, width, height, imageData);
+}
+
+/*
+ * Class:     com_byteflow_app_MyNativeRender
+ * Method:    native_SetDirectImageData
+ * Signature: (IIIILjava/nio/ByteBuffer;[I)V
+ *
+ * index < 0 时等同于 native_SetImageData。buffer 必须是 direct ByteBuffer，
+ * lineSizes 可为 null（紧凑排列），否则依次为每个平面的行跨度，平面首尾相连。
+ * 图像以借用方式传给 sample，数据只在 sample 需要保留时拷贝一次。
+ */
+JNIEXPORT void JNICALL native_SetDirectImageData
+		(JNIEnv *env, jobject instance, jint index, jint format, jint width, jint height, jobject buffer, jintArray lineSizes)
+{
+	TRACE_SCOPE("JNI::SetDirectImageData");
+	uint8_t *pData = static_cast<uint8_t *>(env->GetDirectBufferAddress(buffer));
+	if (pData == nullptr)
+	{
+		LOGCATE("native_SetDirectImageData buffer is not a direct ByteBuffer");
+		return;
+	}
+
+	NativeImage nativeImage;
+	nativeImage.format = format;
+	nativeImage.width = width;
+	nativeImage.height = height;
+
+	int lineSize[3] = {0};
+	if (lineSizes != nullptr)
+	{
+		int count = env->GetArrayLength(lineSizes);
+		env->GetIntArrayRegion(lineSizes, 0, count < 3 ? count : 3, reinterpret_cast<jint *>(lineSize));
+		env->DeleteLocalRef(lineSizes);
+	}
+	NativeImageUtil::AttachNativeImage(&nativeImage, pData, lineSize);
+
+	int planeCount = NativeImageUtil::GetPlaneCount(format);
+	jlong requiredSize = planeCount > 0 ? (nativeImage.ppPlane[planeCount - 1] - pData) + NativeImageUtil::GetPlaneSize(&nativeImage, planeCount - 1) : 0;
+	if (env->GetDirectBufferCapacity(buffer) < requiredSize)
+	{
+		LOGCATE("native_SetDirectImageData buffer too small, capacity=%lld, required=%lld",
+				(long long) env->GetDirectBufferCapacity(buffer), (long long) requiredSize);
+		return;
+	}
+
+	if (index < 0) MyGLRenderContext::GetInstance()->SetImageData(&nativeImage);
+	else MyGLRenderContext::GetInstance()->SetImageDataWithIndex(index, &nativeImage);
+}
+
+/*
+ * Class:     com_byteflow_app_MyNativeRender
+ * Method:    native_SetCriticalArrayEnabled
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL native_SetCriticalArrayEnabled(JNIEnv *env, jobject instance, jboolean enable)
+{
+	g_UseCriticalArray = enable;
 }
 
 /*
@@ -121,6 +217,7 @@ JNIEXPORT void JNICALL native_UpdateTransformMatrix(JNIEnv *env, jobject instanc
  */
 JNIEXPORT void JNICALL native_OnSurfaceCreated(JNIEnv *env, jobject instance)
 {
+	TRACE_THREAD_NAME("GLThread");
 	MyGLRenderContext::GetInstance()->OnSurfaceCreated();
 }
 
@@ -144,6 +241,8 @@ JNIEXPORT void JNICALL native_OnSurfaceChanged
 JNIEXPORT void JNICALL native_OnDrawFrame(JNIEnv *env, jobject instance)
 {
 	MyGLRenderContext::GetInstance()->OnDrawFrame();
+	// GLSurfaceView 在 Java 层返回后调用 eglSwapBuffers，用 instant 事件标记交给 swap 的时刻
+	TRACE_INSTANT("FrameSubmitted");
 
 }
 
@@ -214,8 +313,11 @@ JNIEXPORT void JNICALL natuve_BgRenderUnInit(JNIEnv *env, jobject instance)
 static JNINativeMethod g_RenderMethods[] = {
 		{"native_Init",                      "()V",       (void *)(native_Init)},
 		{"native_UnInit",                    "()V",       (void *)(native_UnInit)},
+		{"native_SetCacheDir",               "(Ljava/lang/String;)V", (void *)(native_SetCacheDir)},
 		{"native_SetImageData",              "(III[B)V",  (void *)(native_SetImageData)},
 		{"native_SetImageDataWithIndex",     "(IIII[B)V", (void *)(native_SetImageDataWithIndex)},
+		{"native_SetDirectImageData",        "(IIIILjava/nio/ByteBuffer;[I)V", (void *)(native_SetDirectImageData)},
+		{"native_SetCriticalArrayEnabled",   "(Z)V",      (void *)(native_SetCriticalArrayEnabled)},
 		{"native_SetParamsInt",              "(III)V",    (void *)(native_SetParamsInt)},
 		{"native_SetParamsFloat",            "(IFF)V",    (void *)(native_SetParamsFloat)},
 		{"native_SetAudioData",              "([S)V",     (void *)(native_SetAudioData)},
@@ -3,6 +3,7 @@
 //
 
 #include "LogUtil.h"
+#include "TraceRecorder.h"
 #include "EglCore.h"
 #include <assert.h>
 
@@ -40,7 +41,15 @@ bool EglCore::init(EGLContext sharedContext, int flags) {
         sharedContext = EGL_NO_CONTEXT;
     }
 
+#ifdef NATIVE_RENDER_HOST
+    // 主机构建没有窗口系统，使用 Mesa surfaceless 平台（llvmpipe 软件渲染）
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+            (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress("eglGetPlatformDisplayEXT");
+    mEGLDisplay = getPlatformDisplay ? getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL)
+                                     : eglGetDisplay(EGL_DEFAULT_DISPLAY);
+#else
     mEGLDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+#endif
     assert(mEGLDisplay != EGL_NO_DISPLAY);
     if (mEGLDisplay == EGL_NO_DISPLAY) {
         LOGCATE("unable to get EGL14 display.\n");
@@ -127,13 +136,19 @@ EGLConfig EglCore::getConfig(int flags, int version) {
             EGL_NONE
     };
     int length = sizeof(attribList) / sizeof(attribList[0]);
+#ifdef NATIVE_RENDER_HOST
+    // surfaceless 平台只有 pbuffer config，默认的 EGL_WINDOW_BIT 会匹配不到
+    attribList[length - 3] = EGL_SURFACE_TYPE;
+    attribList[length - 2] = EGL_PBUFFER_BIT;
+#else
     if ((flags & FLAG_RECORDABLE) != 0) {
         attribList[length - 3] = EGL_RECORDABLE_ANDROID;
         attribList[length - 2] = 1;
     }
+#endif
     EGLConfig configs = NULL;
-    int numConfigs;
-    if (!eglChooseConfig(mEGLDisplay, attribList, &configs, 1, &numConfigs)) {
+    int numConfigs = 0;
+    if (!eglChooseConfig(mEGLDisplay, attribList, &configs, 1, &numConfigs) || numConfigs < 1) {
         LOGCATE("unable to find RGB8888 / %d  EGLConfig", version);
         return NULL;
     }
@@ -187,7 +202,7 @@ EGLSurface EglCore::createWindowSurface(ANativeWindow *surface) {
             EGL_NONE
     };
     LOGCATE("eglCreateWindowSurface start");
-    EGLSurface eglSurface = eglCreateWindowSurface(mEGLDisplay, mEGLConfig, surface, surfaceAttribs);
+    EGLSurface eglSurface = eglCreateWindowSurface(mEGLDisplay, mEGLConfig, (EGLNativeWindowType) surface, surfaceAttribs);
     checkEglError("eglCreateWindowSurface");
     assert(eglSurface != NULL);
     if (eglSurface == NULL) {
@@ -260,6 +275,7 @@ void EglCore::makeNothingCurrent() {
  * @return
  */
 bool EglCore::swapBuffers(EGLSurface eglSurface) {
+    TRACE_SCOPE("eglSwapBuffers");
     return eglSwapBuffers(mEGLDisplay, eglSurface);
 }
 
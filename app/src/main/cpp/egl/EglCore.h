@@ -9,6 +9,7 @@
 #include <EGL/egl.h>
 #include <EGL/eglext.h>
 #include <EGL/eglplatform.h>
+#include <stddef.h>
 
 /**
  * Constructor flag: surface must be recordable.  This discourages EGL from using a
@@ -26,6 +27,10 @@
 // Android-specific extension
 #define EGL_RECORDABLE_ANDROID 0x3142
 
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
 typedef EGLBoolean (EGLAPIENTRYP EGL_PRESENTATION_TIME_ANDROIDPROC)(EGLDisplay display, EGLSurface surface, khronos_stime_nanoseconds_t time);
 
 class EglCore {
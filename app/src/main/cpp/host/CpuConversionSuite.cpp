@@ -0,0 +1,341 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "CpuConversionSuite.h"
+#include <string.h>
+#include <algorithm>
+#include <GLES3/gl3.h>
+#include "YuvConversionSuite.h"
+#include "SampleRegistry.h"
+#include "ImageConverter.h"
+#include "ImageKernels.h"
+#include "ThreadPool.h"
+#include "LogUtil.h"
+
+struct CpuGpuCase
+{
+	int sampleType;
+	int format;
+	bool toYuv;      // true 为 RGB2* 样例，比较 YUV 输出；false 为 Render* 样例，比较绘制结果
+	double minPsnr;
+};
+
+// RGB2* 只有量化舍入误差；Render* 的 P010 用线性过滤插值色度，CPU 取最近的色度样本，网格线边缘误差较大
+static const CpuGpuCase s_GpuCases[] = {
+		{SAMPLE_TYPE_KEY_RGB2YUYV,          IMAGE_FORMAT_YUYV,   true,  45.0},
+		{SAMPLE_TYPE_KEY_RGB2NV21,          IMAGE_FORMAT_NV21,   true,  45.0},
+		{SAMPLE_TYPE_KEY_RGB2I420,          IMAGE_FORMAT_I420,   true,  45.0},
+		{SAMPLE_TYPE_KEY_RGB2I444,          IMAGE_FORMAT_I444,   true,  45.0},
+		{SAMPLE_TYPE_KEY_RENDER_NV21,       IMAGE_FORMAT_NV21,   false, 40.0},
+		{SAMPLE_TYPE_KEY_RENDER_I420,       IMAGE_FORMAT_I420,   false, 40.0},
+		{SAMPLE_TYPE_KEY_RENDER_YUYV,       IMAGE_FORMAT_YUYV,   false, 40.0},
+		{SAMPLE_TYPE_KEY_RENDER_P010,       IMAGE_FORMAT_P010,   false, 30.0},
+		{SAMPLE_TYPE_KEY_RENDER_16BIT_GRAY, IMAGE_FORMAT_GRAY10, false, 40.0},
+};
+
+static const int s_MatrixFormats[] = {
+		IMAGE_FORMAT_RGBA, IMAGE_FORMAT_NV21, IMAGE_FORMAT_NV12, IMAGE_FORMAT_I420, IMAGE_FORMAT_I444,
+		IMAGE_FORMAT_YUYV, IMAGE_FORMAT_P010, IMAGE_FORMAT_GRAY, IMAGE_FORMAT_GRAY10,
+};
+
+const char *CpuConversionSuite::GetFormatName(int format)
+{
+	switch (format)
+	{
+		case IMAGE_FORMAT_RGBA: return IMAGE_FORMAT_RGBA_EXT;
+		case IMAGE_FORMAT_NV21: return IMAGE_FORMAT_NV21_EXT;
+		case IMAGE_FORMAT_NV12: return IMAGE_FORMAT_NV12_EXT;
+		case IMAGE_FORMAT_I420: return IMAGE_FORMAT_I420_EXT;
+		case IMAGE_FORMAT_YUYV: return IMAGE_FORMAT_YUYV_EXT;
+		case IMAGE_FORMAT_GRAY: return IMAGE_FORMAT_GRAY_EXT;
+		case IMAGE_FORMAT_I444: return IMAGE_FORMAT_I444_EXT;
+		case IMAGE_FORMAT_P010: return IMAGE_FORMAT_P010_EXT;
+		case IMAGE_FORMAT_GRAY10: return IMAGE_FORMAT_GRAY10_EXT;
+		default: return "unknown";
+	}
+}
+
+static bool HasChroma(int format)
+{
+	return format != IMAGE_FORMAT_GRAY && format != IMAGE_FORMAT_GRAY10;
+}
+
+static int GetBitDepth(int format)
+{
+	return format == IMAGE_FORMAT_P010 || format == IMAGE_FORMAT_GRAY10 ? 10 : 8;
+}
+
+// 色度相对亮度的下采样倍数（以 2 为底）
+static void GetChromaShift(int format, int &shiftX, int &shiftY)
+{
+	shiftX = format == IMAGE_FORMAT_I444 ? 0 : 1;
+	shiftY = format == IMAGE_FORMAT_I444 || format == IMAGE_FORMAT_YUYV ? 0 : 1;
+}
+
+// YUV 之间的转换在色度分辨率和位深都不降低时可以无损往返
+static bool IsLossless(int srcFormat, int dstFormat)
+{
+	if (srcFormat == IMAGE_FORMAT_RGBA || dstFormat == IMAGE_FORMAT_RGBA) return false;
+	if (GetBitDepth(dstFormat) < GetBitDepth(srcFormat)) return false;
+	if (!HasChroma(srcFormat)) return true;
+	if (!HasChroma(dstFormat)) return false;
+	int srcShiftX, srcShiftY, dstShiftX, dstShiftY;
+	GetChromaShift(srcFormat, srcShiftX, srcShiftY);
+	GetChromaShift(dstFormat, dstShiftX, dstShiftY);
+	return dstShiftX <= srcShiftX && dstShiftY <= srcShiftY;
+}
+
+static void InitImage(NativeImage &image, int format, int width, int height)
+{
+	image = NativeImage();
+	image.format = format;
+	image.width = width;
+	image.height = height;
+}
+
+static bool IsSameImage(const NativeImage &a, const NativeImage &b)
+{
+	size_t size = (size_t) NativeImageUtil::GetPackedSize(a.format, a.width, a.height);
+	return a.format == b.format && memcmp(a.ppPlane[0], b.ppPlane[0], size) == 0;
+}
+
+// 按 RGBA 拆出 R、G、B 三个平面
+static void SplitRgb(const uint8_t *pRgba, int pixelCount, std::vector<uint8_t> planes[3])
+{
+	for (int i = 0; i < 3; ++i)
+	{
+		planes[i].resize(pixelCount);
+		for (int p = 0; p < pixelCount; ++p) planes[i][p] = pRgba[p * 4 + i];
+	}
+}
+
+// RGB2*：比较样例回读的 YUV 与 CPU 转换结果
+static int CompareYuvOutput(const BenchmarkConfig &config, const CpuGpuCase &testCase, CpuGpuConformanceResult &result)
+{
+	const NativeImage *pRgba = config.pImage;
+	BenchmarkConfig caseConfig = config;
+	caseConfig.sampleType = testCase.sampleType;
+	NativeImage output;
+	caseConfig.pOutput = &output;
+	BenchmarkResult benchmark;
+	if (SampleBenchmark::Run(caseConfig, benchmark) != 0) return -1;
+	result.name = benchmark.name;
+
+	NativeImage cpuImage;
+	InitImage(cpuImage, testCase.format, pRgba->width, pRgba->height);
+	std::vector<uint8_t> actual[3], expected[3];
+	if (ImageConverter::Convert(pRgba, &cpuImage) == 0 && output.format == testCase.format
+		&& output.width == pRgba->width && output.height == pRgba->height
+		&& YuvConversionSuite::SplitPlanes(&output, actual) && YuvConversionSuite::SplitPlanes(&cpuImage, expected))
+	{
+		for (int i = 0; i < 3; ++i) result.psnr[i] = YuvConversionSuite::ComputePsnr(expected[i], actual[i]);
+	}
+	else
+	{
+		LOGCATE("CpuConversionSuite::CompareYuvOutput %s has no output image", result.name.c_str());
+	}
+	NativeImageUtil::FreeNativeImage(&cpuImage);
+	NativeImageUtil::FreeNativeImage(&output);
+	return 0;
+}
+
+// Render*：以 CPU 转出的图像为输入绘制一帧，回读默认 framebuffer 与 CPU 转回的结果比较
+static int CompareRenderOutput(const BenchmarkConfig &config, const CpuGpuCase &testCase, CpuGpuConformanceResult &result)
+{
+	const NativeImage *pRgba = config.pImage;
+	int width = pRgba->width, height = pRgba->height;
+	NativeImage input;
+	InitImage(input, testCase.format, width, height);
+	if (ImageConverter::Convert(pRgba, &input) != 0) return -1;
+
+	BenchmarkConfig caseConfig = config;
+	caseConfig.sampleType = testCase.sampleType;
+	caseConfig.pImage = &input;
+	caseConfig.width = width;
+	caseConfig.height = height;
+	BenchmarkResult benchmark;
+	int ret = SampleBenchmark::Run(caseConfig, benchmark);
+	result.name = benchmark.name;
+
+	// 样例把图像第一行画在屏幕顶部，glReadPixels 从底部开始，回读后上下翻转
+	std::vector<uint8_t> pixels((size_t) width * height * 4), flipped(pixels.size());
+	glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+	for (int y = 0; y < height; ++y)
+	{
+		memcpy(&flipped[(size_t) y * width * 4], &pixels[(size_t) (height - 1 - y) * width * 4], (size_t) width * 4);
+	}
+
+	// 16BitGray 样例直接显示亮度值，与 CPU 转为 GRAY 的结果比较
+	bool gray = !HasChroma(testCase.format);
+	NativeImage cpuImage;
+	InitImage(cpuImage, gray ? IMAGE_FORMAT_GRAY : IMAGE_FORMAT_RGBA, width, height);
+	std::vector<uint8_t> actual[3], expected[3];
+	if (ret == 0 && ImageConverter::Convert(&input, &cpuImage) == 0)
+	{
+		SplitRgb(flipped.data(), width * height, actual);
+		if (gray)
+		{
+			result.planeCount = 1;
+			expected[0].assign(cpuImage.ppPlane[0], cpuImage.ppPlane[0] + (size_t) width * height);
+		}
+		else
+		{
+			SplitRgb(cpuImage.ppPlane[0], width * height, expected);
+		}
+		for (int i = 0; i < result.planeCount; ++i) result.psnr[i] = YuvConversionSuite::ComputePsnr(expected[i], actual[i]);
+	}
+	NativeImageUtil::FreeNativeImage(&cpuImage);
+	NativeImageUtil::FreeNativeImage(&input);
+	return ret;
+}
+
+int CpuConversionSuite::RunGpuConformance(const BenchmarkConfig &config, std::vector<CpuGpuConformanceResult> &results)
+{
+	const NativeImage *pRgba = config.pImage;
+	if (pRgba == nullptr || pRgba->format != IMAGE_FORMAT_RGBA || pRgba->width % 8 != 0 || pRgba->height % 4 != 0)
+	{
+		LOGCATE("CpuConversionSuite::RunGpuConformance need RGBA input with width %% 8 == 0 and height %% 4 == 0");
+		return -1;
+	}
+	bool canRender = config.width == pRgba->width && config.height == pRgba->height;
+	if (!canRender)
+	{
+		LOGCATE("CpuConversionSuite::RunGpuConformance surface %dx%d differs from image, skip Render* samples",
+				config.width, config.height);
+	}
+
+	results.clear();
+	int failures = 0;
+	for (const CpuGpuCase &testCase : s_GpuCases)
+	{
+		if (!testCase.toYuv && !canRender) continue;
+		CpuGpuConformanceResult result;
+		result.sampleType = testCase.sampleType;
+		result.format = testCase.format;
+		result.minPsnr = testCase.minPsnr;
+		int ret = testCase.toYuv ? CompareYuvOutput(config, testCase, result) : CompareRenderOutput(config, testCase, result);
+		if (ret != 0) return -1;
+
+		result.passed = true;
+		for (int i = 0; i < result.planeCount; ++i)
+		{
+			result.passed = result.passed && result.psnr[i] >= testCase.minPsnr;
+		}
+		if (!result.passed) failures++;
+		results.push_back(result);
+	}
+	return failures;
+}
+
+// 返回最快一次转换的耗时，单位 ms，失败返回 -1
+static double TimeConvert(const NativeImage *pSrc, NativeImage *pDst)
+{
+	double bestMs = -1;
+	for (int i = 0; i < CPU_SUITE_ITERATIONS; ++i)
+	{
+		int64_t begin = GetSysCurrentTimeNs();
+		if (ImageConverter::Convert(pSrc, pDst) != 0) return -1;
+		double ms = (GetSysCurrentTimeNs() - begin) / 1e6;
+		if (bestMs < 0 || ms < bestMs) bestMs = ms;
+	}
+	return bestMs;
+}
+
+int CpuConversionSuite::RunMatrix(const NativeImage *pRgba, std::vector<CpuConversionResult> &results)
+{
+	if (pRgba == nullptr || pRgba->format != IMAGE_FORMAT_RGBA || pRgba->width % 2 != 0 || pRgba->height % 2 != 0)
+	{
+		LOGCATE("CpuConversionSuite::RunMatrix need RGBA input with even size");
+		return -1;
+	}
+	int width = pRgba->width, height = pRgba->height;
+	double megaPixels = (double) width * height / 1e6;
+	const int formatCount = sizeof(s_MatrixFormats) / sizeof(s_MatrixFormats[0]);
+
+	// 各格式的源图都由 RGBA 输入转出
+	NativeImage sources[formatCount];
+	for (int i = 0; i < formatCount; ++i)
+	{
+		InitImage(sources[i], s_MatrixFormats[i], width, height);
+		if (ImageConverter::Convert(pRgba, &sources[i]) != 0) return -1;
+	}
+
+	ThreadPool *pPool = ThreadPool::GetInstance();
+	int threadCount = pPool->GetThreadCount();
+	bool simd = ImageKernels::IsSimdEnabled();
+
+	results.clear();
+	int failures = 0;
+	for (int s = 0; s < formatCount; ++s)
+	{
+		for (int d = 0; d < formatCount; ++d)
+		{
+			CpuConversionResult result;
+			result.srcFormat = s_MatrixFormats[s];
+			result.dstFormat = s_MatrixFormats[d];
+			result.lossless = IsLossless(result.srcFormat, result.dstFormat);
+
+			NativeImage fast, scalar, back;
+			InitImage(fast, result.dstFormat, width, height);
+			InitImage(scalar, result.dstFormat, width, height);
+			InitImage(back, result.srcFormat, width, height);
+
+			double fastMs = TimeConvert(&sources[s], &fast);
+			ImageKernels::SetSimdEnabled(false);
+			pPool->SetThreadCount(1);
+			double scalarMs = TimeConvert(&sources[s], &scalar);
+			ImageKernels::SetSimdEnabled(simd);
+			pPool->SetThreadCount(threadCount);
+
+			if (fastMs > 0) result.mpps = megaPixels / fastMs * 1000.0;
+			if (scalarMs > 0) result.scalarMpps = megaPixels / scalarMs * 1000.0;
+			result.identical = fastMs >= 0 && scalarMs >= 0 && IsSameImage(fast, scalar);
+			if (result.lossless)
+			{
+				result.roundTrip = ImageConverter::Convert(&fast, &back) == 0 && IsSameImage(back, sources[s]);
+			}
+			result.passed = result.identical && result.roundTrip;
+			if (!result.passed) failures++;
+			results.push_back(result);
+
+			NativeImageUtil::FreeNativeImage(&fast);
+			NativeImageUtil::FreeNativeImage(&scalar);
+			NativeImageUtil::FreeNativeImage(&back);
+		}
+	}
+
+	for (int i = 0; i < formatCount; ++i)
+	{
+		NativeImageUtil::FreeNativeImage(&sources[i]);
+	}
+	return failures;
+}
+
+void CpuConversionSuite::WriteJson(FILE *fp, const NativeImage *pRgba, const std::vector<CpuGpuConformanceResult> &gpuResults,
+								   const std::vector<CpuConversionResult> &matrixResults)
+{
+	fprintf(fp, "{\n\"renderer\":\"%s\",\n\"simd\":\"%s\",\n\"threads\":%d,\n\"width\":%d,\n\"height\":%d,\n\"gpu\":[\n",
+			glGetString(GL_RENDERER), ImageKernels::GetSimdName(), ThreadPool::GetInstance()->GetThreadCount(),
+			pRgba->width, pRgba->height);
+	for (size_t i = 0; i < gpuResults.size(); ++i)
+	{
+		const CpuGpuConformanceResult &result = gpuResults[i];
+		fprintf(fp, "{\"name\":\"%s\",\"type\":%d,\"format\":\"%s\",\"psnr\":[%.2f,%.2f,%.2f],\"minPsnr\":%.2f,\"passed\":%s}%s\n",
+				result.name.c_str(), result.sampleType, GetFormatName(result.format),
+				result.psnr[0], result.psnr[1], result.psnr[2], result.minPsnr, result.passed ? "true" : "false",
+				i + 1 < gpuResults.size() ? "," : "");
+	}
+	fprintf(fp, "],\n\"matrix\":[\n");
+	for (size_t i = 0; i < matrixResults.size(); ++i)
+	{
+		const CpuConversionResult &result = matrixResults[i];
+		fprintf(fp, "{\"src\":\"%s\",\"dst\":\"%s\",\"mpps\":%.2f,\"scalarMpps\":%.2f,\"identical\":%s,\"lossless\":%s,"
+					"\"roundTrip\":%s,\"passed\":%s}%s\n",
+				GetFormatName(result.srcFormat), GetFormatName(result.dstFormat), result.mpps, result.scalarMpps,
+				result.identical ? "true" : "false", result.lossless ? "true" : "false",
+				result.roundTrip ? "true" : "false", result.passed ? "true" : "false",
+				i + 1 < matrixResults.size() ? "," : "");
+	}
+	fprintf(fp, "]\n}\n");
+}
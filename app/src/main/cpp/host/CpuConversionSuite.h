@@ -0,0 +1,63 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_CPUCONVERSIONSUITE_H
+#define NDK_OPENGLES_3_0_CPUCONVERSIONSUITE_H
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "ImageDef.h"
+#include "SampleBenchmark.h"
+
+// CPU 转换计时的重复次数，取最快的一次
+#define CPU_SUITE_ITERATIONS 5
+
+// 与 GPU 样例输出的一致性结果
+struct CpuGpuConformanceResult
+{
+	int sampleType = 0;
+	std::string name;
+	int format = 0;           // 样例输出（RGB2*）或输入（Render*）的格式
+	int planeCount = 3;       // 参与比较的平面数，RGB2* 为 Y、U、V，Render* 为 R、G、B，灰度只比较一个平面
+	double psnr[3] = {0};
+	double minPsnr = 0;
+	bool passed = false;
+};
+
+// 转换矩阵中一对格式的结果
+struct CpuConversionResult
+{
+	int srcFormat = 0;
+	int dstFormat = 0;
+	double mpps = 0;          // SIMD + 线程池
+	double scalarMpps = 0;    // 标量 + 单线程
+	bool identical = false;   // 两种配置的输出逐字节一致
+	bool lossless = false;    // 色度分辨率和位深不降低，应能无损往返
+	bool roundTrip = true;    // lossless 时 src -> dst -> src 是否还原
+	bool passed = false;
+};
+
+/**
+ * ImageConverter 的一致性套件：
+ * 1. 与 GPU 样例比较：RGB2* 样例回读的 YUV 与 CPU 的 RGBA 转换逐平面比较 PSNR；
+ *    Render* 样例以 CPU 转出的 YUV 为输入、按图像尺寸绘制后回读，与 CPU 转回的 RGBA 比较；
+ * 2. 转换矩阵：所有格式两两互转，检查 SIMD + 线程池与标量单线程输出逐字节一致、无损组合能还原，并记录 MP/s。
+ */
+class CpuConversionSuite
+{
+public:
+	// config.pImage 为 RGBA 输入图，宽需为 8 的倍数、高需为 4 的倍数；Render* 的比较要求 surface 与图像同尺寸
+	// 返回未通过的项数，出错返回 -1
+	static int RunGpuConformance(const BenchmarkConfig &config, std::vector<CpuGpuConformanceResult> &results);
+
+	static int RunMatrix(const NativeImage *pRgba, std::vector<CpuConversionResult> &results);
+
+	static void WriteJson(FILE *fp, const NativeImage *pRgba, const std::vector<CpuGpuConformanceResult> &gpuResults,
+						  const std::vector<CpuConversionResult> &matrixResults);
+
+	static const char *GetFormatName(int format);
+};
+
+#endif //NDK_OPENGLES_3_0_CPUCONVERSIONSUITE_H
@@ -0,0 +1,131 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "LogBenchmark.h"
+#include <GLES3/gl3.h>
+#include "SampleRegistry.h"
+#include "AsyncLogger.h"
+#include "LogUtil.h"
+
+#define LOG_MODE_SYNC         0
+#define LOG_MODE_ASYNC        1
+#define LOG_MODE_COMPILED_OUT 2
+
+// 与 BYTEFLOW_LOG 展开方式相同、级别低于编译期级别的日志，调用和参数求值都被消除
+#define LOG_BENCHMARK_COMPILED_OUT(...) do { if (ANDROID_LOG_VERBOSE >= ANDROID_LOG_SILENT) ByteFlowLogPrint(ANDROID_LOG_VERBOSE, LOG_TAG, __VA_ARGS__); } while (0)
+
+static const char *const kModeNames[] = {"sync", "async", "compiled-out"};
+
+// 与改造前渲染路径上的 LOGCATE 一样带几个格式化参数
+static inline void EmitLog(int mode, int frame, int line, float value)
+{
+	if (mode == LOG_MODE_COMPILED_OUT)
+	{
+		LOG_BENCHMARK_COMPILED_OUT("LogBenchmark::EmitLog frame=%d, line=%d, value=%f", frame, line, value);
+		return;
+	}
+	ByteFlowLogPrint(ANDROID_LOG_ERROR, LOG_TAG, "LogBenchmark::EmitLog frame=%d, line=%d, value=%f", frame, line, value);
+}
+
+static double MeasurePerCall(int mode)
+{
+	int64_t totalNs = 0;
+	for (int i = 0; i < LOG_BENCHMARK_CALLS; i += LOG_BENCHMARK_BATCH)
+	{
+		int64_t begin = GetSysCurrentTimeNs();
+		for (int j = 0; j < LOG_BENCHMARK_BATCH; ++j)
+		{
+			EmitLog(mode, i, j, i * 0.5f);
+		}
+		totalNs += GetSysCurrentTimeNs() - begin;
+		if (mode == LOG_MODE_ASYNC) AsyncLogger::GetInstance()->Flush();
+	}
+	int calls = (LOG_BENCHMARK_CALLS + LOG_BENCHMARK_BATCH - 1) / LOG_BENCHMARK_BATCH * LOG_BENCHMARK_BATCH;
+	return (double) totalNs / calls;
+}
+
+static int MeasureFrames(const BenchmarkConfig &config, int mode, FrameTimeStats &stats)
+{
+	GLSampleBase *pSample = SampleRegistry::CreateSample(config.sampleType);
+	if (pSample == nullptr)
+	{
+		LOGCATE("LogBenchmark::MeasureFrames unknown sample type=%d", config.sampleType);
+		return -1;
+	}
+	if (config.pImage) pSample->LoadImage(config.pImage);
+	glViewport(0, 0, config.width, config.height);
+
+	std::vector<int64_t> frameNs;
+	frameNs.reserve(config.frames);
+	int totalFrames = config.warmupFrames + config.frames;
+	for (int i = 0; i < totalFrames; ++i)
+	{
+		int64_t begin = GetSysCurrentTimeNs();
+		glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
+		pSample->Init();
+		pSample->Draw(config.width, config.height);
+		for (int line = 0; line < LOG_BENCHMARK_LINES_PER_FRAME; ++line)
+		{
+			EmitLog(mode, i, line, begin * 1e-9f);
+		}
+		glFinish();
+		if (i >= config.warmupFrames) frameNs.push_back(GetSysCurrentTimeNs() - begin);
+	}
+
+	pSample->Destroy();
+	delete pSample;
+	stats.Compute(frameNs);
+	return 0;
+}
+
+int LogBenchmark::Run(const BenchmarkConfig &config, std::vector<LogBenchmarkResult> &results)
+{
+	// 日志必须真正输出才能体现同步 I/O 的开销
+	int hostLevel = HostLogLevel();
+	int runtimeLevel = AsyncLogger::GetLevel();
+	bool async = AsyncLogger::IsAsync();
+	HostLogLevel() = ANDROID_LOG_VERBOSE;
+	AsyncLogger::SetLevel(ANDROID_LOG_VERBOSE);
+
+	int ret = 0;
+	results.clear();
+	for (int mode = LOG_MODE_SYNC; mode <= LOG_MODE_COMPILED_OUT; ++mode)
+	{
+		AsyncLogger::SetAsync(mode == LOG_MODE_ASYNC);
+		uint64_t dropped = AsyncLogger::GetInstance()->GetDroppedCount();
+
+		LogBenchmarkResult result;
+		result.mode = kModeNames[mode];
+		result.nsPerCall = MeasurePerCall(mode);
+		if (MeasureFrames(config, mode, result.frame) != 0)
+		{
+			ret = -1;
+			break;
+		}
+		AsyncLogger::GetInstance()->Flush();
+		result.dropped = AsyncLogger::GetInstance()->GetDroppedCount() - dropped;
+		results.push_back(result);
+	}
+
+	AsyncLogger::SetAsync(async);
+	AsyncLogger::SetLevel(runtimeLevel);
+	HostLogLevel() = hostLevel;
+	return ret;
+}
+
+void LogBenchmark::WriteJson(FILE *fp, const BenchmarkConfig &config, const std::vector<LogBenchmarkResult> &results)
+{
+	const SampleRegistryEntry *pEntry = SampleRegistry::Find(config.sampleType);
+	fprintf(fp, "{\n\"renderer\":\"%s\",\n\"sample\":\"%s\",\n\"width\":%d,\n\"height\":%d,\n\"frames\":%d,\n"
+				"\"linesPerFrame\":%d,\n\"modes\":[\n", glGetString(GL_RENDERER), pEntry ? pEntry->name : "UnknownSample",
+			config.width, config.height, config.frames, LOG_BENCHMARK_LINES_PER_FRAME);
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const LogBenchmarkResult &result = results[i];
+		fprintf(fp, "{\"mode\":\"%s\",\"nsPerCall\":%.1f,\"dropped\":%llu,\"frame\":{\"p50\":%.4f,\"p95\":%.4f,\"p99\":%.4f,\"mean\":%.4f}}%s\n",
+				result.mode.c_str(), result.nsPerCall, (unsigned long long) result.dropped, result.frame.p50Ms,
+				result.frame.p95Ms, result.frame.p99Ms, result.frame.meanMs, i + 1 < results.size() ? "," : "");
+	}
+	fprintf(fp, "]\n}\n");
+}
@@ -0,0 +1,42 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_LOGBENCHMARK_H
+#define NDK_OPENGLES_3_0_LOGBENCHMARK_H
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "SampleBenchmark.h"
+
+// 每帧输出的日志条数，对应改造前渲染路径上 OnDrawFrame、Draw、UpdateMVPMatrix、handleMessage 各一条
+#define LOG_BENCHMARK_LINES_PER_FRAME 4
+
+// 单条日志耗时的调用次数，异步模式每批不超过缓冲容量的一半，批间 Flush 不计时
+#define LOG_BENCHMARK_CALLS 20000
+#define LOG_BENCHMARK_BATCH 256
+
+struct LogBenchmarkResult
+{
+	std::string mode;         // sync、async 或 compiled-out
+	double nsPerCall = 0;     // 单条日志在调用线程上的耗时
+	FrameTimeStats frame;     // 样例每帧附带 LOG_BENCHMARK_LINES_PER_FRAME 条日志时的整帧耗时
+	uint64_t dropped = 0;     // 异步模式下因缓冲写满丢弃的条数
+};
+
+/**
+ * 日志开销基准：分别以同步输出（改造前的 LOGCATE）、AsyncLogger 异步输出和编译期消除三种方式，
+ * 测量单条日志的调用耗时，以及样例逐帧带日志绘制时的帧耗时分布。
+ * 日志写到 stderr，运行时重定向到文件或 /dev/null，避免终端刷新干扰计时。
+ */
+class LogBenchmark
+{
+public:
+	// 调用前需在当前线程 makeCurrent，成功返回 0
+	static int Run(const BenchmarkConfig &config, std::vector<LogBenchmarkResult> &results);
+
+	static void WriteJson(FILE *fp, const BenchmarkConfig &config, const std::vector<LogBenchmarkResult> &results);
+};
+
+#endif //NDK_OPENGLES_3_0_LOGBENCHMARK_H
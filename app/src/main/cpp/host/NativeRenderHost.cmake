@@ -0,0 +1,52 @@
+# 主机构建：在 Linux 上用 Mesa surfaceless EGL（llvmpipe 软件渲染）编译渲染核心，
+# 日志输出到 stderr，JNI 层由命令行驱动 native-render-host 替代，用于无 GPU 的 CI 跑性能回归。
+#
+#   cmake -S app/src/main/cpp -B build-host && cmake --build build-host -j
+#   ./build-host/native-render-host --list
+#   ./build-host/native-render-host --sample RGB2NV21Sample --frames 300 --profile
+#   ./build-host/native-render-host --benchmark --json head.json && ./build-host/native-render-host --compare base.json head.json
+#   ./build-host/native-render-host --yuv-suite --frames 30
+#   ./build-host/native-render-host --cpu-convert-suite --frames 3
+#   ./build-host/native-render-host --log-benchmark --sample TriangleSample 2>/dev/null
+#   ./build-host/native-render-host --simd-check
+#   ./build-host/native-render-host --looper-benchmark --looper-messages 20000
+
+set(CMAKE_CXX_STANDARD 11)
+set(CMAKE_CXX_STANDARD_REQUIRED ON)
+if (NOT CMAKE_BUILD_TYPE)
+    set(CMAKE_BUILD_TYPE Release)
+endif ()
+
+find_path(EGL_INCLUDE_DIR EGL/egl.h)
+find_library(EGL_LIBRARY EGL)
+find_library(GLESV2_LIBRARY GLESv2)
+if (NOT EGL_INCLUDE_DIR OR NOT EGL_LIBRARY OR NOT GLESV2_LIBRARY)
+    message(FATAL_ERROR "host build requires Mesa libEGL and libGLESv2 (e.g. apt install libegl-dev libgles-dev)")
+endif ()
+find_package(Threads REQUIRED)
+
+# JniImpl 由命令行驱动替代；其余排除的样例依赖 jniLibs 中预编译的 opencv / assimp / freetype
+list(REMOVE_ITEM src-files
+        ${CMAKE_SOURCE_DIR}/JniImpl.cpp
+        ${CMAKE_SOURCE_DIR}/sample/PBOSample.cpp
+        ${CMAKE_SOURCE_DIR}/sample/TimeTunnelSample.cpp
+        ${CMAKE_SOURCE_DIR}/sample/TextRenderSample.cpp
+        ${CMAKE_SOURCE_DIR}/sample/Model3DSample.cpp
+        ${CMAKE_SOURCE_DIR}/sample/GeometryShader2Sample.cpp
+        ${CMAKE_SOURCE_DIR}/sample/GeometryShader3Sample.cpp)
+
+add_library(native-render-core STATIC ${src-files})
+
+# stub 目录提供 android/log.h、android/native_window.h，必须排在系统头文件之前
+target_include_directories(native-render-core BEFORE PUBLIC ${CMAKE_SOURCE_DIR}/host/stub ${EGL_INCLUDE_DIR})
+target_compile_definitions(native-render-core PUBLIC NATIVE_RENDER_HOST)
+target_link_libraries(native-render-core PUBLIC ${EGL_LIBRARY} ${GLESV2_LIBRARY} Threads::Threads)
+
+add_executable(native-render-host
+        ${CMAKE_SOURCE_DIR}/host/NativeRenderHost.cpp
+        ${CMAKE_SOURCE_DIR}/host/SampleBenchmark.cpp
+        ${CMAKE_SOURCE_DIR}/host/YuvConversionSuite.cpp
+        ${CMAKE_SOURCE_DIR}/host/CpuConversionSuite.cpp
+        ${CMAKE_SOURCE_DIR}/host/LogBenchmark.cpp
+        ${CMAKE_SOURCE_DIR}/host/SimdKernelCheck.cpp)
+target_link_libraries(native-render-host native-render-core)
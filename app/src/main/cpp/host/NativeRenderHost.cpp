@@ -0,0 +1,689 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+/**
+ * 主机命令行驱动：替代 JNI 层，按 GLSurfaceView 的调用顺序驱动 MyGLRenderContext，
+ * 在 surfaceless EGL 的 pbuffer 上离屏绘制指定样例，输出逐帧耗时统计。
+ * --benchmark 模式直接创建样例逐个跑基准并输出 JSON，--compare 比较两份 JSON 结果。
+ * --yuv-suite 模式校验 RGB 转 YUV 样例的输出与 CPU 参考实现的 PSNR，并记录吞吐。
+ * --cpu-convert-suite 模式校验 ImageConverter 与 GPU 样例输出一致，并跑完整的格式转换矩阵。
+ * --log-benchmark 模式比较同步、异步和编译期消除三种日志方式的单条耗时与帧耗时。
+ * --simd-check 模式检查 ImageKernels 的 SIMD 与标量实现逐位一致，不需要 GL 上下文。
+ * --looper-benchmark 模式压测 Looper 多生产者投递的吞吐和延迟，不需要 GL 上下文。
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <EglCore.h>
+#include <OffscreenSurface.h>
+#include <MyGLRenderContext.h>
+#include <SampleRegistry.h>
+#include <ProgramBinaryCache.h>
+#include <FrameProfiler.h>
+#include <TraceRecorder.h>
+#include <Texture16Support.h>
+#include <ComputeYuvConverter.h>
+#include <ThreadPool.h>
+#include <AsyncLogger.h>
+#include <ImageDef.h>
+#include <ImageKernels.h>
+#include <LogUtil.h>
+#include <LooperBenchmark.h>
+#include "SampleBenchmark.h"
+#include "YuvConversionSuite.h"
+#include "CpuConversionSuite.h"
+#include "LogBenchmark.h"
+#include "SimdKernelCheck.h"
+
+struct HostOptions
+{
+	std::vector<int> sampleTypes;
+	int frames = 300;
+	int warmupFrames = 10;
+	int surfaceWidth = 1280;
+	int surfaceHeight = 720;
+	const char *imagePath = nullptr;
+	int imageWidth = 1280;
+	int imageHeight = 720;
+	int imageFormat = IMAGE_FORMAT_RGBA;
+	const char *tracePath = nullptr;
+	const char *programCacheDir = nullptr;
+	bool profile = false;
+	bool verbose = false;
+	bool benchmark = false;
+	bool yuvSuite = false;
+	bool cpuConvertSuite = false;
+	bool logBenchmark = false;
+	bool simdCheck = false;
+	bool looperBenchmark = false;
+	int looperMessages = 100000;
+	int threadCount = 0;
+	const char *jsonPath = nullptr;
+	const char *compareBasePath = nullptr;
+	const char *compareHeadPath = nullptr;
+	const char *compareMetric = "frame";
+	double regressionPercent = BENCHMARK_DEFAULT_REGRESSION_PERCENT;
+};
+
+static void PrintUsage(const char *pName)
+{
+	printf("usage: %s [options]\n"
+		   "  --list                   列出可用样例\n"
+		   "  --sample <name|type>     样例注册名或 SAMPLE_TYPE_KEY_* 值，逗号分隔多个，默认 TriangleSample\n"
+		   "  --frames <n>             统计帧数，默认 300\n"
+		   "  --warmup <n>             预热帧数，不计入统计，默认 10\n"
+		   "  --size <WxH>             离屏 surface 尺寸，默认 1280x720\n"
+		   "  --image <path>           原始像素文件，不指定时生成 RGBA 测试图\n"
+		   "  --image-size <WxH>       原始像素文件的尺寸，默认 1280x720\n"
+		   "  --image-format <n>       IMAGE_FORMAT_* 值，默认 RGBA\n"
+		   "  --trace <path>           录制 Chrome trace JSON\n"
+		   "  --profile                输出 FrameProfiler 分 scope 统计\n"
+		   "  --program-cache <dir>    开启 program binary 缓存\n"
+		   "  --texture16 <path>       16bit 纹理上传路径 auto|norm|uint|packed，默认 auto\n"
+		   "  --yuv-backend <name>     RGB2* 样例的转换后端 fragment|compute，默认 fragment\n"
+		   "  --threads <n>            CPU 转换线程池的线程数，默认按 CPU 核数\n"
+		   "  --verbose                输出渲染日志\n"
+		   "  --benchmark              逐个样例跑基准，未指定 --sample 时跑全部样例\n"
+		   "  --json <path>            基准结果写为 JSON\n"
+		   "  --compare <base> <head>  比较两份基准 JSON 的 p50，有回归时返回 2\n"
+		   "  --metric <cpu|gpu|frame> 比较使用的指标，默认 frame\n"
+		   "  --threshold <percent>    判定回归的变慢百分比，默认 %.0f\n"
+		   "  --yuv-suite              校验 RGB 转 YUV 样例的 PSNR 并记录 MP/s，未通过时返回 3\n"
+		   "  --cpu-convert-suite      校验 CPU 格式转换与 GPU 样例一致并跑转换矩阵，未通过时返回 4\n"
+		   "  --log-benchmark          比较同步、异步和编译期消除的日志开销，日志写到 stderr\n"
+		   "  --simd-check             检查 SIMD 与标量转换内核逐位一致，未通过时返回 5\n"
+		   "  --looper-benchmark       1/2/4/8 个生产者同时向 Looper 投递消息，输出吞吐和延迟分布\n"
+		   "  --looper-messages <n>    --looper-benchmark 每个生产者投递的消息数，默认 100000\n", pName, BENCHMARK_DEFAULT_REGRESSION_PERCENT);
+}
+
+static void ListSamples()
+{
+	int count = 0;
+	const SampleRegistryEntry *pEntries = SampleRegistry::GetEntries(count);
+	for (int i = 0; i < count; ++i)
+	{
+		printf("%4d  %s\n", pEntries[i].type, pEntries[i].name);
+	}
+}
+
+static bool ParseSize(const char *pStr, int &width, int &height)
+{
+	return pStr && sscanf(pStr, "%dx%d", &width, &height) == 2 && width > 0 && height > 0;
+}
+
+static int ParseSampleType(const char *pStr)
+{
+	int count = 0;
+	const SampleRegistryEntry *pEntries = SampleRegistry::GetEntries(count);
+	for (int i = 0; i < count; ++i)
+	{
+		if (strcmp(pEntries[i].name, pStr) == 0) return pEntries[i].type;
+	}
+	char *pEnd = nullptr;
+	long type = strtol(pStr, &pEnd, 10);
+	if (pEnd != pStr && *pEnd == '\0' && SampleRegistry::Find((int) type)) return (int) type;
+	return -1;
+}
+
+// 返回 0 继续运行，1 正常退出，-1 参数错误
+static int ParseArgs(int argc, char **argv, HostOptions &options)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		const char *pArg = argv[i];
+		const char *pValue = i + 1 < argc ? argv[i + 1] : nullptr;
+		bool consumed = true;
+		if (strcmp(pArg, "--list") == 0)
+		{
+			ListSamples();
+			return 1;
+		}
+		else if (strcmp(pArg, "--help") == 0 || strcmp(pArg, "-h") == 0)
+		{
+			PrintUsage(argv[0]);
+			return 1;
+		}
+		else if (strcmp(pArg, "--profile") == 0)
+		{
+			options.profile = true;
+			consumed = false;
+		}
+		else if (strcmp(pArg, "--verbose") == 0)
+		{
+			options.verbose = true;
+			consumed = false;
+		}
+		else if (strcmp(pArg, "--benchmark") == 0)
+		{
+			options.benchmark = true;
+			consumed = false;
+		}
+		else if (strcmp(pArg, "--yuv-suite") == 0)
+		{
+			options.yuvSuite = true;
+			consumed = false;
+		}
+		else if (strcmp(pArg, "--cpu-convert-suite") == 0)
+		{
+			options.cpuConvertSuite = true;
+			consumed = false;
+		}
+		else if (strcmp(pArg, "--log-benchmark") == 0)
+		{
+			options.logBenchmark = true;
+			consumed = false;
+		}
+		else if (strcmp(pArg, "--simd-check") == 0)
+		{
+			options.simdCheck = true;
+			consumed = false;
+		}
+		else if (strcmp(pArg, "--looper-benchmark") == 0)
+		{
+			options.looperBenchmark = true;
+			consumed = false;
+		}
+		else if (pValue == nullptr)
+		{
+			fprintf(stderr, "missing value for %s\n", pArg);
+			return -1;
+		}
+		else if (strcmp(pArg, "--sample") == 0)
+		{
+			std::string list = pValue;
+			size_t begin = 0;
+			while (begin <= list.size())
+			{
+				size_t end = list.find(',', begin);
+				if (end == std::string::npos) end = list.size();
+				std::string name = list.substr(begin, end - begin);
+				int type = ParseSampleType(name.c_str());
+				if (type < 0)
+				{
+					fprintf(stderr, "unknown sample %s, see --list\n", name.c_str());
+					return -1;
+				}
+				options.sampleTypes.push_back(type);
+				begin = end + 1;
+			}
+		}
+		else if (strcmp(pArg, "--compare") == 0)
+		{
+			if (i + 2 >= argc) return -1;
+			options.compareBasePath = argv[i + 1];
+			options.compareHeadPath = argv[i + 2];
+			++i;
+		}
+		else if (strcmp(pArg, "--json") == 0) options.jsonPath = pValue;
+		else if (strcmp(pArg, "--metric") == 0) options.compareMetric = pValue;
+		else if (strcmp(pArg, "--threshold") == 0) options.regressionPercent = atof(pValue);
+		else if (strcmp(pArg, "--frames") == 0) options.frames = std::max(1, atoi(pValue));
+		else if (strcmp(pArg, "--warmup") == 0) options.warmupFrames = std::max(0, atoi(pValue));
+		else if (strcmp(pArg, "--size") == 0)
+		{
+			if (!ParseSize(pValue, options.surfaceWidth, options.surfaceHeight)) return -1;
+		}
+		else if (strcmp(pArg, "--image") == 0) options.imagePath = pValue;
+		else if (strcmp(pArg, "--image-size") == 0)
+		{
+			if (!ParseSize(pValue, options.imageWidth, options.imageHeight)) return -1;
+		}
+		else if (strcmp(pArg, "--image-format") == 0) options.imageFormat = atoi(pValue);
+		else if (strcmp(pArg, "--trace") == 0) options.tracePath = pValue;
+		else if (strcmp(pArg, "--program-cache") == 0) options.programCacheDir = pValue;
+		else if (strcmp(pArg, "--texture16") == 0)
+		{
+			int path;
+			if (!Texture16Support::ParsePath(pValue, path)) return -1;
+			Texture16Support::SetForcedPath(path);
+		}
+		else if (strcmp(pArg, "--yuv-backend") == 0)
+		{
+			if (strcmp(pValue, "compute") == 0) ComputeYuvConverter::SetBackend(YUV_BACKEND_COMPUTE);
+			else if (strcmp(pValue, "fragment") == 0) ComputeYuvConverter::SetBackend(YUV_BACKEND_FRAGMENT);
+			else return -1;
+		}
+		else if (strcmp(pArg, "--threads") == 0) options.threadCount = std::max(0, atoi(pValue));
+		else if (strcmp(pArg, "--looper-messages") == 0) options.looperMessages = std::max(1, atoi(pValue));
+		else
+		{
+			fprintf(stderr, "unknown option %s\n", pArg);
+			return -1;
+		}
+		if (consumed) ++i;
+	}
+	return 0;
+}
+
+// 读取原始像素文件，或生成带网格的 RGBA 渐变图，保证依赖图像内容的样例有可采样的输入
+static int LoadTestImage(const HostOptions &options, NativeImage &image)
+{
+	image.width = options.imageWidth;
+	image.height = options.imageHeight;
+	image.format = options.imagePath ? options.imageFormat : IMAGE_FORMAT_RGBA;
+	NativeImageUtil::AllocNativeImage(&image);
+	if (image.ppPlane[0] == nullptr)
+	{
+		fprintf(stderr, "unsupported image format %d\n", image.format);
+		return -1;
+	}
+
+	if (options.imagePath)
+	{
+		FILE *fp = fopen(options.imagePath, "rb");
+		if (fp == nullptr)
+		{
+			fprintf(stderr, "open %s fail\n", options.imagePath);
+			return -1;
+		}
+		size_t size = 0;
+		for (int i = 0; i < NativeImageUtil::GetPlaneCount(image.format); ++i)
+		{
+			size += NativeImageUtil::GetPlaneSize(&image, i);
+		}
+		size_t readSize = fread(image.ppPlane[0], 1, size, fp);
+		fclose(fp);
+		if (readSize != size)
+		{
+			fprintf(stderr, "%s too small, read %zu of %zu bytes\n", options.imagePath, readSize, size);
+			return -1;
+		}
+		return 0;
+	}
+
+	for (int y = 0; y < image.height; ++y)
+	{
+		uint8_t *pRow = image.ppPlane[0] + y * image.width * 4;
+		for (int x = 0; x < image.width; ++x)
+		{
+			bool grid = (x % 64) < 2 || (y % 64) < 2;
+			pRow[x * 4 + 0] = grid ? 255 : (uint8_t) (x * 255 / image.width);
+			pRow[x * 4 + 1] = grid ? 255 : (uint8_t) (y * 255 / image.height);
+			pRow[x * 4 + 2] = grid ? 255 : (uint8_t) ((x + y) * 255 / (image.width + image.height));
+			pRow[x * 4 + 3] = 255;
+		}
+	}
+	return 0;
+}
+
+static void PrintFrameStats(const char *pName, const char *pMetric, const FrameTimeStats &stats)
+{
+	if (stats.count == 0) return;
+	printf("%-32s %-5s n=%d mean=%.3fms p50=%.3fms p95=%.3fms p99=%.3fms max=%.3fms\n",
+		   pName, pMetric, stats.count, stats.meanMs, stats.p50Ms, stats.p95Ms, stats.p99Ms, stats.maxMs);
+}
+
+static int RunBenchmark(const HostOptions &options, NativeImage *pImage)
+{
+	std::vector<int> sampleTypes = options.sampleTypes;
+	if (sampleTypes.empty())
+	{
+		int count = 0;
+		const SampleRegistryEntry *pEntries = SampleRegistry::GetEntries(count);
+		for (int i = 0; i < count; ++i) sampleTypes.push_back(pEntries[i].type);
+	}
+
+	BenchmarkConfig config;
+	config.warmupFrames = options.warmupFrames;
+	config.frames = options.frames;
+	config.width = options.surfaceWidth;
+	config.height = options.surfaceHeight;
+	config.pImage = pImage;
+
+	std::vector<BenchmarkResult> results;
+	for (int type : sampleTypes)
+	{
+		config.sampleType = type;
+		BenchmarkResult result;
+		if (SampleBenchmark::Run(config, result) != 0) continue;
+		printf("%-32s init=%.3fms\n", result.name.c_str(), result.initMs);
+		PrintFrameStats(result.name.c_str(), "cpu", result.cpu);
+		PrintFrameStats(result.name.c_str(), "gpu", result.gpu);
+		PrintFrameStats(result.name.c_str(), "frame", result.frame);
+		results.push_back(result);
+	}
+
+	if (options.jsonPath)
+	{
+		FILE *fp = fopen(options.jsonPath, "w");
+		if (fp == nullptr)
+		{
+			fprintf(stderr, "open %s fail\n", options.jsonPath);
+			return 1;
+		}
+		SampleBenchmark::WriteJson(fp, config, results);
+		fclose(fp);
+	}
+	return 0;
+}
+
+static int RunYuvSuite(const HostOptions &options, NativeImage *pImage)
+{
+	BenchmarkConfig config;
+	config.sampleType = 0;
+	config.warmupFrames = options.warmupFrames;
+	config.frames = options.frames;
+	config.width = options.surfaceWidth;
+	config.height = options.surfaceHeight;
+	config.pImage = pImage;
+
+	std::vector<YuvConversionResult> results;
+	int failures = YuvConversionSuite::Run(config, results);
+	if (failures < 0)
+	{
+		fprintf(stderr, "yuv suite needs an RGBA image with width %% 8 == 0 and height %% 4 == 0\n");
+		return 1;
+	}
+
+	printf("%-20s %-9s %8s %8s %8s %10s %10s %10s\n", "sample", "backend", "Y dB", "U dB", "V dB", "p50 ms", "GPU MP/s", "CPU MP/s");
+	for (auto &result : results)
+	{
+		printf("%-20s %-9s %8.2f %8.2f %8.2f %10.3f %10.1f %10.1f  %s\n", result.name.c_str(),
+			   ComputeYuvConverter::GetBackendName(result.backend),
+			   result.psnr[0], result.psnr[1], result.psnr[2], result.frame.p50Ms, result.gpuMpps, result.cpuMpps,
+			   result.passed ? "PASS" : "FAIL");
+	}
+
+	if (options.jsonPath)
+	{
+		FILE *fp = fopen(options.jsonPath, "w");
+		if (fp == nullptr)
+		{
+			fprintf(stderr, "open %s fail\n", options.jsonPath);
+			return 1;
+		}
+		YuvConversionSuite::WriteJson(fp, config, results);
+		fclose(fp);
+	}
+	printf("%d of %zu failed\n", failures, results.size());
+	return failures > 0 ? 3 : 0;
+}
+
+static int RunCpuConvertSuite(const HostOptions &options, NativeImage *pImage)
+{
+	BenchmarkConfig config;
+	config.sampleType = 0;
+	config.warmupFrames = options.warmupFrames;
+	config.frames = options.frames;
+	config.width = options.surfaceWidth;
+	config.height = options.surfaceHeight;
+	config.pImage = pImage;
+
+	std::vector<CpuGpuConformanceResult> gpuResults;
+	int gpuFailures = CpuConversionSuite::RunGpuConformance(config, gpuResults);
+	if (gpuFailures < 0)
+	{
+		fprintf(stderr, "cpu convert suite needs an RGBA image with width %% 8 == 0 and height %% 4 == 0\n");
+		return 1;
+	}
+	if (options.surfaceWidth != pImage->width || options.surfaceHeight != pImage->height)
+	{
+		printf("surface size differs from image, Render* samples skipped\n");
+	}
+
+	printf("%-24s %-7s %8s %8s %8s %8s\n", "sample", "format", "dB 0", "dB 1", "dB 2", "min dB");
+	for (auto &result : gpuResults)
+	{
+		printf("%-24s %-7s", result.name.c_str(), CpuConversionSuite::GetFormatName(result.format));
+		for (int i = 0; i < 3; ++i)
+		{
+			if (i < result.planeCount) printf(" %8.2f", result.psnr[i]);
+			else printf(" %8s", "-");
+		}
+		printf(" %8.2f  %s\n", result.minPsnr, result.passed ? "PASS" : "FAIL");
+	}
+
+	std::vector<CpuConversionResult> matrixResults;
+	int matrixFailures = CpuConversionSuite::RunMatrix(pImage, matrixResults);
+	if (matrixFailures < 0) return 1;
+
+	printf("\n%s, %d thread(s)\n", ImageKernels::GetSimdName(), ThreadPool::GetInstance()->GetThreadCount());
+	printf("%-7s %-7s %10s %12s %8s %10s %10s\n", "src", "dst", "MP/s", "scalar MP/s", "speedup", "identical", "roundtrip");
+	for (auto &result : matrixResults)
+	{
+		printf("%-7s %-7s %10.1f %12.1f %7.2fx %10s %10s  %s\n", CpuConversionSuite::GetFormatName(result.srcFormat),
+			   CpuConversionSuite::GetFormatName(result.dstFormat), result.mpps, result.scalarMpps,
+			   result.scalarMpps > 0 ? result.mpps / result.scalarMpps : 0.0, result.identical ? "yes" : "NO",
+			   result.lossless ? (result.roundTrip ? "yes" : "NO") : "-", result.passed ? "PASS" : "FAIL");
+	}
+
+	if (options.jsonPath)
+	{
+		FILE *fp = fopen(options.jsonPath, "w");
+		if (fp == nullptr)
+		{
+			fprintf(stderr, "open %s fail\n", options.jsonPath);
+			return 1;
+		}
+		CpuConversionSuite::WriteJson(fp, pImage, gpuResults, matrixResults);
+		fclose(fp);
+	}
+	int failures = gpuFailures + matrixFailures;
+	printf("%d of %zu failed\n", failures, gpuResults.size() + matrixResults.size());
+	return failures > 0 ? 4 : 0;
+}
+
+static int RunLogBenchmark(const HostOptions &options, NativeImage *pImage)
+{
+	BenchmarkConfig config;
+	config.sampleType = options.sampleTypes.empty() ? SAMPLE_TYPE_KEY_TRIANGLE : options.sampleTypes[0];
+	config.warmupFrames = options.warmupFrames;
+	config.frames = options.frames;
+	config.width = options.surfaceWidth;
+	config.height = options.surfaceHeight;
+	config.pImage = pImage;
+
+	std::vector<LogBenchmarkResult> results;
+	if (LogBenchmark::Run(config, results) != 0) return 1;
+
+	const SampleRegistryEntry *pEntry = SampleRegistry::Find(config.sampleType);
+	printf("%s, %d log line(s) per frame\n", pEntry ? pEntry->name : "UnknownSample", LOG_BENCHMARK_LINES_PER_FRAME);
+	printf("%-13s %10s %10s %10s %10s %8s\n", "mode", "ns/call", "p50 ms", "p95 ms", "p99 ms", "dropped");
+	for (auto &result : results)
+	{
+		printf("%-13s %10.1f %10.3f %10.3f %10.3f %8llu\n", result.mode.c_str(), result.nsPerCall, result.frame.p50Ms,
+			   result.frame.p95Ms, result.frame.p99Ms, (unsigned long long) result.dropped);
+	}
+
+	if (options.jsonPath)
+	{
+		FILE *fp = fopen(options.jsonPath, "w");
+		if (fp == nullptr)
+		{
+			fprintf(stderr, "open %s fail\n", options.jsonPath);
+			return 1;
+		}
+		LogBenchmark::WriteJson(fp, config, results);
+		fclose(fp);
+	}
+	return 0;
+}
+
+static int RunSimdCheck(const HostOptions &options)
+{
+	std::vector<SimdCheckResult> results;
+	int failures = SimdKernelCheck::Run(results);
+
+	printf("%s\n", ImageKernels::GetSimdName());
+	printf("%-20s %8s %10s\n", "kernel", "cases", "mismatch");
+	for (auto &result : results)
+	{
+		printf("%-20s %8d %10d  %s%s%s\n", result.name.c_str(), result.cases, result.mismatches,
+			   result.passed ? "PASS" : "FAIL", result.passed ? "" : ", first at ", result.firstFailure.c_str());
+	}
+
+	if (options.jsonPath)
+	{
+		FILE *fp = fopen(options.jsonPath, "w");
+		if (fp == nullptr)
+		{
+			fprintf(stderr, "open %s fail\n", options.jsonPath);
+			return 1;
+		}
+		SimdKernelCheck::WriteJson(fp, results);
+		fclose(fp);
+	}
+	printf("%d of %zu failed\n", failures, results.size());
+	return failures > 0 ? 5 : 0;
+}
+
+static int RunLooperBenchmark(const HostOptions &options)
+{
+	std::vector<LooperBenchmarkResult> results;
+	LooperBenchmark::RunAll(results, options.looperMessages);
+
+	printf("%-10s %10s %14s %12s %12s %12s\n", "producers", "messages", "msg/s", "p50 us", "p99 us", "max us");
+	for (auto &result : results)
+	{
+		printf("%-10d %10d %14.0f %12.2f %12.2f %12.2f\n", result.producerCount, result.messageCount, result.throughput,
+			   result.latencyP50Ns / 1e3, result.latencyP99Ns / 1e3, result.latencyMaxNs / 1e3);
+	}
+	return 0;
+}
+
+static void PrintProfileReport()
+{
+	std::vector<ProfileScopeReport> reports;
+	FrameProfiler::GetInstance()->GetReport(reports);
+	for (auto &report : reports)
+	{
+		printf("  %-48s cpu p50=%.3fms p95=%.3fms", report.path.c_str(), report.cpuP50Ns / 1e6, report.cpuP95Ns / 1e6);
+		if (report.gpuSampleCount > 0)
+		{
+			printf(" | gpu p50=%.3fms p95=%.3fms", report.gpuP50Ns / 1e6, report.gpuP95Ns / 1e6);
+		}
+		printf("\n");
+	}
+}
+
+int main(int argc, char **argv)
+{
+	HostOptions options;
+	int ret = ParseArgs(argc, argv, options);
+	if (ret != 0)
+	{
+		if (ret < 0) PrintUsage(argv[0]);
+		return ret < 0 ? 1 : 0;
+	}
+
+	// 日志 I/O 会显著干扰计时，默认静默
+	HostLogLevel() = options.verbose ? ANDROID_LOG_VERBOSE : ANDROID_LOG_SILENT;
+	AsyncLogger::SetLevel(HostLogLevel());
+	if (options.threadCount > 0) ThreadPool::GetInstance()->SetThreadCount(options.threadCount);
+
+	if (options.compareBasePath)
+	{
+		int regressions = SampleBenchmark::Compare(options.compareBasePath, options.compareHeadPath,
+												   options.compareMetric, options.regressionPercent);
+		if (regressions < 0) return 1;
+		printf("%d regression(s) over %.1f%%\n", regressions, options.regressionPercent);
+		return regressions > 0 ? 2 : 0;
+	}
+
+	if (options.simdCheck)
+	{
+		ret = RunSimdCheck(options);
+		AsyncLogger::DestroyInstance();
+		return ret;
+	}
+
+	if (options.looperBenchmark)
+	{
+		ret = RunLooperBenchmark(options);
+		AsyncLogger::DestroyInstance();
+		return ret;
+	}
+
+	EglCore eglCore(nullptr, FLAG_TRY_GLES3);
+	if (eglCore.getEGLContext() == EGL_NO_CONTEXT)
+	{
+		fprintf(stderr, "create EGL context fail, Mesa surfaceless EGL is required\n");
+		return 1;
+	}
+	OffscreenSurface surface(&eglCore, options.surfaceWidth, options.surfaceHeight);
+	surface.makeCurrent();
+	printf("renderer: %s, %s\n", glGetString(GL_RENDERER), glGetString(GL_VERSION));
+
+	if (options.programCacheDir)
+	{
+		ProgramBinaryCache::SetCacheDir(options.programCacheDir);
+		ProgramBinaryCache::SetEnabled(true);
+	}
+	else
+	{
+		ProgramBinaryCache::SetEnabled(false);
+	}
+
+	NativeImage image;
+	if (LoadTestImage(options, image) != 0)
+	{
+		NativeImageUtil::FreeNativeImage(&image);
+		return 1;
+	}
+
+	if (options.benchmark || options.yuvSuite || options.cpuConvertSuite || options.logBenchmark)
+	{
+		// 基准模式不经过 MyGLRenderContext，关闭逐帧统计避免额外的查询对象
+		FrameProfiler::GetInstance()->SetEnabled(false);
+		if (options.logBenchmark) ret = RunLogBenchmark(options, &image);
+		else if (options.cpuConvertSuite) ret = RunCpuConvertSuite(options, &image);
+		else ret = options.yuvSuite ? RunYuvSuite(options, &image) : RunBenchmark(options, &image);
+		FrameProfiler::DestroyInstance();
+		ThreadPool::DestroyInstance();
+		AsyncLogger::DestroyInstance();
+		NativeImageUtil::FreeNativeImage(&image);
+		return ret;
+	}
+
+	// 与 MyGLSurfaceView 的调用顺序一致
+	int sampleType = options.sampleTypes.empty() ? SAMPLE_TYPE_KEY_TRIANGLE : options.sampleTypes[0];
+	MyGLRenderContext *pContext = MyGLRenderContext::GetInstance();
+	FrameProfiler::GetInstance()->SetEnabled(options.profile);
+	pContext->SetParamsInt(SAMPLE_TYPE, sampleType, 0);
+	pContext->SetImageData(&image);
+	pContext->OnSurfaceCreated();
+	pContext->OnSurfaceChanged(options.surfaceWidth, options.surfaceHeight);
+
+	for (int i = 0; i < options.warmupFrames; ++i)
+	{
+		pContext->OnDrawFrame();
+	}
+	glFinish();
+
+	if (options.tracePath) TraceRecorder::Start();
+	if (options.profile) FrameProfiler::GetInstance()->Reset();
+
+	// 每帧 glFinish，统计的是 CPU 提交加软件光栅化的完整耗时
+	std::vector<int64_t> frameNs;
+	frameNs.reserve(options.frames);
+	for (int i = 0; i < options.frames; ++i)
+	{
+		int64_t begin = GetSysCurrentTimeNs();
+		pContext->OnDrawFrame();
+		surface.swapBuffers();
+		glFinish();
+		frameNs.push_back(GetSysCurrentTimeNs() - begin);
+	}
+
+	if (options.tracePath)
+	{
+		TraceRecorder::Stop();
+		TraceRecorder::Flush(options.tracePath);
+	}
+
+	const SampleRegistryEntry *pEntry = SampleRegistry::Find(sampleType);
+	FrameTimeStats stats;
+	stats.Compute(frameNs);
+	PrintFrameStats(pEntry ? pEntry->name : "UnknownSample", "frame", stats);
+	if (options.profile) PrintProfileReport();
+
+	// MyGLRenderContext::DestroyInstance 会一并销毁 AsyncLogger
+	MyGLRenderContext::DestroyInstance();
+	NativeImageUtil::FreeNativeImage(&image);
+	return 0;
+}
@@ -0,0 +1,236 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "SampleBenchmark.h"
+#include <algorithm>
+#include <map>
+#include <string.h>
+#include <EGL/egl.h>
+#include <GLES3/gl3.h>
+#include <GLES2/gl2ext.h>
+#include "SampleRegistry.h"
+#include "LogUtil.h"
+
+#ifndef GL_TIME_ELAPSED_EXT
+#define GL_TIME_ELAPSED_EXT 0x88BF
+#endif
+#ifndef GL_GPU_DISJOINT_EXT
+#define GL_GPU_DISJOINT_EXT 0x8FBB
+#endif
+
+typedef void (GL_APIENTRYP PFN_GL_GET_QUERY_OBJECT_UI64V_EXT)(GLuint id, GLenum pname, GLuint64 *params);
+
+void FrameTimeStats::Compute(std::vector<int64_t> valuesNs)
+{
+	*this = FrameTimeStats();
+	count = (int) valuesNs.size();
+	if (count == 0) return;
+
+	std::sort(valuesNs.begin(), valuesNs.end());
+	double total = 0;
+	for (int64_t ns : valuesNs) total += ns;
+	minMs = valuesNs.front() / 1e6;
+	meanMs = total / count / 1e6;
+	p50Ms = valuesNs[count / 2] / 1e6;
+	p90Ms = valuesNs[std::min(count - 1, count * 90 / 100)] / 1e6;
+	p95Ms = valuesNs[std::min(count - 1, count * 95 / 100)] / 1e6;
+	p99Ms = valuesNs[std::min(count - 1, count * 99 / 100)] / 1e6;
+	maxMs = valuesNs.back() / 1e6;
+}
+
+int SampleBenchmark::Run(const BenchmarkConfig &config, BenchmarkResult &result)
+{
+	const SampleRegistryEntry *pEntry = SampleRegistry::Find(config.sampleType);
+	GLSampleBase *pSample = SampleRegistry::CreateSample(config.sampleType);
+	if (pEntry == nullptr || pSample == nullptr)
+	{
+		LOGCATE("SampleBenchmark::Run unknown sample type=%d", config.sampleType);
+		return -1;
+	}
+	result = BenchmarkResult();
+	result.sampleType = config.sampleType;
+	result.name = pEntry->name;
+
+	const char *pExtensions = (const char *) glGetString(GL_EXTENSIONS);
+	PFN_GL_GET_QUERY_OBJECT_UI64V_EXT getQueryObjectui64v = nullptr;
+	if (pExtensions && strstr(pExtensions, "GL_EXT_disjoint_timer_query"))
+	{
+		getQueryObjectui64v = (PFN_GL_GET_QUERY_OBJECT_UI64V_EXT) eglGetProcAddress("glGetQueryObjectui64vEXT");
+	}
+	GLuint query = GL_NONE;
+	if (getQueryObjectui64v) glGenQueries(1, &query);
+
+	if (config.pImage) pSample->LoadImage(config.pImage);
+	glViewport(0, 0, config.width, config.height);
+
+	std::vector<int64_t> cpuNs, gpuNs, frameNs;
+	cpuNs.reserve(config.frames);
+	gpuNs.reserve(config.frames);
+	frameNs.reserve(config.frames);
+
+	int totalFrames = config.warmupFrames + config.frames;
+	for (int i = 0; i < totalFrames; ++i)
+	{
+		bool measured = i >= config.warmupFrames;
+		GLint disjoint = 0;
+		if (query)
+		{
+			// 读取并清除 disjoint 标志
+			glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+			glBeginQuery(GL_TIME_ELAPSED_EXT, query);
+		}
+
+		// 与 MyGLRenderContext::OnDrawFrame 一致：每帧清屏后调用 Init() 和 Draw()
+		int64_t begin = GetSysCurrentTimeNs();
+		glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
+		pSample->Init();
+		if (i == 0) result.initMs = (GetSysCurrentTimeNs() - begin) / 1e6;
+		pSample->Draw(config.width, config.height);
+		int64_t submitted = GetSysCurrentTimeNs();
+
+		if (query) glEndQuery(GL_TIME_ELAPSED_EXT);
+		glFinish();
+		int64_t finished = GetSysCurrentTimeNs();
+
+		if (!measured) continue;
+		cpuNs.push_back(submitted - begin);
+		frameNs.push_back(finished - begin);
+		if (query)
+		{
+			GLuint64 elapsed = 0;
+			getQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+			glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+			if (!disjoint) gpuNs.push_back((int64_t) elapsed);
+		}
+	}
+
+	if (query) glDeleteQueries(1, &query);
+
+	NativeImage outputImage;
+	if (config.pOutput && pSample->GetOutputImage(&outputImage))
+	{
+		config.pOutput->width = outputImage.width;
+		config.pOutput->height = outputImage.height;
+		config.pOutput->format = outputImage.format;
+		NativeImageUtil::CopyNativeImage(&outputImage, config.pOutput);
+	}
+	pSample->Destroy();
+	delete pSample;
+
+	GLenum error = glGetError();
+	if (error != GL_NO_ERROR)
+	{
+		LOGCATE("SampleBenchmark::Run %s left glGetError=0x%x", result.name.c_str(), error);
+	}
+
+	result.cpu.Compute(cpuNs);
+	result.gpu.Compute(gpuNs);
+	result.frame.Compute(frameNs);
+	return 0;
+}
+
+static void WriteStats(FILE *fp, const char *pKey, const FrameTimeStats &stats)
+{
+	if (stats.count == 0)
+	{
+		fprintf(fp, "\"%s\":null", pKey);
+		return;
+	}
+	fprintf(fp, "\"%s\":{\"count\":%d,\"min\":%.4f,\"mean\":%.4f,\"p50\":%.4f,\"p90\":%.4f,\"p95\":%.4f,\"p99\":%.4f,\"max\":%.4f}",
+			pKey, stats.count, stats.minMs, stats.meanMs, stats.p50Ms, stats.p90Ms, stats.p95Ms, stats.p99Ms, stats.maxMs);
+}
+
+void SampleBenchmark::WriteJson(FILE *fp, const BenchmarkConfig &config, const std::vector<BenchmarkResult> &results)
+{
+	fprintf(fp, "{\n\"renderer\":\"%s\",\n\"version\":\"%s\",\n", glGetString(GL_RENDERER), glGetString(GL_VERSION));
+	fprintf(fp, "\"unit\":\"ms\",\n\"width\":%d,\n\"height\":%d,\n\"warmupFrames\":%d,\n\"frames\":%d,\n\"samples\":[\n",
+			config.width, config.height, config.warmupFrames, config.frames);
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const BenchmarkResult &result = results[i];
+		fprintf(fp, "{\"name\":\"%s\",\"type\":%d,\"initMs\":%.4f,", result.name.c_str(), result.sampleType, result.initMs);
+		WriteStats(fp, "cpu", result.cpu);
+		fputc(',', fp);
+		WriteStats(fp, "gpu", result.gpu);
+		fputc(',', fp);
+		WriteStats(fp, "frame", result.frame);
+		fprintf(fp, "}%s\n", i + 1 < results.size() ? "," : "");
+	}
+	fprintf(fp, "]\n}\n");
+}
+
+static bool ReadStats(const char *pLine, const char *pKey, FrameTimeStats &stats)
+{
+	char pattern[32];
+	snprintf(pattern, sizeof(pattern), "\"%s\":{", pKey);
+	const char *pObject = strstr(pLine, pattern);
+	if (pObject == nullptr) return false;
+	return sscanf(pObject + strlen(pattern),
+				  "\"count\":%d,\"min\":%lf,\"mean\":%lf,\"p50\":%lf,\"p90\":%lf,\"p95\":%lf,\"p99\":%lf,\"max\":%lf",
+				  &stats.count, &stats.minMs, &stats.meanMs, &stats.p50Ms, &stats.p90Ms, &stats.p95Ms, &stats.p99Ms, &stats.maxMs) == 8;
+}
+
+int SampleBenchmark::ReadJson(const char *path, std::vector<BenchmarkResult> &results)
+{
+	FILE *fp = fopen(path, "r");
+	if (fp == nullptr)
+	{
+		LOGCATE("SampleBenchmark::ReadJson open %s fail", path);
+		return -1;
+	}
+
+	results.clear();
+	char line[2048];
+	while (fgets(line, sizeof(line), fp))
+	{
+		char name[128] = {0};
+		BenchmarkResult result;
+		if (sscanf(line, "{\"name\":\"%127[^\"]\",\"type\":%d,\"initMs\":%lf", name, &result.sampleType, &result.initMs) != 3) continue;
+		result.name = name;
+		ReadStats(line, "cpu", result.cpu);
+		ReadStats(line, "gpu", result.gpu);
+		ReadStats(line, "frame", result.frame);
+		results.push_back(result);
+	}
+	fclose(fp);
+	return 0;
+}
+
+static const FrameTimeStats &SelectMetric(const BenchmarkResult &result, const char *metric)
+{
+	if (strcmp(metric, "cpu") == 0) return result.cpu;
+	if (strcmp(metric, "gpu") == 0) return result.gpu;
+	return result.frame;
+}
+
+int SampleBenchmark::Compare(const char *basePath, const char *headPath, const char *metric, double thresholdPercent)
+{
+	std::vector<BenchmarkResult> baseResults, headResults;
+	if (ReadJson(basePath, baseResults) != 0 || ReadJson(headPath, headResults) != 0) return -1;
+
+	std::map<std::string, const BenchmarkResult *> baseByName;
+	for (auto &result : baseResults) baseByName[result.name] = &result;
+
+	int regressions = 0;
+	printf("%-32s %12s %12s %9s  (%s p50, ms)\n", "sample", "base", "head", "delta", metric);
+	for (auto &head : headResults)
+	{
+		auto iter = baseByName.find(head.name);
+		if (iter == baseByName.end())
+		{
+			printf("%-32s %12s %12.3f %9s\n", head.name.c_str(), "-", SelectMetric(head, metric).p50Ms, "new");
+			continue;
+		}
+		const FrameTimeStats &baseStats = SelectMetric(*iter->second, metric);
+		const FrameTimeStats &headStats = SelectMetric(head, metric);
+		if (baseStats.count == 0 || headStats.count == 0 || baseStats.p50Ms <= 0) continue;
+
+		double delta = (headStats.p50Ms - baseStats.p50Ms) * 100.0 / baseStats.p50Ms;
+		bool regressed = delta > thresholdPercent;
+		if (regressed) regressions++;
+		printf("%-32s %12.3f %12.3f %+8.1f%%%s\n", head.name.c_str(), baseStats.p50Ms, headStats.p50Ms, delta,
+			   regressed ? "  REGRESSION" : "");
+	}
+	return regressions;
+}
@@ -0,0 +1,72 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_SAMPLEBENCHMARK_H
+#define NDK_OPENGLES_3_0_SAMPLEBENCHMARK_H
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "stdint.h"
+#include "ImageDef.h"
+
+// 比较两份结果时，p50 变慢超过该百分比视为回归
+#define BENCHMARK_DEFAULT_REGRESSION_PERCENT 10.0
+
+struct FrameTimeStats
+{
+	int count = 0;
+	double minMs = 0;
+	double meanMs = 0;
+	double p50Ms = 0;
+	double p90Ms = 0;
+	double p95Ms = 0;
+	double p99Ms = 0;
+	double maxMs = 0;
+
+	void Compute(std::vector<int64_t> valuesNs);
+};
+
+struct BenchmarkConfig
+{
+	int sampleType;
+	int warmupFrames;
+	int frames;
+	int width;
+	int height;
+	NativeImage *pImage; // 所有样例使用同一张输入图，保证结果可比
+	NativeImage *pOutput = nullptr; // 非空时在最后一帧后拷贝 GetOutputImage() 的结果，内存由调用方释放
+};
+
+struct BenchmarkResult
+{
+	int sampleType = 0;
+	std::string name;
+	double initMs = 0;     // 首次 Init() 的 CPU 耗时，包含着色器编译
+	FrameTimeStats cpu;    // Init() + Draw() 的 CPU 提交耗时
+	FrameTimeStats gpu;    // GL_TIME_ELAPSED_EXT 查询的 GPU 执行耗时，不支持时 count 为 0
+	FrameTimeStats frame;  // 提交加 glFinish 的完整帧耗时
+};
+
+/**
+ * 在当前 EGL 上下文的默认 framebuffer 上离屏跑单个样例：
+ * 直接通过 SampleRegistry 创建 GLSampleBase，不经过 MyGLRenderContext 的缓存和预热，
+ * 预热 warmupFrames 帧后统计 frames 帧的 CPU / GPU / 整帧耗时分布。
+ */
+class SampleBenchmark
+{
+public:
+	// 调用前需在当前线程 makeCurrent，成功返回 0
+	static int Run(const BenchmarkConfig &config, BenchmarkResult &result);
+
+	static void WriteJson(FILE *fp, const BenchmarkConfig &config, const std::vector<BenchmarkResult> &results);
+
+	// 只解析 WriteJson 的输出，每个样例一行
+	static int ReadJson(const char *path, std::vector<BenchmarkResult> &results);
+
+	// metric 为 "cpu"、"gpu" 或 "frame"，比较 p50，返回回归的样例数，出错返回 -1
+	static int Compare(const char *basePath, const char *headPath, const char *metric, double thresholdPercent);
+};
+
+#endif //NDK_OPENGLES_3_0_SAMPLEBENCHMARK_H
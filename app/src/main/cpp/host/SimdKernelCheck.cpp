@@ -0,0 +1,252 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "SimdKernelCheck.h"
+#include <string.h>
+#include <functional>
+#include "ImageDef.h"
+#include "ImageKernels.h"
+
+// 覆盖不足一个向量、整向量和向量加尾部的长度，以及两个常见的奇数行宽
+static const int s_KernelCounts[] = {
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 23, 24, 25, 31, 32, 33, 47, 48, 49, 63, 64, 65, 127, 128, 129, 1279, 1921,
+};
+
+// 输入输出起始地址相对对齐内存的元素偏移
+#define SIMD_CHECK_MAX_OFFSET 4
+
+static const int s_ImageWidths[] = {1, 2, 3, 15, 16, 17, 31, 33, 63, 65, 641, 1279};
+static const int s_ImageHeights[] = {2, 3, 6};
+
+// 两边输出都写到 offset 之后，尾部留哨兵字节，比较整块缓冲区
+typedef std::function<void(bool simd, int count, int offset, std::vector<uint8_t> &output)> KernelRunner;
+
+static uint32_t NextRandom(uint32_t &state)
+{
+	state = state * 1664525u + 1013904223u;
+	return state >> 8;
+}
+
+template<typename T>
+static std::vector<T> MakeInput(int size, uint32_t mask, uint32_t seed)
+{
+	std::vector<T> input(size);
+	for (int i = 0; i < size; ++i) input[i] = (T) (NextRandom(seed) & mask);
+	return input;
+}
+
+template<typename T>
+static T *PrepareOutput(std::vector<uint8_t> &output, int count, int offset, int channels)
+{
+	output.assign(sizeof(T) * (offset + count) * channels + SIMD_CHECK_GUARD_BYTES, 0xA5);
+	return (T *) output.data() + offset * channels;
+}
+
+static SimdCheckResult CheckKernel(const char *pName, const KernelRunner &runner)
+{
+	SimdCheckResult result;
+	result.name = pName;
+	std::vector<uint8_t> simdOutput, scalarOutput;
+	for (int count : s_KernelCounts)
+	{
+		for (int offset = 0; offset < SIMD_CHECK_MAX_OFFSET; ++offset)
+		{
+			runner(true, count, offset, simdOutput);
+			runner(false, count, offset, scalarOutput);
+			result.cases++;
+			if (simdOutput != scalarOutput)
+			{
+				if (result.mismatches++ == 0)
+				{
+					result.firstFailure = "count=" + std::to_string(count) + " offset=" + std::to_string(offset);
+				}
+			}
+		}
+	}
+	result.passed = result.mismatches == 0;
+	return result;
+}
+
+static KernelRunner MakeShr16To8Runner()
+{
+	return [](bool simd, int count, int offset, std::vector<uint8_t> &output) {
+		std::vector<uint16_t> src = MakeInput<uint16_t>(offset + count, 0xFFFF, (uint32_t) count);
+		uint8_t *pDst = PrepareOutput<uint8_t>(output, count, offset, 1);
+		if (simd) ImageKernels::Shr16To8(src.data() + offset, pDst, count);
+		else ImageKernels::Shr16To8_C(src.data() + offset, pDst, count);
+	};
+}
+
+static KernelRunner MakeShl8To16Runner(int shift)
+{
+	return [shift](bool simd, int count, int offset, std::vector<uint8_t> &output) {
+		std::vector<uint8_t> src = MakeInput<uint8_t>(offset + count, 0xFF, (uint32_t) count);
+		uint16_t *pDst = PrepareOutput<uint16_t>(output, count, offset, 1);
+		if (simd) ImageKernels::Shl8To16(src.data() + offset, pDst, count, shift);
+		else ImageKernels::Shl8To16_C(src.data() + offset, pDst, count, shift);
+	};
+}
+
+static KernelRunner MakeRound16To8Runner(int shift)
+{
+	return [shift](bool simd, int count, int offset, std::vector<uint8_t> &output) {
+		// 全 16bit 范围，覆盖加半数后饱和的情况
+		std::vector<uint16_t> src = MakeInput<uint16_t>(offset + count, 0xFFFF, (uint32_t) count);
+		uint8_t *pDst = PrepareOutput<uint8_t>(output, count, offset, 1);
+		if (simd) ImageKernels::Round16To8(src.data() + offset, pDst, count, shift);
+		else ImageKernels::Round16To8_C(src.data() + offset, pDst, count, shift);
+	};
+}
+
+static KernelRunner MakeRgbaToYuv10Runner()
+{
+	return [](bool simd, int count, int offset, std::vector<uint8_t> &output) {
+		std::vector<uint8_t> src = MakeInput<uint8_t>((offset + count) * 4, 0xFF, (uint32_t) count);
+		// Y、U、V 三段依次放在同一个输出缓冲区中
+		std::vector<uint8_t> planes[3];
+		uint16_t *pPlanes[3];
+		for (int i = 0; i < 3; ++i) pPlanes[i] = PrepareOutput<uint16_t>(planes[i], count, offset, 1);
+		if (simd) ImageKernels::RgbaToYuv10(src.data() + offset * 4, pPlanes[0], pPlanes[1], pPlanes[2], count);
+		else ImageKernels::RgbaToYuv10_C(src.data() + offset * 4, pPlanes[0], pPlanes[1], pPlanes[2], count);
+		output.clear();
+		for (int i = 0; i < 3; ++i) output.insert(output.end(), planes[i].begin(), planes[i].end());
+	};
+}
+
+static KernelRunner MakeYuv10ToRgbaRunner()
+{
+	return [](bool simd, int count, int offset, std::vector<uint8_t> &output) {
+		std::vector<uint16_t> y = MakeInput<uint16_t>(offset + count, 0x3FF, (uint32_t) count);
+		std::vector<uint16_t> u = MakeInput<uint16_t>(offset + count, 0x3FF, (uint32_t) count + 1);
+		std::vector<uint16_t> v = MakeInput<uint16_t>(offset + count, 0x3FF, (uint32_t) count + 2);
+		uint8_t *pDst = PrepareOutput<uint8_t>(output, count, offset, 4);
+		if (simd) ImageKernels::Yuv10ToRgba(y.data() + offset, u.data() + offset, v.data() + offset, pDst, count);
+		else ImageKernels::Yuv10ToRgba_C(y.data() + offset, u.data() + offset, v.data() + offset, pDst, count);
+	};
+}
+
+static size_t GetBufferSize(const NativeImage &image)
+{
+	size_t size = 0;
+	for (int i = 0; i < NativeImageUtil::GetPlaneCount(image.format); ++i)
+	{
+		size += (size_t) NativeImageUtil::GetLineSize(&image, i) * NativeImageUtil::GetPlaneHeight(image.format, image.height, i);
+	}
+	return size;
+}
+
+// padding 为每行在有效字节之外额外的字节数，P010 需保持 2 字节对齐
+static void AllocImage(NativeImage &image, int format, int width, int height, const int padding[2], uint8_t fill)
+{
+	image = NativeImage();
+	image.format = format;
+	image.width = width;
+	image.height = height;
+	for (int i = 0; i < 2; ++i)
+	{
+		image.pLineSize[i] = NativeImageUtil::GetPlaneRowBytes(format, width, i) + padding[i];
+	}
+	NativeImageUtil::AllocNativeImage(&image);
+	if (image.ppPlane[0] != nullptr) memset(image.ppPlane[0], fill, GetBufferSize(image));
+}
+
+static void FillRandom(NativeImage &image, uint32_t seed)
+{
+	size_t size = GetBufferSize(image);
+	for (size_t i = 0; i < size; ++i) image.ppPlane[0][i] = (uint8_t) NextRandom(seed);
+}
+
+// 开启和关闭 SIMD 各转换一次，比较包括行尾填充在内的整块目标内存
+static SimdCheckResult CheckImageConversion(const char *pName, int srcFormat, int dstFormat,
+											int (*convert)(NativeImage *, NativeImage *))
+{
+	static const int kPadding[][2] = {{0, 0}, {6, 10}};
+	static const int kPadding8Bit[][2] = {{0, 0}, {3, 5}};
+	bool simd = ImageKernels::IsSimdEnabled();
+	SimdCheckResult result;
+	result.name = pName;
+	for (int width : s_ImageWidths)
+	{
+		for (int height : s_ImageHeights)
+		{
+			for (int srcPad = 0; srcPad < 2; ++srcPad)
+			{
+				for (int dstPad = 0; dstPad < 2; ++dstPad)
+				{
+					const int *pSrcPadding = srcFormat == IMAGE_FORMAT_P010 ? kPadding[srcPad] : kPadding8Bit[srcPad];
+					const int *pDstPadding = dstFormat == IMAGE_FORMAT_P010 ? kPadding[dstPad] : kPadding8Bit[dstPad];
+					NativeImage src, simdDst, scalarDst;
+					AllocImage(src, srcFormat, width, height, pSrcPadding, 0);
+					AllocImage(simdDst, dstFormat, width, height, pDstPadding, 0x5A);
+					AllocImage(scalarDst, dstFormat, width, height, pDstPadding, 0x5A);
+					FillRandom(src, (uint32_t) (width * 131 + height));
+
+					ImageKernels::SetSimdEnabled(true);
+					int simdRet = convert(&src, &simdDst);
+					ImageKernels::SetSimdEnabled(false);
+					int scalarRet = convert(&src, &scalarDst);
+
+					result.cases++;
+					if (simdRet != 0 || scalarRet != 0
+						|| memcmp(simdDst.ppPlane[0], scalarDst.ppPlane[0], GetBufferSize(simdDst)) != 0)
+					{
+						if (result.mismatches++ == 0)
+						{
+							result.firstFailure = std::to_string(width) + "x" + std::to_string(height)
+												  + " srcLineSize=" + std::to_string(src.pLineSize[0])
+												  + " dstLineSize=" + std::to_string(simdDst.pLineSize[0]);
+						}
+					}
+					NativeImageUtil::FreeNativeImage(&src);
+					NativeImageUtil::FreeNativeImage(&simdDst);
+					NativeImageUtil::FreeNativeImage(&scalarDst);
+				}
+			}
+		}
+	}
+	ImageKernels::SetSimdEnabled(simd);
+	result.passed = result.mismatches == 0;
+	return result;
+}
+
+int SimdKernelCheck::Run(std::vector<SimdCheckResult> &results)
+{
+	bool simd = ImageKernels::IsSimdEnabled();
+	ImageKernels::SetSimdEnabled(true);
+	results.clear();
+	results.push_back(CheckKernel("Shr16To8", MakeShr16To8Runner()));
+	results.push_back(CheckKernel("Shl8To16 shift=2", MakeShl8To16Runner(2)));
+	results.push_back(CheckKernel("Shl8To16 shift=6", MakeShl8To16Runner(6)));
+	results.push_back(CheckKernel("Shl8To16 shift=8", MakeShl8To16Runner(8)));
+	results.push_back(CheckKernel("Round16To8 shift=1", MakeRound16To8Runner(1)));
+	results.push_back(CheckKernel("Round16To8 shift=2", MakeRound16To8Runner(2)));
+	results.push_back(CheckKernel("Round16To8 shift=8", MakeRound16To8Runner(8)));
+	results.push_back(CheckKernel("RgbaToYuv10", MakeRgbaToYuv10Runner()));
+	results.push_back(CheckKernel("Yuv10ToRgba", MakeYuv10ToRgbaRunner()));
+	results.push_back(CheckImageConversion("ConvertP010toNV21", IMAGE_FORMAT_P010, IMAGE_FORMAT_NV21,
+										   NativeImageUtil::ConvertP010toNV21));
+	results.push_back(CheckImageConversion("ConvertNV21toP010", IMAGE_FORMAT_NV21, IMAGE_FORMAT_P010,
+										   NativeImageUtil::ConvertNV21toP010));
+	ImageKernels::SetSimdEnabled(simd);
+
+	int failures = 0;
+	for (auto &result : results)
+	{
+		if (!result.passed) failures++;
+	}
+	return failures;
+}
+
+void SimdKernelCheck::WriteJson(FILE *fp, const std::vector<SimdCheckResult> &results)
+{
+	fprintf(fp, "{\n\"simd\":\"%s\",\n\"kernels\":[\n", ImageKernels::GetSimdName());
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const SimdCheckResult &result = results[i];
+		fprintf(fp, "{\"name\":\"%s\",\"cases\":%d,\"mismatches\":%d,\"firstFailure\":\"%s\",\"passed\":%s}%s\n",
+				result.name.c_str(), result.cases, result.mismatches, result.firstFailure.c_str(),
+				result.passed ? "true" : "false", i + 1 < results.size() ? "," : "");
+	}
+	fprintf(fp, "]\n}\n");
+}
@@ -0,0 +1,40 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_SIMDKERNELCHECK_H
+#define NDK_OPENGLES_3_0_SIMDKERNELCHECK_H
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+// 输出缓冲区尾部的哨兵字节数，用于检查内核是否越界写
+#define SIMD_CHECK_GUARD_BYTES 64
+
+struct SimdCheckResult
+{
+	std::string name;
+	int cases = 0;            // 比较的 (长度, 偏移) 或 (尺寸, 行跨度) 组合数
+	int mismatches = 0;       // 与标量输出不一致或写越界的组合数
+	std::string firstFailure; // 第一个不一致组合的描述
+	bool passed = false;
+};
+
+/**
+ * ImageKernels 的 SIMD 与标量实现逐位一致性检查，不需要 GL 上下文：
+ * 1. 每个内核用随机输入覆盖 0 到多个向量宽度的长度、非对齐的起始偏移，比较输出和尾部哨兵；
+ * 2. NativeImageUtil::ConvertP010toNV21 / ConvertNV21toP010 用奇数宽度、带行尾填充的图像，
+ *    分别在开启和关闭 SIMD 时转换，比较包括填充字节在内的整块内存。
+ * CPU 不支持 SIMD 时两边都是标量实现，结果恒为通过。
+ */
+class SimdKernelCheck
+{
+public:
+	// 返回不一致的项数
+	static int Run(std::vector<SimdCheckResult> &results);
+
+	static void WriteJson(FILE *fp, const std::vector<SimdCheckResult> &results);
+};
+
+#endif //NDK_OPENGLES_3_0_SIMDKERNELCHECK_H
@@ -0,0 +1,265 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "YuvConversionSuite.h"
+#include <math.h>
+#include <algorithm>
+#include <GLES3/gl3.h>
+#include "GLSampleBase.h"
+#include "SampleRegistry.h"
+#include "ComputeYuvConverter.h"
+#include "LogUtil.h"
+
+// CPU 参考实现计时的重复次数
+#define YUV_SUITE_CPU_ITERATIONS 5
+
+struct YuvConversionCase
+{
+	int sampleType;
+	int format;
+	double minPsnrY;
+	double minPsnrUV;
+};
+
+// llvmpipe 上实测 Y 约 63dB、UV 约 58dB，只有量化舍入误差；采样点偏移半个像素时 Y 会跌到 21dB 左右
+static const YuvConversionCase s_Cases[] = {
+		{SAMPLE_TYPE_KEY_RGB2YUYV, IMAGE_FORMAT_YUYV, 50.0, 45.0},
+		{SAMPLE_TYPE_KEY_RGB2NV21, IMAGE_FORMAT_NV21, 50.0, 45.0},
+		{SAMPLE_TYPE_KEY_RGB2I420, IMAGE_FORMAT_I420, 50.0, 45.0},
+		{SAMPLE_TYPE_KEY_RGB2I444, IMAGE_FORMAT_I444, 50.0, 45.0},
+};
+
+static const char *GetFormatName(int format)
+{
+	switch (format)
+	{
+		case IMAGE_FORMAT_YUYV: return IMAGE_FORMAT_YUYV_EXT;
+		case IMAGE_FORMAT_NV21: return IMAGE_FORMAT_NV21_EXT;
+		case IMAGE_FORMAT_I420: return IMAGE_FORMAT_I420_EXT;
+		case IMAGE_FORMAT_I444: return IMAGE_FORMAT_I444_EXT;
+		default: return "unknown";
+	}
+}
+
+// 色度平面相对亮度平面的下采样倍数
+static void GetChromaShift(int format, int &shiftX, int &shiftY)
+{
+	shiftX = format == IMAGE_FORMAT_I444 ? 0 : 1;
+	shiftY = format == IMAGE_FORMAT_NV21 || format == IMAGE_FORMAT_I420 ? 1 : 0;
+}
+
+static uint8_t ClampToByte(float value)
+{
+	int v = (int) lroundf(value);
+	return (uint8_t) (v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+void YuvConversionSuite::ConvertReference(const NativeImage *pRgba, int format, std::vector<uint8_t> planes[3])
+{
+	int width = pRgba->width, height = pRgba->height;
+	int shiftX, shiftY;
+	GetChromaShift(format, shiftX, shiftY);
+	int chromaW = width >> shiftX, chromaH = height >> shiftY;
+	int lineSize = NativeImageUtil::GetLineSize(pRgba, 0);
+
+	planes[0].resize((size_t) width * height);
+	planes[1].resize((size_t) chromaW * chromaH);
+	planes[2].resize((size_t) chromaW * chromaH);
+
+	// 与 RGB2*Sample 着色器相同的 BT.601 TV range 系数，偏移量换算到 8bit
+	for (int y = 0; y < height; ++y)
+	{
+		const uint8_t *pRow = pRgba->ppPlane[0] + y * lineSize;
+		for (int x = 0; x < width; ++x)
+		{
+			const uint8_t *p = pRow + x * 4;
+			planes[0][y * width + x] = ClampToByte(0.257f * p[0] + 0.504f * p[1] + 0.098f * p[2] + 0.063f * 255);
+		}
+	}
+
+	int blockW = 1 << shiftX, blockH = 1 << shiftY;
+	float scale = 1.0f / (blockW * blockH);
+	for (int cy = 0; cy < chromaH; ++cy)
+	{
+		for (int cx = 0; cx < chromaW; ++cx)
+		{
+			float r = 0, g = 0, b = 0;
+			for (int j = 0; j < blockH; ++j)
+			{
+				const uint8_t *p = pRgba->ppPlane[0] + (cy * blockH + j) * lineSize + cx * blockW * 4;
+				for (int i = 0; i < blockW; ++i, p += 4)
+				{
+					r += p[0];
+					g += p[1];
+					b += p[2];
+				}
+			}
+			r *= scale;
+			g *= scale;
+			b *= scale;
+			planes[1][cy * chromaW + cx] = ClampToByte(-0.148f * r - 0.291f * g + 0.439f * b + 0.502f * 255);
+			planes[2][cy * chromaW + cx] = ClampToByte(0.439f * r - 0.368f * g - 0.071f * b + 0.502f * 255);
+		}
+	}
+}
+
+bool YuvConversionSuite::SplitPlanes(const NativeImage *pYuv, std::vector<uint8_t> planes[3])
+{
+	int width = pYuv->width, height = pYuv->height;
+	int shiftX, shiftY;
+	GetChromaShift(pYuv->format, shiftX, shiftY);
+	int chromaW = width >> shiftX, chromaH = height >> shiftY;
+
+	planes[0].resize((size_t) width * height);
+	planes[1].resize((size_t) chromaW * chromaH);
+	planes[2].resize((size_t) chromaW * chromaH);
+
+	switch (pYuv->format)
+	{
+		case IMAGE_FORMAT_I420:
+		case IMAGE_FORMAT_I444:
+			for (int i = 0; i < 3; ++i)
+			{
+				int planeW = i == 0 ? width : chromaW;
+				int planeH = i == 0 ? height : chromaH;
+				NativeImageUtil::CopyPlane(pYuv->ppPlane[i], NativeImageUtil::GetLineSize(pYuv, i),
+										   planes[i].data(), planeW, planeW, planeH);
+			}
+			return true;
+		case IMAGE_FORMAT_NV21:
+			NativeImageUtil::CopyPlane(pYuv->ppPlane[0], NativeImageUtil::GetLineSize(pYuv, 0),
+									   planes[0].data(), width, width, height);
+			for (int y = 0; y < chromaH; ++y)
+			{
+				const uint8_t *pRow = pYuv->ppPlane[1] + y * NativeImageUtil::GetLineSize(pYuv, 1);
+				for (int x = 0; x < chromaW; ++x)
+				{
+					planes[2][y * chromaW + x] = pRow[x * 2];
+					planes[1][y * chromaW + x] = pRow[x * 2 + 1];
+				}
+			}
+			return true;
+		case IMAGE_FORMAT_YUYV:
+			for (int y = 0; y < height; ++y)
+			{
+				const uint8_t *pRow = pYuv->ppPlane[0] + y * NativeImageUtil::GetLineSize(pYuv, 0);
+				for (int x = 0; x < chromaW; ++x)
+				{
+					planes[0][y * width + x * 2] = pRow[x * 4];
+					planes[1][y * chromaW + x] = pRow[x * 4 + 1];
+					planes[0][y * width + x * 2 + 1] = pRow[x * 4 + 2];
+					planes[2][y * chromaW + x] = pRow[x * 4 + 3];
+				}
+			}
+			return true;
+		default:
+			LOGCATE("YuvConversionSuite::SplitPlanes unsupported format=%d", pYuv->format);
+			return false;
+	}
+}
+
+double YuvConversionSuite::ComputePsnr(const std::vector<uint8_t> &a, const std::vector<uint8_t> &b)
+{
+	if (a.size() != b.size() || a.empty()) return 0;
+	double sum = 0;
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		double diff = (double) a[i] - b[i];
+		sum += diff * diff;
+	}
+	if (sum == 0) return YUV_SUITE_PSNR_IDENTICAL;
+	double mse = sum / a.size();
+	return std::min(YUV_SUITE_PSNR_IDENTICAL, 10.0 * log10(255.0 * 255.0 / mse));
+}
+
+int YuvConversionSuite::Run(const BenchmarkConfig &config, std::vector<YuvConversionResult> &results)
+{
+	const NativeImage *pRgba = config.pImage;
+	if (pRgba == nullptr || pRgba->format != IMAGE_FORMAT_RGBA || pRgba->width % 8 != 0 || pRgba->height % 4 != 0)
+	{
+		LOGCATE("YuvConversionSuite::Run need RGBA input with width %% 8 == 0 and height %% 4 == 0");
+		return -1;
+	}
+
+	GLint major = 0, minor = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &major);
+	glGetIntegerv(GL_MINOR_VERSION, &minor);
+	int backendCount = major * 10 + minor >= 31 ? 2 : 1;
+	int savedBackend = ComputeYuvConverter::GetBackend();
+
+	results.clear();
+	int failures = 0;
+	double megaPixels = (double) pRgba->width * pRgba->height / 1e6;
+	for (int index = 0; index < (int) (sizeof(s_Cases) / sizeof(s_Cases[0])) * backendCount; ++index)
+	{
+		const YuvConversionCase &testCase = s_Cases[index / backendCount];
+		YuvConversionResult result;
+		result.sampleType = testCase.sampleType;
+		result.format = testCase.format;
+		result.backend = index % backendCount == 0 ? YUV_BACKEND_FRAGMENT : YUV_BACKEND_COMPUTE;
+		result.minPsnrY = testCase.minPsnrY;
+		result.minPsnrUV = testCase.minPsnrUV;
+
+		BenchmarkConfig caseConfig = config;
+		caseConfig.sampleType = testCase.sampleType;
+		NativeImage output;
+		caseConfig.pOutput = &output;
+		BenchmarkResult benchmark;
+		ComputeYuvConverter::SetBackend(result.backend);
+		int ret = SampleBenchmark::Run(caseConfig, benchmark);
+		ComputeYuvConverter::SetBackend(savedBackend);
+		if (ret != 0)
+		{
+			NativeImageUtil::FreeNativeImage(&output);
+			return -1;
+		}
+		result.name = benchmark.name;
+		result.frame = benchmark.frame;
+		if (result.frame.p50Ms > 0) result.gpuMpps = megaPixels * 1000.0 / result.frame.p50Ms;
+
+		std::vector<uint8_t> reference[3], actual[3];
+		int64_t begin = GetSysCurrentTimeNs();
+		for (int i = 0; i < YUV_SUITE_CPU_ITERATIONS; ++i)
+		{
+			ConvertReference(pRgba, testCase.format, reference);
+		}
+		double cpuMs = (GetSysCurrentTimeNs() - begin) / 1e6 / YUV_SUITE_CPU_ITERATIONS;
+		if (cpuMs > 0) result.cpuMpps = megaPixels * 1000.0 / cpuMs;
+
+		if (output.format == testCase.format && output.width == pRgba->width && output.height == pRgba->height
+			&& SplitPlanes(&output, actual))
+		{
+			for (int i = 0; i < 3; ++i) result.psnr[i] = ComputePsnr(reference[i], actual[i]);
+			result.passed = result.psnr[0] >= testCase.minPsnrY
+							&& result.psnr[1] >= testCase.minPsnrUV && result.psnr[2] >= testCase.minPsnrUV;
+		}
+		else
+		{
+			LOGCATE("YuvConversionSuite::Run %s has no output image", result.name.c_str());
+		}
+		NativeImageUtil::FreeNativeImage(&output);
+
+		if (!result.passed) failures++;
+		results.push_back(result);
+	}
+	return failures;
+}
+
+void YuvConversionSuite::WriteJson(FILE *fp, const BenchmarkConfig &config, const std::vector<YuvConversionResult> &results)
+{
+	fprintf(fp, "{\n\"renderer\":\"%s\",\n\"version\":\"%s\",\n", glGetString(GL_RENDERER), glGetString(GL_VERSION));
+	fprintf(fp, "\"width\":%d,\n\"height\":%d,\n\"warmupFrames\":%d,\n\"frames\":%d,\n\"samples\":[\n",
+			config.pImage->width, config.pImage->height, config.warmupFrames, config.frames);
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const YuvConversionResult &result = results[i];
+		fprintf(fp, "{\"name\":\"%s\",\"type\":%d,\"format\":\"%s\",\"backend\":\"%s\",\"psnrY\":%.2f,\"psnrU\":%.2f,\"psnrV\":%.2f,"
+					"\"minPsnrY\":%.2f,\"minPsnrUV\":%.2f,\"frameP50Ms\":%.4f,\"gpuMpps\":%.2f,\"cpuMpps\":%.2f,\"passed\":%s}%s\n",
+				result.name.c_str(), result.sampleType, GetFormatName(result.format), ComputeYuvConverter::GetBackendName(result.backend),
+				result.psnr[0], result.psnr[1], result.psnr[2], result.minPsnrY, result.minPsnrUV,
+				result.frame.p50Ms, result.gpuMpps, result.cpuMpps, result.passed ? "true" : "false",
+				i + 1 < results.size() ? "," : "");
+	}
+	fprintf(fp, "]\n}\n");
+}
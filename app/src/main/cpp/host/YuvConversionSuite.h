@@ -0,0 +1,56 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_YUVCONVERSIONSUITE_H
+#define NDK_OPENGLES_3_0_YUVCONVERSIONSUITE_H
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "ImageDef.h"
+#include "SampleBenchmark.h"
+
+// 两个平面完全一致时 PSNR 为无穷大，按该值记录
+#define YUV_SUITE_PSNR_IDENTICAL 99.0
+
+struct YuvConversionResult
+{
+	int sampleType = 0;
+	std::string name;
+	int format = 0;
+	int backend = 0;          // YUV_BACKEND_*
+	double psnr[3] = {0};     // Y、U、V 平面相对 CPU 参考实现的 PSNR，单位 dB
+	double minPsnrY = 0;      // 断言下限
+	double minPsnrUV = 0;
+	double gpuMpps = 0;       // 着色器转换加回读的吞吐，按整帧 p50 计算
+	double cpuMpps = 0;       // CPU 参考实现的吞吐
+	FrameTimeStats frame;
+	bool passed = false;
+};
+
+/**
+ * RGB2YUYV / RGB2NV21 / RGB2I420 / RGB2I444 四个样例的回归套件：
+ * 在软件 EGL 上跑完基准后取出样例最后一帧回读的 YUV 结果，
+ * 与 CPU 上按相同 BT.601 系数的参考转换逐平面比较 PSNR，并记录各路径每秒处理的百万像素数。
+ * 每个样例分别用片段着色器和计算着色器后端各跑一遍，上下文不支持 GLES 3.1 时只跑片段着色器。
+ */
+class YuvConversionSuite
+{
+public:
+	// config.pImage 为 RGBA 输入图，宽需为 8 的倍数、高需为 4 的倍数，忽略 config.sampleType
+	// 返回未通过的样例数，出错返回 -1
+	static int Run(const BenchmarkConfig &config, std::vector<YuvConversionResult> &results);
+
+	static void WriteJson(FILE *fp, const BenchmarkConfig &config, const std::vector<YuvConversionResult> &results);
+
+	// 按 format 的色度采样把 RGBA 转换为 Y、U、V 三个独立平面，色度取对应像素块的均值
+	static void ConvertReference(const NativeImage *pRgba, int format, std::vector<uint8_t> planes[3]);
+
+	// 把 YUV 图像拆成 Y、U、V 三个独立平面，布局与 ConvertReference 一致
+	static bool SplitPlanes(const NativeImage *pYuv, std::vector<uint8_t> planes[3]);
+
+	static double ComputePsnr(const std::vector<uint8_t> &a, const std::vector<uint8_t> &b);
+};
+
+#endif //NDK_OPENGLES_3_0_YUVCONVERSIONSUITE_H
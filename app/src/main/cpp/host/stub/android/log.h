@@ -0,0 +1,57 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_HOST_ANDROID_LOG_H
+#define NDK_OPENGLES_3_0_HOST_ANDROID_LOG_H
+
+// 主机构建替代 NDK 的 android/log.h，日志输出到 stderr
+
+#include <stdarg.h>
+#include <stdio.h>
+
+typedef enum android_LogPriority
+{
+	ANDROID_LOG_UNKNOWN = 0,
+	ANDROID_LOG_DEFAULT,
+	ANDROID_LOG_VERBOSE,
+	ANDROID_LOG_DEBUG,
+	ANDROID_LOG_INFO,
+	ANDROID_LOG_WARN,
+	ANDROID_LOG_ERROR,
+	ANDROID_LOG_FATAL,
+	ANDROID_LOG_SILENT,
+} android_LogPriority;
+
+// 低于该优先级的日志被丢弃，跑基准时设为 ANDROID_LOG_SILENT 避免 I/O 干扰计时
+inline int &HostLogLevel()
+{
+	static int s_Level = ANDROID_LOG_VERBOSE;
+	return s_Level;
+}
+
+static inline int __android_log_vprint(int prio, const char *tag, const char *fmt, va_list args)
+{
+	if (prio < HostLogLevel()) return 0;
+	static const char kPriorityChars[] = "??VDIWEF";
+	fprintf(stderr, "%c/%s: ", prio < ANDROID_LOG_SILENT ? kPriorityChars[prio] : '?', tag);
+	int ret = vfprintf(stderr, fmt, args);
+	fputc('\n', stderr);
+	return ret;
+}
+
+static inline int __android_log_print(int prio, const char *tag, const char *fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	int ret = __android_log_vprint(prio, tag, fmt, args);
+	va_end(args);
+	return ret;
+}
+
+static inline int __android_log_write(int prio, const char *tag, const char *text)
+{
+	return __android_log_print(prio, tag, "%s", text);
+}
+
+#endif //NDK_OPENGLES_3_0_HOST_ANDROID_LOG_H
@@ -0,0 +1,16 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_HOST_ANDROID_NATIVE_WINDOW_H
+#define NDK_OPENGLES_3_0_HOST_ANDROID_NATIVE_WINDOW_H
+
+// 主机构建没有窗口系统，只保留类型声明，渲染统一走 pbuffer 离屏 surface
+
+typedef struct ANativeWindow ANativeWindow;
+
+static inline void ANativeWindow_acquire(ANativeWindow *window) {}
+
+static inline void ANativeWindow_release(ANativeWindow *window) {}
+
+#endif //NDK_OPENGLES_3_0_HOST_ANDROID_NATIVE_WINDOW_H
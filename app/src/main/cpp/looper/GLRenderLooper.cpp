@@ -8,37 +8,50 @@
 
 #include <GLUtils.h>
 #include "GLRenderLooper.h"
+#include "TraceRecorder.h"
+#include <string.h>
 mutex GLRenderLooper::m_Mutex;
 GLRenderLooper* GLRenderLooper::m_Instance = nullptr;
 
 GLRenderLooper::~GLRenderLooper() {
-
+    // 在派生类析构前退出消息循环，保证已投递的 MSG_SurfaceDestroyed 由本类处理
+    quit();
 }
 
 GLRenderLooper::GLRenderLooper() {
-
+    memset(m_Frames, 0, sizeof(m_Frames));
 }
 
 void GLRenderLooper::handleMessage(LooperMessage *msg) {
     Looper::handleMessage(msg);
     switch (msg->what) {
         case MSG_SurfaceCreated: {
-            LOGCATE("GLRenderLooper::handleMessage MSG_SurfaceCreated");
+            LOGCATV("GLRenderLooper::handleMessage MSG_SurfaceCreated");
+            TRACE_SCOPE("GLRenderLooper::OnSurfaceCreated");
             m_GLEnv = (GLEnv *)msg->obj;
             OnSurfaceCreated();
         }
             break;
         case MSG_SurfaceChanged:
-            LOGCATE("GLRenderLooper::handleMessage MSG_SurfaceChanged");
-            OnSurfaceChanged(msg->arg1, msg->arg2);
+            LOGCATV("GLRenderLooper::handleMessage MSG_SurfaceChanged");
+            {
+                TRACE_SCOPE("GLRenderLooper::OnSurfaceChanged");
+                OnSurfaceChanged(msg->arg1, msg->arg2);
+            }
             break;
         case MSG_DrawFrame:
-            LOGCATE("GLRenderLooper::handleMessage MSG_DrawFrame");
-            OnDrawFrame();
+            LOGCATV("GLRenderLooper::handleMessage MSG_DrawFrame");
+            {
+                TRACE_SCOPE("GLRenderLooper::OnDrawFrame");
+                OnDrawFrame();
+            }
             break;
         case MSG_SurfaceDestroyed:
-            LOGCATE("GLRenderLooper::handleMessage MSG_SurfaceDestroyed");
-            OnSurfaceDestroyed();
+            LOGCATV("GLRenderLooper::handleMessage MSG_SurfaceDestroyed");
+            {
+                TRACE_SCOPE("GLRenderLooper::OnSurfaceDestroyed");
+                OnSurfaceDestroyed();
+            }
             break;
         default:
             break;
@@ -70,6 +83,7 @@ void GLRenderLooper::ReleaseInstance() {
 
 void GLRenderLooper::OnSurfaceCreated() {
     LOGCATE("GLRenderLooper::OnSurfaceCreated");
+    TRACE_THREAD_NAME("GLRenderLooper");
     m_EglCore = new EglCore(m_GLEnv->sharedCtx, FLAG_RECORDABLE);
     SizeF imgSizeF = m_GLEnv->imgSize;
     m_OffscreenSurface = new OffscreenSurface(m_EglCore, imgSizeF.width, imgSizeF.height);
@@ -92,21 +106,78 @@ void GLRenderLooper::OnSurfaceCreated() {
     GO_CHECK_GL_ERROR();
     glBindVertexArray(GL_NONE);
 
-    if (!CreateFrameBufferObj())
-    {
-        LOGCATE("GLRenderLooper::OnSurfaceCreated CreateFrameBufferObj fail");
+    int frameCount = m_GLEnv->inFlightFrames > 1 ? m_GLEnv->inFlightFrames : 1;
+    frameCount = frameCount > RENDER_LOOPER_MAX_IN_FLIGHT ? RENDER_LOOPER_MAX_IN_FLIGHT : frameCount;
+    unique_lock<mutex> lock(m_FrameMutex);
+    for (int i = 0; i < frameCount; ++i) {
+        memset(&m_Frames[i], 0, sizeof(RenderFrame));
+        if (!CreateFrameBufferObj(m_Frames[i]))
+        {
+            LOGCATE("GLRenderLooper::OnSurfaceCreated CreateFrameBufferObj fail");
+        }
     }
+    m_FrameCount = frameCount;
+    m_SurfaceDestroyed = false;
+    LOGCATE("GLRenderLooper::OnSurfaceCreated inFlightFrames=%d", m_FrameCount);
 }
 
 void GLRenderLooper::OnSurfaceChanged(int w, int h) {
     LOGCATE("GLRenderLooper::OnSurfaceChanged [w,h]=[%d, %d]", w, h);
 }
 
+int GLRenderLooper::AcquireFreeFrame() {
+    unique_lock<mutex> lock(m_FrameMutex);
+    int candidate = -1;
+    for (int i = 0; i < m_FrameCount; ++i) {
+        if (m_Frames[i].state == FRAME_FREE) {
+            candidate = i;
+            break;
+        }
+    }
+
+    if (candidate < 0) {
+        // 没有空闲帧时复用最旧的、还未被消费者取走的帧，保证显示的是最新内容
+        for (int i = 0; i < m_FrameCount; ++i) {
+            if (m_Frames[i].state == FRAME_READY && (candidate < 0 || m_Frames[i].sequence < m_Frames[candidate].sequence)) {
+                candidate = i;
+            }
+        }
+    }
+
+    if (candidate >= 0) {
+        m_Frames[candidate].state = FRAME_RENDERING;
+    }
+    return candidate;
+}
+
 void GLRenderLooper::OnDrawFrame() {
-    LOGCATE("GLRenderLooper::OnDrawFrame");
+    LOGCATV("GLRenderLooper::OnDrawFrame");
     SizeF imgSizeF = m_GLEnv->imgSize;
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_FboId);
+    int frameIndex = AcquireFreeFrame();
+    if (frameIndex < 0) {
+        LOGCATW("GLRenderLooper::OnDrawFrame all frames in flight, skip");
+        TRACE_INSTANT("GLRenderLooper::FrameSkipped");
+        return;
+    }
+
+    RenderFrame &frame = m_Frames[frameIndex];
+    GLsync releaseFence, staleRenderFence;
+    {
+        unique_lock<mutex> lock(m_FrameMutex);
+        releaseFence = frame.releaseFence;
+        staleRenderFence = frame.renderFence;
+        frame.releaseFence = nullptr;
+        frame.renderFence = nullptr;
+    }
+    if (staleRenderFence) glDeleteSync(staleRenderFence);
+    if (releaseFence) {
+        // 消费者可能仍在采样该纹理，GPU 侧等待即可
+        glWaitSync(releaseFence, 0, GL_TIMEOUT_IGNORED);
+        glDeleteSync(releaseFence);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, frame.fboId);
     glViewport(0, 0, imgSizeF.width, imgSizeF.height);
     glUseProgram(m_GLEnv->program);
     glBindVertexArray(m_VaoId);
@@ -118,30 +189,133 @@ void GLRenderLooper::OnDrawFrame() {
     glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (const void *)0);
     glBindVertexArray(0);
     glBindTexture(GL_TEXTURE_2D, 0);
-    m_OffscreenSurface->swapBuffers();
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
-    m_GLEnv->renderDone(m_GLEnv->callbackCtx, m_FboTextureId);
+    // fence 必须 flush 后其他上下文才能等待到
+    GLsync renderFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    {
+        unique_lock<mutex> lock(m_FrameMutex);
+        frame.renderFence = renderFence;
+        frame.sequence = ++m_FrameSequence;
+        frame.state = FRAME_READY;
+        if (TraceRecorder::IsEnabled()) {
+            int readyFrames = 0;
+            for (int i = 0; i < m_FrameCount; ++i) {
+                if (m_Frames[i].state == FRAME_READY) readyFrames++;
+            }
+            TraceRecorder::Counter("GLRenderLooper::ReadyFrames", readyFrames);
+        }
+    }
+    m_FrameCond.notify_all();
+
+    if (m_FrameCount <= 1) {
+        // 串行模式：旧的调用方在回调中唤醒等待，帧直接回到空闲状态
+        {
+            unique_lock<mutex> lock(m_FrameMutex);
+            frame.state = FRAME_FREE;
+        }
+        m_OffscreenSurface->swapBuffers();
+        m_GLEnv->renderDone(m_GLEnv->callbackCtx, frame.textureId);
+    }
     m_FrameIndex++;
 }
 
+bool GLRenderLooper::AcquireFrame(GLuint &textureId, int &frameIndex, int timeoutMs) {
+    TRACE_SCOPE("GLRenderLooper::AcquireFrame");
+    GLsync renderFence = nullptr;
+    {
+        unique_lock<mutex> lock(m_FrameMutex);
+        int latest = -1, displaying = -1;
+        for (int i = 0; i < m_FrameCount; ++i) {
+            if (m_Frames[i].state == FRAME_READY && (latest < 0 || m_Frames[i].sequence > m_Frames[latest].sequence)) {
+                latest = i;
+            }
+            if (m_Frames[i].state == FRAME_DISPLAYING) displaying = i;
+        }
+
+        if (latest < 0 && displaying < 0 && !m_SurfaceDestroyed) {
+            // 第一帧还没产出，只有这种情况下阻塞等待
+            m_FrameCond.wait_for(lock, chrono::milliseconds(timeoutMs), [this, &latest]() {
+                for (int i = 0; i < m_FrameCount; ++i) {
+                    if (m_Frames[i].state == FRAME_READY) latest = i;
+                }
+                return latest >= 0 || m_SurfaceDestroyed;
+            });
+        }
+
+        if (latest < 0) {
+            if (displaying < 0) return false;
+            // 没有新帧，继续显示上一帧
+            TRACE_INSTANT("GLRenderLooper::RepeatFrame");
+            latest = displaying;
+        } else {
+            if (displaying >= 0) {
+                m_Frames[displaying].state = FRAME_FREE;
+            }
+            renderFence = m_Frames[latest].renderFence;
+            m_Frames[latest].renderFence = nullptr;
+            m_Frames[latest].state = FRAME_DISPLAYING;
+        }
+        textureId = m_Frames[latest].textureId;
+        frameIndex = latest;
+    }
+
+    if (renderFence) {
+        // 仅在 GPU 命令流中等待，CPU 不阻塞
+        glWaitSync(renderFence, 0, GL_TIMEOUT_IGNORED);
+        glDeleteSync(renderFence);
+    }
+    return true;
+}
+
+void GLRenderLooper::ReleaseFrame(int frameIndex) {
+    if (frameIndex < 0) return;
+
+    GLsync releaseFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    GLsync staleFence = nullptr;
+    {
+        unique_lock<mutex> lock(m_FrameMutex);
+        // 只有前 m_FrameCount 帧已创建，surface 销毁后 m_FrameCount 为 0，迟到的释放直接丢弃 fence
+        if (frameIndex >= m_FrameCount) {
+            staleFence = releaseFence;
+        } else {
+            // 帧保持 DISPLAYING 状态，直到下一次 AcquireFrame 取到更新的帧，工作线程复用时等待该 fence
+            staleFence = m_Frames[frameIndex].releaseFence;
+            m_Frames[frameIndex].releaseFence = releaseFence;
+        }
+    }
+    if (staleFence) glDeleteSync(staleFence);
+}
+
 void GLRenderLooper::OnSurfaceDestroyed() {
     LOGCATE("GLRenderLooper::OnSurfaceDestroyed");
-    m_GLEnv->renderDone(m_GLEnv->callbackCtx, m_FboTextureId);
-
-    if (m_VaoId)
     {
-        glDeleteVertexArrays(1, &m_VaoId);
+        unique_lock<mutex> lock(m_FrameMutex);
+        m_SurfaceDestroyed = true;
+    }
+    m_FrameCond.notify_all();
+    if (m_FrameCount <= 1) {
+        m_GLEnv->renderDone(m_GLEnv->callbackCtx, m_Frames[0].textureId);
     }
 
-    if (m_FboId)
+    if (m_VaoId)
     {
-        glDeleteFramebuffers(1, &m_FboId);
+        glDeleteVertexArrays(1, &m_VaoId);
     }
 
-    if (m_FboTextureId)
     {
-        glDeleteTextures(1, &m_FboTextureId);
+        unique_lock<mutex> lock(m_FrameMutex);
+        for (int i = 0; i < m_FrameCount; ++i) {
+            RenderFrame &frame = m_Frames[i];
+            if (frame.renderFence) glDeleteSync(frame.renderFence);
+            if (frame.releaseFence) glDeleteSync(frame.releaseFence);
+            if (frame.fboId) glDeleteFramebuffers(1, &frame.fboId);
+            if (frame.textureId) glDeleteTextures(1, &frame.textureId);
+            memset(&frame, 0, sizeof(RenderFrame));
+        }
+        m_FrameCount = 0;
     }
 
     if (m_OffscreenSurface) {
@@ -157,10 +331,10 @@ void GLRenderLooper::OnSurfaceDestroyed() {
     }
 }
 
-bool GLRenderLooper::CreateFrameBufferObj() {
+bool GLRenderLooper::CreateFrameBufferObj(RenderFrame &frame) {
     // 创建并初始化 FBO 纹理
-    glGenTextures(1, &m_FboTextureId);
-    glBindTexture(GL_TEXTURE_2D, m_FboTextureId);
+    glGenTextures(1, &frame.textureId);
+    glBindTexture(GL_TEXTURE_2D, frame.textureId);
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -168,13 +342,13 @@ bool GLRenderLooper::CreateFrameBufferObj() {
     glBindTexture(GL_TEXTURE_2D, GL_NONE);
 
     // 创建并初始化 FBO
-    glGenFramebuffers(1, &m_FboId);
-    glBindFramebuffer(GL_FRAMEBUFFER, m_FboId);
-    glBindTexture(GL_TEXTURE_2D, m_FboTextureId);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_FboTextureId, 0);
+    glGenFramebuffers(1, &frame.fboId);
+    glBindFramebuffer(GL_FRAMEBUFFER, frame.fboId);
+    glBindTexture(GL_TEXTURE_2D, frame.textureId);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, frame.textureId, 0);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_GLEnv->imgSize.width, m_GLEnv->imgSize.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
     if (glCheckFramebufferStatus(GL_FRAMEBUFFER)!= GL_FRAMEBUFFER_COMPLETE) {
-        LOGCATE("RGB2YUYVSample::CreateFrameBufferObj glCheckFramebufferStatus status != GL_FRAMEBUFFER_COMPLETE");
+        LOGCATE("GLRenderLooper::CreateFrameBufferObj glCheckFramebufferStatus status != GL_FRAMEBUFFER_COMPLETE");
         return false;
     }
     glBindTexture(GL_TEXTURE_2D, GL_NONE);
@@ -17,6 +17,10 @@
 #include <EglCore.h>
 #include <OffscreenSurface.h>
 #include <ImageDef.h>
+#include <condition_variable>
+
+// 流水线模式下同时在途的 FBO 帧数上限
+#define RENDER_LOOPER_MAX_IN_FLIGHT 4
 
 using namespace std;
 
@@ -37,6 +41,25 @@ struct GLEnv {
     SizeF imgSize;
     RenderDoneCallback renderDone;
     void* callbackCtx;
+    // <= 1 为串行模式（每帧回调 renderDone），> 1 为流水线模式，通过 AcquireFrame/ReleaseFrame 取帧
+    int inFlightFrames;
+};
+
+enum RenderFrameState {
+    FRAME_FREE,
+    FRAME_RENDERING,
+    FRAME_READY,
+    FRAME_DISPLAYING,
+};
+
+// 每个在途帧独占一个 FBO 纹理，跨上下文通过 fence 同步
+struct RenderFrame {
+    GLuint fboId;
+    GLuint textureId;
+    GLsync renderFence;   // 工作线程渲染完成，消费者采样前 glWaitSync
+    GLsync releaseFence;  // 消费者采样完成，工作线程复用前 glWaitSync
+    RenderFrameState state;
+    int64_t sequence;
 };
 
 class GLRenderLooper : public Looper {
@@ -47,6 +70,13 @@ public:
     static GLRenderLooper* GetInstance();
     static void ReleaseInstance();
 
+    // 消费者（UI GL 线程）调用：取最新完成的帧，GPU 侧等待其 fence，不阻塞 CPU；
+    // 没有新帧时沿用上一帧，仅在从未产出过帧时最多等待 timeoutMs
+    bool AcquireFrame(GLuint &textureId, int &frameIndex, int timeoutMs = 100);
+
+    // 消费者绘制完成后调用，插入 release fence 后归还帧
+    void ReleaseFrame(int frameIndex);
+
 private:
     virtual void handleMessage(LooperMessage *msg);
 
@@ -55,7 +85,10 @@ private:
     void OnDrawFrame();
     void OnSurfaceDestroyed();
 
-    bool CreateFrameBufferObj();
+    bool CreateFrameBufferObj(RenderFrame &frame);
+
+    // 工作线程：选取可写入的帧，没有空闲帧时返回 -1
+    int AcquireFreeFrame();
 
 private:
     static mutex m_Mutex;
@@ -65,9 +98,14 @@ private:
     EglCore *m_EglCore = nullptr;
     OffscreenSurface *m_OffscreenSurface = nullptr;
     GLuint m_VaoId;
-    GLuint m_FboTextureId;
-    GLuint m_FboId;
     int m_FrameIndex = 0;
+
+    mutex m_FrameMutex;
+    condition_variable m_FrameCond;
+    RenderFrame m_Frames[RENDER_LOOPER_MAX_IN_FLIGHT];
+    int m_FrameCount = 0;
+    int64_t m_FrameSequence = 0;
+    bool m_SurfaceDestroyed = false;
 };
 
 #endif //NDK_OPENGLES_3_0_GLRENDERLOOPER_H
@@ -8,7 +8,6 @@
 
 #include "Looper.h"
 
-#include <jni.h>
 #include <pthread.h>
 #include <stdio.h>
 #include <string.h>
@@ -16,25 +15,28 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <semaphore.h>
+#include <sched.h>
 #include "LogUtil.h"
-struct LooperMessage;
-typedef struct LooperMessage LooperMessage;
-
+#include "TraceRecorder.h"
 void* Looper::trampoline(void* p) {
     ((Looper*)p)->loop();
     return NULL;
 }
 
 Looper::Looper() {
-    head = NULL;
+    for (uint32_t i = 0; i < LOOPER_QUEUE_CAPACITY; i++) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    enqueuePos.store(0, std::memory_order_relaxed);
+    dequeuePos = 0;
+    flushGeneration.store(0, std::memory_order_relaxed);
 
     sem_init(&headDataAvailable, 0, 0);
-    sem_init(&headWriteProtect, 0, 1);
     pthread_attr_t attr;
     pthread_attr_init(&attr);
 
-    pthread_create(&worker, &attr, trampoline, this);
     running = true;
+    pthread_create(&worker, &attr, trampoline, this);
 }
 
 Looper::~Looper() {
@@ -57,83 +59,107 @@ void Looper::postMessage(int what, int arg1, int arg2, bool flush) {
 }
 
 void Looper::postMessage(int what, int arg1, int arg2, void *obj, bool flush) {
-    LooperMessage *msg = new LooperMessage();
-    msg->what = what;
-    msg->obj = obj;
-    msg->arg1 = arg1;
-    msg->arg2 = arg2;
-    msg->next = NULL;
-    msg->quit = false;
+    LooperMessage msg;
+    msg.what = what;
+    msg.obj = obj;
+    msg.arg1 = arg1;
+    msg.arg2 = arg2;
+    msg.quit = false;
     addMessage(msg, flush);
 }
 
-void Looper::addMessage(LooperMessage *msg, bool flush) {
-    sem_wait(&headWriteProtect);
-    LooperMessage *h = head;
-
-    if (flush) {
-        while(h) {
-            LooperMessage *next = h->next;
-            delete h;
-            h = next;
+bool Looper::tryEnqueue(const LooperMessage &msg, uint32_t generation) {
+    // Vyukov 有界队列：CAS 抢占槽位，写完后通过 sequence 发布给消费者
+    uint32_t pos = enqueuePos.load(std::memory_order_relaxed);
+    MessageCell *cell;
+    for (;;) {
+        cell = &cells[pos & (LOOPER_QUEUE_CAPACITY - 1)];
+        uint32_t seq = cell->sequence.load(std::memory_order_acquire);
+        int32_t dif = (int32_t) (seq - pos);
+        if (dif == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (dif < 0) {
+            return false;
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
         }
-        h = NULL;
     }
-    if (h) {
-        while (h->next) {
-            h = h->next;
+    cell->msg = msg;
+    cell->flushGeneration = generation;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool Looper::dequeue(LooperMessage &msg, uint32_t &generation) {
+    MessageCell *cell = &cells[dequeuePos & (LOOPER_QUEUE_CAPACITY - 1)];
+    uint32_t seq = cell->sequence.load(std::memory_order_acquire);
+    if ((int32_t) (seq - (dequeuePos + 1)) < 0) {
+        return false;
+    }
+    msg = cell->msg;
+    generation = cell->flushGeneration;
+    cell->sequence.store(dequeuePos + LOOPER_QUEUE_CAPACITY, std::memory_order_release);
+    dequeuePos++;
+    return true;
+}
+
+void Looper::addMessage(const LooperMessage &msg, bool flush) {
+    uint32_t generation = flush ? flushGeneration.fetch_add(1, std::memory_order_acq_rel) + 1
+                                : flushGeneration.load(std::memory_order_acquire);
+    bool warned = false;
+    while (!tryEnqueue(msg, generation)) {
+        if (!warned) {
+            LOGCATE("Looper::addMessage queue full, msg->what=%d", msg.what);
+            warned = true;
         }
-        h->next = msg;
-    } else {
-        head = msg;
+        sched_yield();
     }
-    LOGCATE("Looper::addMessage msg->what=%d", msg->what);
-    sem_post(&headWriteProtect);
     sem_post(&headDataAvailable);
 }
 
 void Looper::loop() {
+    LooperMessage msg;
+    uint32_t generation;
     while(true) {
         // wait for available message
         sem_wait(&headDataAvailable);
 
-        // get next available message
-        sem_wait(&headWriteProtect);
-        LooperMessage *msg = head;
-        if (msg == NULL) {
-            LOGCATE("Looper::loop() no msg");
-            sem_post(&headWriteProtect);
-            continue;
+        // 信号量已计数但槽位可能仍在被较慢的生产者写入，短暂让出等待发布
+        while (!dequeue(msg, generation)) {
+            sched_yield();
         }
-        head = msg->next;
-        sem_post(&headWriteProtect);
 
-        if (msg->quit) {
+        if (msg.quit) {
             LOGCATE("Looper::loop() quitting");
-            delete msg;
             return;
         }
-        LOGCATE("Looper::loop() processing msg.what=%d", msg->what);
-        handleMessage(msg);
-        delete msg;
+
+        if ((int32_t) (generation - flushGeneration.load(std::memory_order_acquire)) < 0) {
+            // 在 flush 消息之前入队，丢弃
+            continue;
+        }
+        TRACE_SCOPE("Looper::handleMessage");
+        handleMessage(&msg);
     }
 }
 
 void Looper::quit() {
     LOGCATE("Looper::quit()");
-    LooperMessage *msg = new LooperMessage();
-    msg->what = 0;
-    msg->obj = NULL;
-    msg->next = NULL;
-    msg->quit = true;
+    LooperMessage msg;
+    msg.what = 0;
+    msg.arg1 = 0;
+    msg.arg2 = 0;
+    msg.obj = NULL;
+    msg.quit = true;
     addMessage(msg, false);
     void *retval;
     pthread_join(worker, &retval);
     sem_destroy(&headDataAvailable);
-    sem_destroy(&headWriteProtect);
     running = false;
 }
 
 void Looper::handleMessage(LooperMessage *msg) {
-    LOGCATE("Looper::handleMessage [what, obj]=[%d, %p]", msg->what, msg->obj);
-}
\ No newline at end of file
+    LOGCATV("Looper::handleMessage [what, obj]=[%d, %p]", msg->what, msg->obj);
+}
@@ -5,13 +5,17 @@
 #include <pthread.h>
 #include <sys/types.h>
 #include <semaphore.h>
+#include <atomic>
+#include <stdint.h>
+
+// 消息队列容量，必须是 2 的幂；队列满时生产者让出 CPU 等待消费
+#define LOOPER_QUEUE_CAPACITY 256
 
 struct LooperMessage {
     int what;
     int arg1;
     int arg2;
     void *obj;
-    LooperMessage *next;
     bool quit;
 };
 
@@ -23,6 +27,7 @@ public:
     Looper(Looper&) = delete;
     virtual ~Looper();
 
+    // 可在任意线程调用，无锁入队且不分配内存
     void postMessage(int what, bool flush = false);
     void postMessage(int what, void *obj, bool flush = false);
     void postMessage(int what, int arg1, int arg2, bool flush = false);
@@ -30,18 +35,35 @@ public:
 
     void quit();
 
+    // msg 仅在回调期间有效
     virtual void handleMessage(LooperMessage *msg);
 
 private:
-    void addMessage(LooperMessage *msg, bool flush);
+    // 有界 MPSC 环形队列的槽位，消息按值存放，槽位即消息池
+    struct MessageCell {
+        std::atomic<uint32_t> sequence;
+        uint32_t flushGeneration;
+        LooperMessage msg;
+    };
+
+    void addMessage(const LooperMessage &msg, bool flush);
+
+    bool tryEnqueue(const LooperMessage &msg, uint32_t flushGeneration);
+
+    bool dequeue(LooperMessage &msg, uint32_t &flushGeneration);
 
     static void *trampoline(void *p);
 
     void loop(void);
 
-    LooperMessage *head;
+    MessageCell cells[LOOPER_QUEUE_CAPACITY];
+    std::atomic<uint32_t> enqueuePos;
+    // flush 时递增，消费者丢弃代数更旧的消息
+    std::atomic<uint32_t> flushGeneration;
+    // 生产者与消费者的游标分处不同缓存行，避免伪共享
+    char cacheLinePadding[64];
+    uint32_t dequeuePos;
     pthread_t worker;
-    sem_t headWriteProtect;
     sem_t headDataAvailable;
     bool running;
 
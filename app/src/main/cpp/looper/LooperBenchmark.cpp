@@ -0,0 +1,133 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "LooperBenchmark.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <time.h>
+#include "Looper.h"
+#include "LogUtil.h"
+
+enum
+{
+	MSG_BenchmarkPost,
+};
+
+static int64_t GetMonotonicNs()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t) ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+class BenchmarkLooper : public Looper
+{
+public:
+	BenchmarkLooper(int64_t *pPostTimes, int messageCount) : m_pPostTimes(pPostTimes)
+	{
+		m_Latencies.reserve((size_t) messageCount);
+		m_Handled.store(0);
+		m_LastHandleNs = 0;
+	}
+
+	virtual ~BenchmarkLooper()
+	{
+		quit();
+	}
+
+	int GetHandledCount()
+	{
+		return m_Handled.load(std::memory_order_acquire);
+	}
+
+	std::vector<int64_t> &GetLatencies()
+	{
+		return m_Latencies;
+	}
+
+	int64_t GetLastHandleNs()
+	{
+		return m_LastHandleNs;
+	}
+
+private:
+	virtual void handleMessage(LooperMessage *msg)
+	{
+		if (msg->what != MSG_BenchmarkPost) return;
+		// arg1 为消息序号，投递时间由生产者写入 m_pPostTimes
+		int64_t now = GetMonotonicNs();
+		m_Latencies.push_back(now - m_pPostTimes[msg->arg1]);
+		m_LastHandleNs = now;
+		m_Handled.fetch_add(1, std::memory_order_release);
+	}
+
+	int64_t *m_pPostTimes;
+	std::vector<int64_t> m_Latencies;
+	std::atomic<int> m_Handled;
+	int64_t m_LastHandleNs;
+};
+
+LooperBenchmarkResult LooperBenchmark::Run(int producerCount, int messagesPerProducer)
+{
+	LooperBenchmarkResult result = {};
+	result.producerCount = producerCount;
+	result.messageCount = producerCount * messagesPerProducer;
+	if (result.messageCount <= 0) return result;
+
+	std::vector<int64_t> postTimes((size_t) result.messageCount);
+	BenchmarkLooper *pLooper = new BenchmarkLooper(postTimes.data(), result.messageCount);
+
+	std::atomic<bool> start(false);
+	std::vector<std::thread> producers;
+	for (int p = 0; p < producerCount; ++p)
+	{
+		producers.emplace_back([&, p]() {
+			while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+			for (int i = 0; i < messagesPerProducer; ++i)
+			{
+				int index = p * messagesPerProducer + i;
+				postTimes[index] = GetMonotonicNs();
+				pLooper->postMessage(MSG_BenchmarkPost, index, 0);
+			}
+		});
+	}
+
+	int64_t startNs = GetMonotonicNs();
+	start.store(true, std::memory_order_release);
+	for (auto &producer : producers)
+	{
+		producer.join();
+	}
+	while (pLooper->GetHandledCount() < result.messageCount)
+	{
+		std::this_thread::yield();
+	}
+
+	std::vector<int64_t> &latencies = pLooper->GetLatencies();
+	std::sort(latencies.begin(), latencies.end());
+	result.latencyP50Ns = latencies[latencies.size() / 2];
+	result.latencyP99Ns = latencies[std::min(latencies.size() - 1, latencies.size() * 99 / 100)];
+	result.latencyMaxNs = latencies.back();
+	int64_t elapsedNs = std::max<int64_t>(pLooper->GetLastHandleNs() - startNs, 1);
+	result.throughput = result.messageCount * 1e9 / elapsedNs;
+
+	delete pLooper;
+	return result;
+}
+
+void LooperBenchmark::RunAll(std::vector<LooperBenchmarkResult> &results, int messagesPerProducer)
+{
+	const int producerCounts[] = {1, 2, 4, 8};
+	results.clear();
+	for (int producerCount : producerCounts)
+	{
+		LooperBenchmarkResult result = Run(producerCount, messagesPerProducer);
+		results.push_back(result);
+		LOGCATE("LooperBenchmark producers=%d, messages=%d, throughput=%.0f msg/s, latency p50=%lldns, p99=%lldns, max=%lldns",
+				result.producerCount, result.messageCount, result.throughput,
+				(long long) result.latencyP50Ns, (long long) result.latencyP99Ns, (long long) result.latencyMaxNs);
+	}
+}
@@ -0,0 +1,33 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_LOOPERBENCHMARK_H
+#define NDK_OPENGLES_3_0_LOOPERBENCHMARK_H
+
+#include <stdint.h>
+#include <vector>
+
+struct LooperBenchmarkResult
+{
+	int producerCount;
+	int messageCount;
+	double throughput;      // 消息/秒，从第一条投递到最后一条处理完成
+	int64_t latencyP50Ns;   // 投递到 handleMessage 的延迟
+	int64_t latencyP99Ns;
+	int64_t latencyMaxNs;
+};
+
+/**
+ * Looper 压测：多个生产者线程同时 postMessage，统计投递到处理的延迟分布和吞吐。
+ */
+class LooperBenchmark
+{
+public:
+	static LooperBenchmarkResult Run(int producerCount, int messagesPerProducer);
+
+	// 依次运行 1/2/4/8 个生产者，结果写入 results 并打印日志
+	static void RunAll(std::vector<LooperBenchmarkResult> &results, int messagesPerProducer = 100000);
+};
+
+#endif //NDK_OPENGLES_3_0_LOOPERBENCHMARK_H
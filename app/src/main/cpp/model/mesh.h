@@ -3,6 +3,7 @@
 
 #include <glm.hpp>
 #include <gtc/matrix_transform.hpp>
+#include <gtc/packing.hpp>
 
 #include <shader.h>
 
@@ -28,6 +29,16 @@ struct Vertex {
     glm::vec3 Bitangent;
 };
 
+// compact layout, 24 bytes instead of 56. Normal and tangent are GL_INT_2_10_10_10_REV and texCoords are
+// half floats, all read as plain vec3/vec2 attributes by the shader. The bitangent is not stored:
+// shaders that need it rebuild it as cross(normal, tangent.xyz) * tangent.w (attribute 3 as a vec4).
+struct PackedVertex {
+    glm::vec3 Position;
+    uint32_t Normal;      // xyz snorm10, w unused
+    uint32_t Tangent;     // xyz snorm10, w = bitangent handedness (+1 / -1)
+    uint32_t TexCoords;   // packHalf2x16
+};
+
 struct Texture {
     unsigned int id;
     string type;
@@ -41,17 +52,42 @@ public:
     vector<unsigned int> indices;
     vector<Texture> textures;
     unsigned int VAO;
+    unsigned int indexCount;
+    GLenum indexType;         // GL_UNSIGNED_SHORT whenever every index fits, otherwise GL_UNSIGNED_INT
+    size_t vertexBytes;       // GPU buffer sizes, for memory statistics
+    size_t indexBytes;
 
     /*  Functions  */
-    // constructor
-    Mesh(vector<Vertex> vertices, vector<unsigned int> indices, vector<Texture> textures)
+    // constructor, packed selects the PackedVertex layout for the GPU copy
+    Mesh(vector<Vertex> vertices, vector<unsigned int> indices, vector<Texture> textures, bool packed = false)
     {
         this->vertices = vertices;
         this->indices = indices;
         this->textures = textures;
 
         // now that we have all the required data, set the vertex buffers and its attribute pointers.
-        setupMesh();
+        setupMesh(this->vertices.data(), this->vertices.size(), this->indices.data(), this->indices.size(), packed);
+    }
+
+    // constructor for data that is uploaded straight to the GPU without keeping a CPU copy,
+    // e.g. arrays mapped from the binary mesh cache (see mesh_cache.h)
+    Mesh(const Vertex *pVertices, size_t vertexCount, const unsigned int *pIndices, size_t indexCount, vector<Texture> textures,
+         bool packed = false)
+    {
+        this->textures = textures;
+        setupMesh(pVertices, vertexCount, pIndices, indexCount, packed);
+    }
+
+    static PackedVertex PackVertex(const Vertex &vertex)
+    {
+        PackedVertex packed;
+        packed.Position = vertex.Position;
+        packed.Normal = glm::packSnorm3x10_1x2(glm::vec4(finiteOrZero(vertex.Normal), 0.0f));
+        // handedness of the (T, B, N) frame, so that cross(N, T) * w points along the original bitangent
+        float handedness = glm::dot(glm::cross(vertex.Normal, vertex.Tangent), vertex.Bitangent) < 0.0f ? -1.0f : 1.0f;
+        packed.Tangent = glm::packSnorm3x10_1x2(glm::vec4(finiteOrZero(vertex.Tangent), handedness));
+        packed.TexCoords = glm::packHalf2x16(vertex.TexCoords);
+        return packed;
     }
 
     // render the mesh
@@ -85,7 +121,7 @@ public:
         
         // draw mesh
         glBindVertexArray(VAO);
-        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+        glDrawElements(GL_TRIANGLES, indexCount, indexType, 0);
         glBindVertexArray(0);
 
         // always good practice to set everything back to defaults once configured.
@@ -108,9 +144,17 @@ private:
     unsigned int VBO, EBO;
 
     /*  Functions    */
+    // Assimp leaves tangents undefined (NaN) on meshes without texture coordinates
+    static glm::vec3 finiteOrZero(const glm::vec3 &v)
+    {
+        return glm::all(glm::equal(v, v)) ? glm::clamp(v, -1.0f, 1.0f) : glm::vec3(0.0f);
+    }
+
     // initializes all the buffer objects/arrays
-    void setupMesh()
+    void setupMesh(const Vertex *pVertices, size_t vertexCount, const unsigned int *pIndices, size_t indexCount, bool packed)
     {
+        this->indexCount = (unsigned int) indexCount;
+
         // create buffers/arrays
         glGenVertexArrays(1, &VAO);
         glGenBuffers(1, &VBO);
@@ -119,30 +163,78 @@ private:
         glBindVertexArray(VAO);
         // load data into vertex buffers
         glBindBuffer(GL_ARRAY_BUFFER, VBO);
-        // A great thing about structs is that their memory layout is sequential for all its items.
-        // The effect is that we can simply pass a pointer to the struct and it translates perfectly to a glm::vec3/2 array which
-        // again translates to 3/2 floats which translates to a byte array.
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), &vertices[0], GL_STATIC_DRAW);  
+        if (packed)
+        {
+            vector<PackedVertex> packedVertices(vertexCount);
+            for (size_t i = 0; i < vertexCount; i++)
+                packedVertices[i] = PackVertex(pVertices[i]);
+            vertexBytes = vertexCount * sizeof(PackedVertex);
+            glBufferData(GL_ARRAY_BUFFER, vertexBytes, packedVertices.data(), GL_STATIC_DRAW);
+        }
+        else
+        {
+            // A great thing about structs is that their memory layout is sequential for all its items.
+            // The effect is that we can simply pass a pointer to the struct and it translates perfectly to a glm::vec3/2 array which
+            // again translates to 3/2 floats which translates to a byte array.
+            vertexBytes = vertexCount * sizeof(Vertex);
+            glBufferData(GL_ARRAY_BUFFER, vertexBytes, pVertices, GL_STATIC_DRAW);
+        }
 
+        // 16-bit indices halve the index buffer and the index fetch bandwidth whenever every index fits
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
+        unsigned int maxIndex = 0;
+        for (size_t i = 0; i < indexCount; i++)
+            maxIndex = pIndices[i] > maxIndex ? pIndices[i] : maxIndex;
+        if (maxIndex <= 0xFFFF)
+        {
+            vector<unsigned short> shortIndices(pIndices, pIndices + indexCount);
+            indexType = GL_UNSIGNED_SHORT;
+            indexBytes = indexCount * sizeof(unsigned short);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBytes, shortIndices.data(), GL_STATIC_DRAW);
+        }
+        else
+        {
+            indexType = GL_UNSIGNED_INT;
+            indexBytes = indexCount * sizeof(unsigned int);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBytes, pIndices, GL_STATIC_DRAW);
+        }
 
         // set the vertex attribute pointers
-        // vertex Positions
-        glEnableVertexAttribArray(0);	
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
-        // vertex normals
-        glEnableVertexAttribArray(1);	
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Normal));
-        // vertex texture coords
-        glEnableVertexAttribArray(2);	
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
-        // vertex tangent
-        glEnableVertexAttribArray(3);
-        glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Tangent));
-        // vertex bitangent
-        glEnableVertexAttribArray(4);
-        glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Bitangent));
+        if (packed)
+        {
+            // vertex Positions
+            glEnableVertexAttribArray(0);
+            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(PackedVertex), (void*)0);
+            // vertex normals
+            glEnableVertexAttribArray(1);
+            glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, Normal));
+            // vertex texture coords
+            glEnableVertexAttribArray(2);
+            glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, TexCoords));
+            // vertex tangent, w is the bitangent handedness
+            glEnableVertexAttribArray(3);
+            glVertexAttribPointer(3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, Tangent));
+            // no bitangent stream
+            glDisableVertexAttribArray(4);
+        }
+        else
+        {
+            // vertex Positions
+            glEnableVertexAttribArray(0);
+            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
+            // vertex normals
+            glEnableVertexAttribArray(1);
+            glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Normal));
+            // vertex texture coords
+            glEnableVertexAttribArray(2);
+            glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
+            // vertex tangent
+            glEnableVertexAttribArray(3);
+            glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Tangent));
+            // vertex bitangent
+            glEnableVertexAttribArray(4);
+            glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Bitangent));
+        }
 
         glBindVertexArray(0);
     }
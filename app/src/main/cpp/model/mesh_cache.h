@@ -0,0 +1,268 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef MESH_CACHE_H
+#define MESH_CACHE_H
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <string>
+#include <vector>
+#include "stdint.h"
+#include "mesh.h"
+#include "LogUtil.h"
+
+#define MESH_CACHE_MAGIC   0x434D4642 // "BFMC"
+#define MESH_CACHE_VERSION 2
+#define MESH_CACHE_SUFFIX  ".bfmesh"
+
+/**
+ * 二进制网格缓存的文件布局，所有段按 4 字节对齐，mmap 后可直接作为 Vertex / index 数组使用：
+ * MeshCacheHeader
+ * 逐个网格：MeshCacheMeshHeader、Vertex[vertexCount]、uint32_t[indexCount]、
+ *          逐个纹理：MeshCacheTextureHeader、type、path（不含结尾 0，补齐到 4 字节）
+ */
+struct MeshCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vertexSize;   // sizeof(Vertex)，布局变化时缓存自动失效
+    uint32_t meshCount;
+    int64_t sourceSize;    // 源模型文件的大小和修改时间，源文件更新后缓存失效
+    int64_t sourceMtime;
+    float minXyz[3];
+    float maxXyz[3];
+    uint32_t optimizeFlags; // 写入时网格经过的 MESH_OPTIMIZE_* 处理，与当前要求不同时缓存失效
+    uint32_t reserved;
+};
+
+struct MeshCacheMeshHeader {
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    uint32_t textureCount;
+    uint32_t reserved;
+};
+
+struct MeshCacheTextureHeader {
+    uint32_t typeLength;
+    uint32_t pathLength;
+};
+
+struct MeshCacheTextureRef {
+    string type;
+    string path;
+};
+
+// 指向 mmap 区域的网格数据，MeshCacheReader 关闭后失效
+struct MeshCacheMeshView {
+    const Vertex *pVertices;
+    uint32_t vertexCount;
+    const unsigned int *pIndices;
+    uint32_t indexCount;
+    vector<MeshCacheTextureRef> textures;
+};
+
+static inline size_t MeshCacheAlign(size_t size)
+{
+    return (size + 3) & ~(size_t) 3;
+}
+
+static inline bool MeshCacheStatSource(const string &assetPath, int64_t &size, int64_t &mtime)
+{
+    struct stat st;
+    if (stat(assetPath.c_str(), &st) != 0) return false;
+    size = (int64_t) st.st_size;
+    mtime = (int64_t) st.st_mtime;
+    return true;
+}
+
+/**
+ * 模型的二进制网格缓存，放在模型文件旁（path + MESH_CACHE_SUFFIX）。
+ * 首次加载经 Assimp 解析后写入，之后 mmap 读取并直接上传到 VBO，跳过 Assimp。
+ * 只校验 .obj 等主文件，单独修改 .mtl 后需删除缓存文件。
+ */
+class MeshCache {
+public:
+    static string GetCachePath(const string &assetPath)
+    {
+        return assetPath + MESH_CACHE_SUFFIX;
+    }
+
+    static bool Write(const string &assetPath, const vector<Mesh> &meshes, const glm::vec3 &minXyz, const glm::vec3 &maxXyz,
+                      uint32_t optimizeFlags)
+    {
+        MeshCacheHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic = MESH_CACHE_MAGIC;
+        header.version = MESH_CACHE_VERSION;
+        header.vertexSize = sizeof(Vertex);
+        header.meshCount = (uint32_t) meshes.size();
+        header.optimizeFlags = optimizeFlags;
+        if (!MeshCacheStatSource(assetPath, header.sourceSize, header.sourceMtime)) return false;
+        for (int i = 0; i < 3; ++i) {
+            header.minXyz[i] = minXyz[i];
+            header.maxXyz[i] = maxXyz[i];
+        }
+
+        // 先写临时文件再 rename，避免进程中途退出留下不完整的缓存
+        string path = GetCachePath(assetPath);
+        string tmpPath = path + ".tmp";
+        FILE *fp = fopen(tmpPath.c_str(), "wb");
+        if (fp == nullptr) {
+            LOGCATE("MeshCache::Write open fail, file=%s", tmpPath.c_str());
+            return false;
+        }
+
+        static const char kPadding[4] = {0};
+        bool ok = fwrite(&header, sizeof(header), 1, fp) == 1;
+        for (size_t i = 0; ok && i < meshes.size(); ++i) {
+            const Mesh &mesh = meshes[i];
+            MeshCacheMeshHeader meshHeader;
+            meshHeader.vertexCount = (uint32_t) mesh.vertices.size();
+            meshHeader.indexCount = (uint32_t) mesh.indices.size();
+            meshHeader.textureCount = (uint32_t) mesh.textures.size();
+            meshHeader.reserved = 0;
+            ok = fwrite(&meshHeader, sizeof(meshHeader), 1, fp) == 1;
+            if (ok && !mesh.vertices.empty())
+                ok = fwrite(mesh.vertices.data(), sizeof(Vertex), mesh.vertices.size(), fp) == mesh.vertices.size();
+            if (ok && !mesh.indices.empty())
+                ok = fwrite(mesh.indices.data(), sizeof(unsigned int), mesh.indices.size(), fp) == mesh.indices.size();
+            for (size_t j = 0; ok && j < mesh.textures.size(); ++j) {
+                const Texture &texture = mesh.textures[j];
+                MeshCacheTextureHeader textureHeader;
+                textureHeader.typeLength = (uint32_t) texture.type.size();
+                textureHeader.pathLength = (uint32_t) texture.path.size();
+                size_t length = texture.type.size() + texture.path.size();
+                ok = fwrite(&textureHeader, sizeof(textureHeader), 1, fp) == 1
+                        && fwrite(texture.type.data(), 1, texture.type.size(), fp) == texture.type.size()
+                        && fwrite(texture.path.data(), 1, texture.path.size(), fp) == texture.path.size()
+                        && fwrite(kPadding, 1, MeshCacheAlign(length) - length, fp) == MeshCacheAlign(length) - length;
+            }
+        }
+        ok = fclose(fp) == 0 && ok;
+        if (!ok || rename(tmpPath.c_str(), path.c_str()) != 0) {
+            LOGCATE("MeshCache::Write fail, file=%s", path.c_str());
+            unlink(tmpPath.c_str());
+            return false;
+        }
+        return true;
+    }
+};
+
+// mmap 缓存文件并校验所有段都在文件范围内，析构时 munmap
+class MeshCacheReader {
+public:
+    MeshCacheReader() : m_pData(nullptr), m_Size(0), m_pHeader(nullptr) {}
+
+    ~MeshCacheReader()
+    {
+        Close();
+    }
+
+    bool Open(const string &assetPath, uint32_t optimizeFlags)
+    {
+        Close();
+        string path = MeshCache::GetCachePath(assetPath);
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(MeshCacheHeader)) {
+            close(fd);
+            return false;
+        }
+        void *pData = mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (pData == MAP_FAILED) {
+            LOGCATE("MeshCacheReader::Open mmap fail, file=%s", path.c_str());
+            return false;
+        }
+        m_pData = (const uint8_t *) pData;
+        m_Size = (size_t) st.st_size;
+
+        if (!Parse(assetPath, optimizeFlags)) {
+            LOGCATW("MeshCacheReader::Open stale or corrupt cache, file=%s", path.c_str());
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void Close()
+    {
+        if (m_pData != nullptr) munmap((void *) m_pData, m_Size);
+        m_pData = nullptr;
+        m_Size = 0;
+        m_pHeader = nullptr;
+        m_Meshes.clear();
+    }
+
+    const MeshCacheHeader &GetHeader() const
+    {
+        return *m_pHeader;
+    }
+
+    const vector<MeshCacheMeshView> &GetMeshes() const
+    {
+        return m_Meshes;
+    }
+
+private:
+    bool Parse(const string &assetPath, uint32_t optimizeFlags)
+    {
+        const MeshCacheHeader *pHeader = (const MeshCacheHeader *) m_pData;
+        int64_t sourceSize = 0, sourceMtime = 0;
+        if (pHeader->magic != MESH_CACHE_MAGIC || pHeader->version != MESH_CACHE_VERSION
+                || pHeader->vertexSize != sizeof(Vertex) || pHeader->optimizeFlags != optimizeFlags
+                || !MeshCacheStatSource(assetPath, sourceSize, sourceMtime)
+                || pHeader->sourceSize != sourceSize || pHeader->sourceMtime != sourceMtime)
+            return false;
+
+        size_t offset = sizeof(MeshCacheHeader);
+        for (uint32_t i = 0; i < pHeader->meshCount; ++i) {
+            if (m_Size - offset < sizeof(MeshCacheMeshHeader)) return false;
+            const MeshCacheMeshHeader *pMeshHeader = (const MeshCacheMeshHeader *) (m_pData + offset);
+            offset += sizeof(MeshCacheMeshHeader);
+
+            MeshCacheMeshView view;
+            size_t vertexBytes = (size_t) pMeshHeader->vertexCount * sizeof(Vertex);
+            size_t indexBytes = (size_t) pMeshHeader->indexCount * sizeof(unsigned int);
+            if (m_Size - offset < vertexBytes) return false;
+            view.pVertices = (const Vertex *) (m_pData + offset);
+            view.vertexCount = pMeshHeader->vertexCount;
+            offset += vertexBytes;
+            if (m_Size - offset < indexBytes) return false;
+            view.pIndices = (const unsigned int *) (m_pData + offset);
+            view.indexCount = pMeshHeader->indexCount;
+            offset += indexBytes;
+
+            for (uint32_t j = 0; j < pMeshHeader->textureCount; ++j) {
+                if (m_Size - offset < sizeof(MeshCacheTextureHeader)) return false;
+                const MeshCacheTextureHeader *pTextureHeader = (const MeshCacheTextureHeader *) (m_pData + offset);
+                offset += sizeof(MeshCacheTextureHeader);
+                size_t length = (size_t) pTextureHeader->typeLength + pTextureHeader->pathLength;
+                if (m_Size - offset < MeshCacheAlign(length)) return false;
+                const char *pChars = (const char *) (m_pData + offset);
+                MeshCacheTextureRef ref;
+                ref.type.assign(pChars, pTextureHeader->typeLength);
+                ref.path.assign(pChars + pTextureHeader->typeLength, pTextureHeader->pathLength);
+                view.textures.push_back(ref);
+                offset += MeshCacheAlign(length);
+            }
+            m_Meshes.push_back(view);
+        }
+        m_pHeader = pHeader;
+        return offset == m_Size;
+    }
+
+    const uint8_t *m_pData;
+    size_t m_Size;
+    const MeshCacheHeader *m_pHeader;
+    vector<MeshCacheMeshView> m_Meshes;
+};
+
+#endif
@@ -0,0 +1,304 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef MESH_OPTIMIZER_H
+#define MESH_OPTIMIZER_H
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+#include "stdint.h"
+#include "mesh.h"
+
+#define MESH_OPTIMIZE_DEDUP        0x1  // 合并完全相同的顶点
+#define MESH_OPTIMIZE_VERTEX_CACHE 0x2  // 三角形重排，提高 post-transform cache 命中
+#define MESH_OPTIMIZE_OVERDRAW     0x4  // 三角形簇按朝外程度排序，先画外侧减少 overdraw，ACMR 略有上升
+#define MESH_OPTIMIZE_VERTEX_FETCH 0x8  // 顶点按首次使用的顺序重排，提高顶点读取的局部性
+#define MESH_OPTIMIZE_DEFAULT      (MESH_OPTIMIZE_DEDUP | MESH_OPTIMIZE_VERTEX_CACHE | MESH_OPTIMIZE_VERTEX_FETCH)
+
+// Forsyth 算法模拟的 LRU cache 大小
+#define MESH_OPTIMIZER_CACHE_SIZE 32
+
+// 统计 ACMR 时模拟的 FIFO post-transform cache 大小，接近移动 GPU 的实际大小
+#define MESH_OPTIMIZER_ACMR_CACHE_SIZE 16
+
+// overdraw 排序的簇至少包含的三角形数，簇越小排序越细、ACMR 损失越大
+#define MESH_OPTIMIZER_MIN_CLUSTER_SIZE 64
+
+struct MeshOptimizeStats {
+    uint32_t vertexCountBefore = 0;
+    uint32_t vertexCountAfter = 0;
+    float acmrBefore = 0;   // 每个三角形的平均顶点着色次数，理想值接近 0.5，最差为 3
+    float acmrAfter = 0;
+};
+
+/**
+ * 导入网格的离线 / 加载时优化：顶点去重、Forsyth 线性时间的三角形重排、
+ * 可选的按簇排序减少 overdraw、按首次使用重排顶点。结果写入二进制网格缓存，之后的加载不再重复计算。
+ */
+class MeshOptimizer {
+public:
+    static void Optimize(vector<Vertex> &vertices, vector<unsigned int> &indices, unsigned int flags, MeshOptimizeStats &stats)
+    {
+        stats.vertexCountBefore = (uint32_t) vertices.size();
+        stats.acmrBefore = ComputeACMR(indices, vertices.size());
+        if (flags & MESH_OPTIMIZE_DEDUP) JoinIdenticalVertices(vertices, indices);
+        if (flags & MESH_OPTIMIZE_VERTEX_CACHE) OptimizeVertexCache(indices, vertices.size());
+        if (flags & MESH_OPTIMIZE_OVERDRAW) OptimizeOverdraw(indices, vertices);
+        if (flags & MESH_OPTIMIZE_VERTEX_FETCH) OptimizeVertexFetch(vertices, indices);
+        stats.vertexCountAfter = (uint32_t) vertices.size();
+        stats.acmrAfter = ComputeACMR(indices, vertices.size());
+    }
+
+    static float ComputeACMR(const vector<unsigned int> &indices, size_t vertexCount, int cacheSize = MESH_OPTIMIZER_ACMR_CACHE_SIZE)
+    {
+        size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0) return 0;
+        // FIFO：记录每个顶点进入 cache 时的计数，计数差不超过 cacheSize 即命中
+        vector<int64_t> timestamps(vertexCount, INT64_MIN / 2);
+        int64_t time = 0;
+        size_t misses = 0;
+        for (unsigned int index : indices) {
+            if (time - timestamps[index] > cacheSize) {
+                timestamps[index] = time++;
+                misses++;
+            }
+        }
+        return (float) misses / triangleCount;
+    }
+
+    // 按字节比较合并完全相同的顶点，保持首次出现的顺序
+    static void JoinIdenticalVertices(vector<Vertex> &vertices, vector<unsigned int> &indices)
+    {
+        unordered_map<size_t, vector<unsigned int>> buckets;
+        buckets.reserve(vertices.size());
+        vector<unsigned int> remap(vertices.size());
+        vector<Vertex> unique;
+        unique.reserve(vertices.size());
+        for (size_t i = 0; i < vertices.size(); i++) {
+            vector<unsigned int> &bucket = buckets[HashVertex(vertices[i])];
+            unsigned int target = (unsigned int) unique.size();
+            for (unsigned int candidate : bucket) {
+                if (memcmp(&unique[candidate], &vertices[i], sizeof(Vertex)) == 0) {
+                    target = candidate;
+                    break;
+                }
+            }
+            if (target == unique.size()) {
+                bucket.push_back(target);
+                unique.push_back(vertices[i]);
+            }
+            remap[i] = target;
+        }
+        for (unsigned int &index : indices)
+            index = remap[index];
+        vertices.swap(unique);
+    }
+
+    // Tom Forsyth, "Linear-Speed Vertex Cache Optimisation"
+    static void OptimizeVertexCache(vector<unsigned int> &indices, size_t vertexCount)
+    {
+        size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0) return;
+
+        // 每个顶点相邻的三角形列表
+        vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+        for (unsigned int index : indices) adjacencyOffsets[index + 1]++;
+        for (size_t i = 0; i < vertexCount; i++) adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+        vector<uint32_t> adjacency(indices.size());
+        vector<uint32_t> remaining(vertexCount, 0);
+        for (size_t t = 0; t < triangleCount; t++) {
+            for (int k = 0; k < 3; k++) {
+                unsigned int v = indices[t * 3 + k];
+                adjacency[adjacencyOffsets[v] + remaining[v]++] = (uint32_t) t;
+            }
+        }
+
+        vector<int> cachePosition(vertexCount, -1);
+        vector<float> vertexScores(vertexCount);
+        for (size_t v = 0; v < vertexCount; v++) vertexScores[v] = VertexScore(-1, remaining[v]);
+        vector<float> triangleScores(triangleCount);
+        for (size_t t = 0; t < triangleCount; t++) {
+            triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+        }
+
+        vector<bool> emitted(triangleCount, false);
+        vector<unsigned int> output;
+        output.reserve(indices.size());
+        unsigned int cache[MESH_OPTIMIZER_CACHE_SIZE + 3];
+        int cacheCount = 0;
+        size_t deadEndCursor = 0;
+        int64_t best = -1;
+
+        while (output.size() < indices.size()) {
+            if (best < 0) {
+                // cache 中没有可用的三角形，按顺序取下一个未输出的三角形
+                while (emitted[deadEndCursor]) deadEndCursor++;
+                best = (int64_t) deadEndCursor;
+            }
+            size_t t = (size_t) best;
+            emitted[t] = true;
+
+            // 输出三角形，三个顶点移到 LRU 头部
+            unsigned int newCache[MESH_OPTIMIZER_CACHE_SIZE + 3];
+            int newCount = 0;
+            for (int k = 0; k < 3; k++) {
+                unsigned int v = indices[t * 3 + k];
+                output.push_back(v);
+                newCache[newCount++] = v;
+                // 从相邻列表中移除该三角形
+                uint32_t *pBegin = &adjacency[adjacencyOffsets[v]];
+                uint32_t *pEnd = pBegin + remaining[v];
+                uint32_t *pFound = std::find(pBegin, pEnd, (uint32_t) t);
+                if (pFound != pEnd) {
+                    *pFound = *(pEnd - 1);
+                    remaining[v]--;
+                }
+            }
+            for (int i = 0; i < cacheCount; i++) {
+                unsigned int v = cache[i];
+                if (v != newCache[0] && v != newCache[1] && v != newCache[2]) newCache[newCount++] = v;
+            }
+
+            // 更新 cache 内和被挤出的顶点的分数，并在 cache 顶点相邻的三角形中选出下一个
+            for (int i = 0; i < newCount; i++) {
+                unsigned int v = newCache[i];
+                cachePosition[v] = i < MESH_OPTIMIZER_CACHE_SIZE ? i : -1;
+            }
+            for (int i = 0; i < newCount; i++) {
+                unsigned int v = newCache[i];
+                float score = VertexScore(cachePosition[v], remaining[v]);
+                float delta = score - vertexScores[v];
+                vertexScores[v] = score;
+                const uint32_t *pAdjacent = &adjacency[adjacencyOffsets[v]];
+                for (uint32_t j = 0; j < remaining[v]; j++) triangleScores[pAdjacent[j]] += delta;
+            }
+            best = -1;
+            float bestScore = -1.0f;
+            for (int i = 0; i < newCount && i < MESH_OPTIMIZER_CACHE_SIZE; i++) {
+                unsigned int v = newCache[i];
+                const uint32_t *pAdjacent = &adjacency[adjacencyOffsets[v]];
+                for (uint32_t j = 0; j < remaining[v]; j++) {
+                    if (triangleScores[pAdjacent[j]] > bestScore) {
+                        bestScore = triangleScores[pAdjacent[j]];
+                        best = pAdjacent[j];
+                    }
+                }
+            }
+            cacheCount = std::min(newCount, MESH_OPTIMIZER_CACHE_SIZE);
+            memcpy(cache, newCache, cacheCount * sizeof(unsigned int));
+        }
+        indices.swap(output);
+    }
+
+    // Sander et al. "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw" 的简化版：
+    // 在 cache 优化后的顺序上，于 cache 基本失效（至少两个顶点未命中）的位置切分成簇，切分处重排只损失很少的命中，
+    // 簇按 dot(簇中心 - 网格中心, 簇法线) 从大到小排列，外侧朝外的簇先画，深度测试能剔除更多被遮挡的片段
+    static void OptimizeOverdraw(vector<unsigned int> &indices, const vector<Vertex> &vertices)
+    {
+        size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0) return;
+
+        glm::vec3 meshCenter(0.0f);
+        for (const Vertex &vertex : vertices) meshCenter += vertex.Position;
+        meshCenter /= (float) std::max<size_t>(vertices.size(), 1);
+
+        vector<size_t> clusterStarts;
+        vector<int64_t> timestamps(vertices.size(), INT64_MIN / 2);
+        int64_t time = 0;
+        for (size_t t = 0; t < triangleCount; t++) {
+            int misses = 0;
+            for (int k = 0; k < 3; k++) {
+                unsigned int v = indices[t * 3 + k];
+                if (time - timestamps[v] > MESH_OPTIMIZER_ACMR_CACHE_SIZE) {
+                    timestamps[v] = time++;
+                    misses++;
+                }
+            }
+            if (t == 0 || misses == 3 || (misses == 2 && t - clusterStarts.back() >= MESH_OPTIMIZER_MIN_CLUSTER_SIZE))
+                clusterStarts.push_back(t);
+        }
+        clusterStarts.push_back(triangleCount);
+
+        size_t clusterCount = clusterStarts.size() - 1;
+        vector<float> sortKeys(clusterCount);
+        for (size_t c = 0; c < clusterCount; c++) {
+            glm::vec3 center(0.0f), normal(0.0f);
+            float area = 0.0f;
+            for (size_t t = clusterStarts[c]; t < clusterStarts[c + 1]; t++) {
+                const glm::vec3 &p0 = vertices[indices[t * 3]].Position;
+                const glm::vec3 &p1 = vertices[indices[t * 3 + 1]].Position;
+                const glm::vec3 &p2 = vertices[indices[t * 3 + 2]].Position;
+                glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+                float triangleArea = glm::length(n);
+                center += (p0 + p1 + p2) * (triangleArea / 3.0f);
+                normal += n;
+                area += triangleArea;
+            }
+            if (area > 0.0f) center /= area;
+            float normalLength = glm::length(normal);
+            sortKeys[c] = normalLength > 0.0f ? glm::dot(center - meshCenter, normal / normalLength) : 0.0f;
+        }
+
+        vector<size_t> order(clusterCount);
+        for (size_t c = 0; c < clusterCount; c++) order[c] = c;
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return sortKeys[a] > sortKeys[b];
+        });
+
+        vector<unsigned int> output;
+        output.reserve(indices.size());
+        for (size_t c : order) {
+            output.insert(output.end(), indices.begin() + clusterStarts[c] * 3, indices.begin() + clusterStarts[c + 1] * 3);
+        }
+        indices.swap(output);
+    }
+
+    // 顶点按索引中首次出现的顺序重排，未被引用的顶点丢弃
+    static void OptimizeVertexFetch(vector<Vertex> &vertices, vector<unsigned int> &indices)
+    {
+        vector<unsigned int> remap(vertices.size(), UINT32_MAX);
+        vector<Vertex> output;
+        output.reserve(vertices.size());
+        for (unsigned int &index : indices) {
+            if (remap[index] == UINT32_MAX) {
+                remap[index] = (unsigned int) output.size();
+                output.push_back(vertices[index]);
+            }
+            index = remap[index];
+        }
+        vertices.swap(output);
+    }
+
+private:
+    static size_t HashVertex(const Vertex &vertex)
+    {
+        const uint8_t *p = (const uint8_t *) &vertex;
+        uint64_t hash = 14695981039346656037ULL;
+        for (size_t i = 0; i < sizeof(Vertex); i++) hash = (hash ^ p[i]) * 1099511628211ULL;
+        return (size_t) hash;
+    }
+
+    static float VertexScore(int cachePosition, uint32_t remainingTriangles)
+    {
+        if (remainingTriangles == 0) return -1.0f;
+        float score = 0.0f;
+        if (cachePosition >= 0) {
+            // 刚用过的三个顶点分数固定，避免总是选刚输出三角形的相邻三角形而形成长条
+            if (cachePosition < 3) {
+                score = 0.75f;
+            } else {
+                float scaler = 1.0f / (MESH_OPTIMIZER_CACHE_SIZE - 3);
+                score = powf(1.0f - (cachePosition - 3) * scaler, 1.5f);
+            }
+        }
+        // 剩余三角形少的顶点优先处理，避免留下孤立的三角形
+        score += 2.0f * powf((float) remainingTriangles, -0.5f);
+        return score;
+    }
+};
+
+#endif
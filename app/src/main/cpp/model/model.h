@@ -12,9 +12,13 @@
 #include <sstream>
 #include <iostream>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <opencv2/opencv.hpp>
 #include "mesh.h"
+#include "mesh_cache.h"
+#include "mesh_optimizer.h"
+#include "texture_loader.h"
 #include "LogUtil.h"
 
 using namespace std;
@@ -26,17 +30,24 @@ class Model
 public:
     /*  Model Data */
     vector<Texture> textures_loaded;	// stores all the textures loaded so far, optimization to make sure textures aren't loaded more than once.
+    unordered_map<string, size_t> textures_index;	// texture path -> index in textures_loaded
     vector<Mesh> meshes;
     string directory;
     glm::vec3 maxXyz, minXyz;
     bool gammaCorrection;
     bool hasTexture;
+    bool packedVertices;	// upload meshes with the compact PackedVertex layout, see mesh.h
+    unsigned int optimizeFlags;	// MESH_OPTIMIZE_* passes applied to imported meshes, see mesh_optimizer.h
 
     /*  Functions   */
     // constructor, expects a filepath to a 3D model.
-    Model(string const &path, bool gamma = false) :
+    // packed only changes the GPU copy, shaders that read attribute 4 (bitangent) need the float layout.
+    // optimize selects the mesh optimizer passes, the optimized meshes are what ends up in the binary mesh cache.
+    Model(string const &path, bool gamma = false, bool packed = false, unsigned int optimize = MESH_OPTIMIZE_DEFAULT) :
     gammaCorrection(gamma),
-    hasTexture(false)
+    hasTexture(false),
+    packedVertices(packed),
+    optimizeFlags(optimize)
     {
         loadModel(path);
     }
@@ -63,6 +74,16 @@ public:
         return (minXyz + maxXyz) / 2.0f;
     }
 
+    // GPU vertex and index buffer sizes of all meshes
+    void GetBufferBytes(size_t &vertexBytes, size_t &indexBytes)
+    {
+        vertexBytes = indexBytes = 0;
+        for (Mesh &mesh : meshes) {
+            vertexBytes += mesh.vertexBytes;
+            indexBytes += mesh.indexBytes;
+        }
+    }
+
     bool ContainsTextures()
     {
         return hasTexture;
@@ -76,10 +97,25 @@ public:
     }
 
 private:
+    TextureLoader textureLoader;
+
     /*  Functions   */
     // loads a model with supported ASSIMP extensions from file and stores the resulting meshes in the meshes vector.
     void loadModel(string const &path)
     {
+        // retrieve the directory path of the filepath
+        directory = path.substr(0, path.find_last_of('/'));
+
+        // a valid binary mesh cache next to the asset skips Assimp parsing entirely
+        long long t0 = GetSysCurrentTimeNs();
+        if (loadFromCache(path))
+        {
+            hasTexture = textureLoader.Flush() > 0;
+            LOGCATI("Model::loadModel from cache, path=%s, meshes=%d, cost=%.3fms", path.c_str(), (int) meshes.size(), (GetSysCurrentTimeNs() - t0) / 1e6);
+            logBufferBytes();
+            return;
+        }
+
         // read file via ASSIMP
         Assimp::Importer importer;
         const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_CalcTangentSpace);
@@ -91,11 +127,42 @@ private:
             return;
         }
         DEBUG_LOGCATE();
-        // retrieve the directory path of the filepath
-        directory = path.substr(0, path.find_last_of('/'));
 
         // process ASSIMP's root node recursively
         processNode(scene->mRootNode, scene);
+        // all material textures are decoded in parallel and uploaded once the meshes are known
+        hasTexture = textureLoader.Flush() > 0;
+        LOGCATI("Model::loadModel from assimp, path=%s, meshes=%d, cost=%.3fms", path.c_str(), (int) meshes.size(), (GetSysCurrentTimeNs() - t0) / 1e6);
+        logBufferBytes();
+
+        MeshCache::Write(path, meshes, minXyz, maxXyz, optimizeFlags);
+    }
+
+    void logBufferBytes()
+    {
+        size_t vertexBytes = 0, indexBytes = 0;
+        GetBufferBytes(vertexBytes, indexBytes);
+        LOGCATI("Model::loadModel packed=%d, vertexBytes=%zu, indexBytes=%zu", packedVertices, vertexBytes, indexBytes);
+    }
+
+    bool loadFromCache(string const &path)
+    {
+        MeshCacheReader reader;
+        if (!reader.Open(path, optimizeFlags))
+            return false;
+
+        const MeshCacheHeader &header = reader.GetHeader();
+        minXyz = glm::vec3(header.minXyz[0], header.minXyz[1], header.minXyz[2]);
+        maxXyz = glm::vec3(header.maxXyz[0], header.maxXyz[1], header.maxXyz[2]);
+        // vertex and index arrays are uploaded straight from the mapping, nothing is kept on the CPU
+        for (const MeshCacheMeshView &view : reader.GetMeshes())
+        {
+            vector<Texture> textures;
+            for (const MeshCacheTextureRef &ref : view.textures)
+                textures.push_back(loadTexture(ref.path.c_str(), ref.type));
+            meshes.push_back(Mesh(view.pVertices, view.vertexCount, view.pIndices, view.indexCount, textures, packedVertices));
+        }
+        return true;
     }
 
     // processes a node in a recursive fashion. Processes each individual mesh located at the node and repeats this process on its children nodes (if any).
@@ -207,8 +274,19 @@ private:
         std::vector<Texture> heightMaps = loadMaterialTextures(material, aiTextureType_AMBIENT, "texture_height");
         textures.insert(textures.end(), heightMaps.begin(), heightMaps.end());
         
+        // Assimp emits one vertex per face corner for most formats; merge them and reorder for the GPU caches
+        if (optimizeFlags != 0)
+        {
+            MeshOptimizeStats stats;
+            long long t0 = GetSysCurrentTimeNs();
+            MeshOptimizer::Optimize(vertices, indices, optimizeFlags, stats);
+            LOGCATI("Model::processMesh optimize flags=0x%x, triangles=%d, vertices %d -> %d, ACMR %.3f -> %.3f, cost=%.3fms",
+                    optimizeFlags, (int) (indices.size() / 3), (int) stats.vertexCountBefore, (int) stats.vertexCountAfter,
+                    stats.acmrBefore, stats.acmrAfter, (GetSysCurrentTimeNs() - t0) / 1e6);
+        }
+
         // return a mesh object created from the extracted mesh data
-        return Mesh(vertices, indices, textures);
+        return Mesh(vertices, indices, textures, packedVertices);
     }
 
     // checks all material textures of a given type and loads the textures if they're not loaded yet.
@@ -221,68 +299,27 @@ private:
         {
             aiString str;
             mat->GetTexture(type, i, &str);
-            // check if texture was loaded before and if so, continue to next iteration: skip loading a new texture
-            bool skip = false;
-            for(unsigned int j = 0; j < textures_loaded.size(); j++)
-            {
-                if(std::strcmp(textures_loaded[j].path.data(), str.C_Str()) == 0)
-                {
-                    textures.push_back(textures_loaded[j]);
-                    skip = true; // a texture with the same filepath has already been loaded, continue to next one. (optimization)
-                    break;
-                }
-            }
-            if(!skip)
-            {   // if texture hasn't been loaded already, load it
-                Texture texture;
-                texture.id = TextureFromFile(str.C_Str(), this->directory);
-                texture.type = typeName;
-                texture.path = str.C_Str();
-                textures.push_back(texture);
-                textures_loaded.push_back(texture);  // store it as texture loaded for entire model, to ensure we won't unnecesery load duplicate textures.
-            }
+            textures.push_back(loadTexture(str.C_Str(), typeName));
         }
         return textures;
     }
 
-    unsigned int TextureFromFile(const char *path, const string &directory, bool gamma = false)
+    Texture loadTexture(const char *path, const string &typeName)
     {
-        string filename = string(path);
-        filename = directory + '/' + filename;
-
-        unsigned int textureID;
-        glGenTextures(1, &textureID);
-
-        int width, height, nrComponents;
-        unsigned char *data = nullptr;
-
-        // load the texture using OpenCV
-        LOGCATE("TextureFromFile Loading texture %s", filename.c_str());
-        cv::Mat textureImage = cv::imread(filename);
-        if (!textureImage.empty())
-        {
-            hasTexture = true;
-            // opencv reads textures in BGR format, change to RGB for GL
-            cv::cvtColor(textureImage, textureImage, CV_BGR2RGB);
-            // opencv reads image from top-left, while GL expects it from bottom-left
-            // vertically flip the image
-            //cv::flip(textureImage, textureImage, 0);
-
-            glBindTexture(GL_TEXTURE_2D, textureID);
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, textureImage.cols,
-                         textureImage.rows, 0, GL_RGB, GL_UNSIGNED_BYTE,
-                         textureImage.data);
-            glGenerateMipmap(GL_TEXTURE_2D);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-            GO_CHECK_GL_ERROR();
-        } else {
-            LOGCATE("TextureFromFile Texture failed to load at path: %s", path);
-        }
+        // check if texture was loaded before and if so, skip loading a new texture
+        unordered_map<string, size_t>::iterator it = textures_index.find(path);
+        if (it != textures_index.end())
+            return textures_loaded[it->second];  // a texture with the same filepath has already been loaded (optimization)
 
-        return textureID;
+        // if texture hasn't been loaded already, request it; the texture name is valid right away,
+        // its contents are filled in by textureLoader.Flush()
+        Texture texture;
+        texture.id = textureLoader.Request(this->directory + '/' + path);
+        texture.type = typeName;
+        texture.path = path;
+        textures_index[texture.path] = textures_loaded.size();
+        textures_loaded.push_back(texture);  // store it as texture loaded for entire model, to ensure we won't unnecesery load duplicate textures.
+        return texture;
     }
 };
 
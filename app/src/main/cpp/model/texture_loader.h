@@ -0,0 +1,172 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef TEXTURE_LOADER_H
+#define TEXTURE_LOADER_H
+
+#include <GLES3/gl3.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "ThreadPool.h"
+#include "LogUtil.h"
+
+// 一批上传的解码后字节数上限，避免大贴图全部解码后同时驻留内存
+#define TEXTURE_LOADER_BATCH_BYTES (64 * 1024 * 1024)
+
+// 纹理在 PBO 中的起始偏移对齐
+#define TEXTURE_LOADER_PBO_ALIGN 16
+
+struct PendingTexture {
+    unsigned int id;
+    string filename;
+    cv::Mat image;      // imread 解码结果（BGR），写入 PBO 后释放
+    int width;          // 解码失败时为 0
+    int height;
+    size_t pboOffset;
+};
+
+/**
+ * 模型贴图的批量加载：Request 只分配纹理名，网格可以先拿到 id；
+ * Flush 时按批在 ThreadPool 上并行 imread，在 GL 线程映射一个 PBO，
+ * 再并行把 BGR 转成 RGB 直接写进映射的 PBO，最后从 PBO 偏移 glTexImage2D 并生成 mipmap。
+ * Request 和 Flush 需在持有 GL 上下文的线程调用。
+ */
+class TextureLoader {
+public:
+    TextureLoader() : m_PboId(GL_NONE), m_PboSize(0) {}
+
+    unsigned int Request(const string &filename)
+    {
+        PendingTexture texture;
+        glGenTextures(1, &texture.id);
+        texture.filename = filename;
+        texture.width = 0;
+        texture.height = 0;
+        texture.pboOffset = 0;
+        m_Pending.push_back(texture);
+        return texture.id;
+    }
+
+    // 加载所有已请求的纹理，返回成功的个数
+    int Flush()
+    {
+        if (m_Pending.empty()) return 0;
+        long long t0 = GetSysCurrentTimeNs();
+        int loaded = 0;
+        int batchCount = 0;
+        int threadCount = ThreadPool::GetInstance()->GetThreadCount();
+        size_t begin = 0;
+        while (begin < m_Pending.size()) {
+            // 每次并行解码 threadCount 张，累计超过字节预算后整批上传
+            size_t end = begin;
+            size_t bytes = 0;
+            while (end < m_Pending.size() && bytes < TEXTURE_LOADER_BATCH_BYTES) {
+                size_t next = std::min(m_Pending.size(), end + (size_t) threadCount);
+                Decode(end, next);
+                for (; end < next; ++end) bytes += GetImageBytes(m_Pending[end]);
+            }
+            loaded += Upload(begin, end);
+            begin = end;
+            batchCount++;
+        }
+        if (m_PboId != GL_NONE) {
+            glDeleteBuffers(1, &m_PboId);
+            m_PboId = GL_NONE;
+            m_PboSize = 0;
+        }
+        LOGCATI("TextureLoader::Flush textures=%d, loaded=%d, batches=%d, threads=%d, cost=%.3fms", (int) m_Pending.size(),
+                loaded, batchCount, threadCount, (GetSysCurrentTimeNs() - t0) / 1e6);
+        m_Pending.clear();
+        return loaded;
+    }
+
+private:
+    static size_t GetImageBytes(const PendingTexture &texture)
+    {
+        return (size_t) texture.width * texture.height * 3;
+    }
+
+    void Decode(size_t begin, size_t end)
+    {
+        ThreadPool::GetInstance()->ParallelFor((int) (end - begin), 1, [&](int first, int last) {
+            for (int i = first; i < last; ++i) {
+                PendingTexture &texture = m_Pending[begin + i];
+                texture.image = cv::imread(texture.filename);
+                if (texture.image.empty() || texture.image.type() != CV_8UC3) {
+                    LOGCATE("TextureLoader::Decode Texture failed to load at path: %s", texture.filename.c_str());
+                    texture.image.release();
+                    continue;
+                }
+                texture.width = texture.image.cols;
+                texture.height = texture.image.rows;
+            }
+        });
+    }
+
+    int Upload(size_t begin, size_t end)
+    {
+        size_t size = 0;
+        for (size_t i = begin; i < end; ++i) {
+            m_Pending[i].pboOffset = size;
+            size += (GetImageBytes(m_Pending[i]) + TEXTURE_LOADER_PBO_ALIGN - 1) & ~(size_t) (TEXTURE_LOADER_PBO_ALIGN - 1);
+        }
+        if (size == 0) return 0;
+
+        if (m_PboId == GL_NONE) glGenBuffers(1, &m_PboId);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_PboId);
+        if (size > m_PboSize) {
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+            m_PboSize = size;
+        }
+        uint8_t *pMapped = (uint8_t *) glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size,
+                                                        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        if (pMapped == nullptr) {
+            LOGCATE("TextureLoader::Upload glMapBufferRange fail, size=%zu", size);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, GL_NONE);
+            return 0;
+        }
+
+        // OpenCV 解码为 BGR，转成 RGB 时直接写入映射的 PBO，省去一次拷贝
+        ThreadPool::GetInstance()->ParallelFor((int) (end - begin), 1, [&](int first, int last) {
+            for (int i = first; i < last; ++i) {
+                PendingTexture &texture = m_Pending[begin + i];
+                if (texture.width == 0) continue;
+                cv::Mat rgb(texture.height, texture.width, CV_8UC3, pMapped + texture.pboOffset);
+                cv::cvtColor(texture.image, rgb, CV_BGR2RGB);
+                texture.image.release();
+            }
+        });
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+        int loaded = 0;
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (size_t i = begin; i < end; ++i) {
+            PendingTexture &texture = m_Pending[i];
+            if (texture.width == 0) continue;
+            glBindTexture(GL_TEXTURE_2D, texture.id);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, texture.width, texture.height, 0, GL_RGB, GL_UNSIGNED_BYTE,
+                         (const void *) texture.pboOffset);
+            glGenerateMipmap(GL_TEXTURE_2D);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            loaded++;
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindTexture(GL_TEXTURE_2D, GL_NONE);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, GL_NONE);
+        GO_CHECK_GL_ERROR();
+        return loaded;
+    }
+
+    vector<PendingTexture> m_Pending;
+    GLuint m_PboId;
+    size_t m_PboSize;
+};
+
+#endif
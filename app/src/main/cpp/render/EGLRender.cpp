@@ -620,7 +620,7 @@ void EGLRender::SetIntParams(int paramType, int param)
 
 void EGLRender::Draw()
 {
-	LOGCATE("EGLRender::Draw");
+	LOGCATV("EGLRender::Draw");
 	if (m_ProgramObj == GL_NONE) return;
 	glViewport(0, 0, m_RenderImage.width, m_RenderImage.height);
 
@@ -698,6 +698,8 @@ void EGLRender::UnInit()
 
 	if (m_IsGLContextReady)
 	{
+		//离屏上下文不与主 surface 共享，program 名会与主上下文重复，销毁前丢弃它的 uniform 缓存
+		UniformLocationCache::InvalidateContext(m_eglCtx);
 		DestroyGlesEnv();
 		m_IsGLContextReady = false;
 	}
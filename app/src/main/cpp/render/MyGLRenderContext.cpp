@@ -6,81 +6,30 @@
  *
  * */
 
-#include <TriangleSample.h>
-#include <TextureMapSample.h>
-#include <NV21TextureMapSample.h>
-#include <VaoSample.h>
-#include <FBOSample.h>
-#include <FBOLegLengthenSample.h>
-#include <CoordSystemSample.h>
-#include <BasicLightingSample.h>
-#include <TransformFeedbackSample.h>
-#include <MultiLightsSample.h>
-#include <DepthTestingSample.h>
-#include <InstancingSample.h>
-#include <Instancing3DSample.h>
-#include <StencilTestingSample.h>
-#include <BlendingSample.h>
-#include <ParticlesSample.h>
-#include <Noise3DSample.h>
-#include <SkyBoxSample.h>
-#include <Model3DSample.h>
-#include <PBOSample.h>
-#include <BeatingHeartSample.h>
-#include <CloudSample.h>
-#include <TimeTunnelSample.h>
-#include <BezierCurveSample.h>
-#include <BigEyesSample.h>
-#include <FaceSlenderSample.h>
-#include <BigHeadSample.h>
-#include <RotaryHeadSample.h>
-#include <VisualizeAudioSample.h>
-#include <ScratchCardSample.h>
-#include <AvatarSample.h>
-#include <ShockWaveSample.h>
-#include <MRTSample.h>
-#include <FBOBlitSample.h>
-#include <TextureBufferSample.h>
-#include <UniformBufferSample.h>
-#include <RGB2YUYVSample.h>
-#include <SharedEGLContextSample.h>
-#include <TextRenderSample.h>
-#include <PortraitStayColorExample.h>
-#include <GLTransitionExample.h>
-#include <GLTransitionExample_2.h>
-#include <GLTransitionExample_3.h>
-#include <GLTransitionExample_4.h>
-#include <ConveyorBeltExample.h>
-#include <RGB2NV21Sample.h>
-#include <RGB2I420Sample.h>
-#include <RGB2I444Sample.h>
-#include <CopyTextureExample.h>
-#include <BlitFrameBufferExample.h>
-#include <BinaryProgramExample.h>
-#include <Render16BitGraySample.h>
 #include "MyGLRenderContext.h"
 #include "LogUtil.h"
-#include "RenderP010Sample.h"
-#include "RenderNV21Sample.h"
-#include "RenderI420Sample.h"
-#include "RenderI444Sample.h"
-#include "RenderYUYVSample.h"
-#include "ComputeShaderSample.h"
-//#include "ComputeShader2Sample.h"
-#include "PortraitModeSample.h"
-#include "MultiSampleAntiAliasingSample.h"
-#include "FullScreenTriangleSample.h"
-#include "GeometryShaderSample.h"
-#include "GeometryShader2Sample.h"
-#include "GeometryShader3Sample.h"
-//#include "HardwareBufferExample.h"
+#include "SampleRegistry.h"
+#include "AsyncProgramBuilder.h"
+#include "FrameProfiler.h"
+#include "TraceRecorder.h"
+#include "UniformLocationCache.h"
+#include "ComputeYuvConverter.h"
+#include "AsyncLogger.h"
 
 MyGLRenderContext* MyGLRenderContext::m_pContext = nullptr;
 
 MyGLRenderContext::MyGLRenderContext()
 {
-	m_pCurSample = new BeatingHeartSample();
-	m_pBeforeSample = nullptr;
+	m_CurSampleType = SAMPLE_TYPE_KEY_BEATING_HEART;
+	m_pCurSample = SampleRegistry::CreateSample(m_CurSampleType);
+	m_CurSampleName = GetSampleName(m_CurSampleType);
+	m_FramesSinceSwitch = 0;
+	// 上一个上下文的 DestroyInstance 会关闭异步日志，重新创建时恢复
+	AsyncLogger::GetInstance();
+#ifndef NDEBUG
+	// Debug 包默认开启逐帧统计，Release 包需要时手动打开
+	FrameProfiler::GetInstance()->SetEnabled(true);
+#endif
 }
 
 MyGLRenderContext::~MyGLRenderContext()
@@ -91,12 +40,16 @@ MyGLRenderContext::~MyGLRenderContext()
 		m_pCurSample = nullptr;
 	}
 
-	if (m_pBeforeSample)
+	for (auto &retired : m_RetiredSamples)
 	{
-		delete m_pBeforeSample;
-		m_pBeforeSample = nullptr;
+		delete retired.pSample;
 	}
+	m_RetiredSamples.clear();
 
+	ImageBufferPool::GetInstance()->DumpStats();
+	ImageBufferPool::GetInstance()->Trim();
+	AsyncProgramBuilder::DestroyInstance();
+	FrameProfiler::DestroyInstance();
 }
 
 
@@ -106,204 +59,55 @@ void MyGLRenderContext::SetParamsInt(int paramType, int value0, int value1)
 
 	if (paramType == SAMPLE_TYPE)
 	{
-		m_pBeforeSample = m_pCurSample;
-
-		LOGCATE("MyGLRenderContext::SetParamsInt 0 m_pBeforeSample = %p", m_pBeforeSample);
+		std::unique_lock<std::mutex> lock(m_SampleMutex);
+		if (m_pCurSample)
+		{
+			m_RetiredSamples.push_back({m_CurSampleType, m_pCurSample});
+		}
 
-		switch (value0)
+		// 优先复用已初始化的实例：尚未回收的、LRU 中的，最后才新建
+		m_pCurSample = nullptr;
+		bool cacheable = !(SampleRegistry::GetFlags(value0) & SAMPLE_FLAG_NO_CACHE);
+		for (auto iter = m_RetiredSamples.begin(); cacheable && iter != m_RetiredSamples.end(); ++iter)
 		{
-			case SAMPLE_TYPE_KEY_TRIANGLE:
-				m_pCurSample = new TriangleSample();
-				break;
-			case SAMPLE_TYPE_KEY_TEXTURE_MAP:
-				m_pCurSample = new TextureMapSample();
-				break;
-			case SAMPLE_TYPE_KEY_YUV_TEXTURE_MAP:
-				m_pCurSample = new NV21TextureMapSample();
-				break;
-			case SAMPLE_TYPE_KEY_VAO:
-				m_pCurSample = new VaoSample();
-				break;
-			case SAMPLE_TYPE_KEY_FBO:
-				m_pCurSample = new FBOSample();
-				break;
-			case SAMPLE_TYPE_KEY_FBO_LEG_LENGTHEN:
-				m_pCurSample = new FBOLegLengthenSample();
-				break;
-			case SAMPLE_TYPE_KEY_COORD_SYSTEM:
-				m_pCurSample = new CoordSystemSample();
-				break;
-			case SAMPLE_TYPE_KEY_BASIC_LIGHTING:
-				m_pCurSample = new BasicLightingSample();
-				break;
-			case SAMPLE_TYPE_KEY_TRANSFORM_FEEDBACK:
-				m_pCurSample = new TransformFeedbackSample();
-				break;
-			case SAMPLE_TYPE_KEY_MULTI_LIGHTS:
-				m_pCurSample = new MultiLightsSample();
-				break;
-			case SAMPLE_TYPE_KEY_DEPTH_TESTING:
-				m_pCurSample = new DepthTestingSample();
-				break;
-			case SAMPLE_TYPE_KEY_INSTANCING:
-				m_pCurSample = new Instancing3DSample();
-				break;
-			case SAMPLE_TYPE_KEY_STENCIL_TESTING:
-				m_pCurSample = new StencilTestingSample();
-				break;
-			case SAMPLE_TYPE_KEY_BLENDING:
-				m_pCurSample = new BlendingSample();
-				break;
-			case SAMPLE_TYPE_KEY_PARTICLES:
-				m_pCurSample = new ParticlesSample();
-				break;
-			case SAMPLE_TYPE_KEY_SKYBOX:
-				m_pCurSample = new SkyBoxSample();
-				break;
-			case SAMPLE_TYPE_KEY_3D_MODEL:
-				m_pCurSample = new Model3DSample();
-				break;
-			case SAMPLE_TYPE_KEY_PBO:
-				m_pCurSample = new PBOSample();
-				break;
-            case SAMPLE_TYPE_KEY_BEATING_HEART:
-                m_pCurSample = new BeatingHeartSample();
-                break;
-            case SAMPLE_TYPE_KEY_CLOUD:
-                m_pCurSample = new CloudSample();
-                break;
-			case SAMPLE_TYPE_KEY_TIME_TUNNEL:
-				m_pCurSample = new TimeTunnelSample();
-				break;
-			case SAMPLE_TYPE_KEY_BEZIER_CURVE:
-				m_pCurSample = new BezierCurveSample();
-				break;
-            case SAMPLE_TYPE_KEY_BIG_EYES:
-                m_pCurSample = new BigEyesSample();
-                break;
-			case SAMPLE_TYPE_KEY_FACE_SLENDER:
-				m_pCurSample = new FaceSlenderSample();
-				break;
-			case SAMPLE_TYPE_KEY_BIG_HEAD:
-				m_pCurSample = new BigHeadSample();
-				break;
-			case SAMPLE_TYPE_KEY_RATARY_HEAD:
-				m_pCurSample = new RotaryHeadSample();
-				break;
-			case SAMPLE_TYPE_KEY_VISUALIZE_AUDIO:
-				m_pCurSample = new VisualizeAudioSample();
-				break;
-			case SAMPLE_TYPE_KEY_SCRATCH_CARD:
-				m_pCurSample = new ScratchCardSample();
-				break;
-            case SAMPLE_TYPE_KEY_AVATAR:
-                m_pCurSample = new AvatarSample();
-                break;
-			case SAMPLE_TYPE_KEY_SHOCK_WAVE:
-				m_pCurSample = new ShockWaveSample();
-				break;
-			case SAMPLE_TYPE_KEY_MRT:
-				m_pCurSample = new MRTSample();
-				break;
-			case SAMPLE_TYPE_KEY_FBO_BLIT:
-				m_pCurSample = new FBOBlitSample();
-				break;
-            case SAMPLE_TYPE_KEY_TBO:
-                m_pCurSample = new TextureBufferSample();
-                break;
-			case SAMPLE_TYPE_KEY_UBO:
-				m_pCurSample = new UniformBufferSample();
-				break;
-			case SAMPLE_TYPE_KEY_RGB2YUYV:
-				m_pCurSample = new RGB2YUYVSample();
-				break;
-			case SAMPLE_TYPE_KEY_MULTI_THREAD_RENDER:
-				m_pCurSample = new SharedEGLContextSample();
-				break;
-			case SAMPLE_TYPE_KEY_TEXT_RENDER:
-				m_pCurSample = new TextRenderSample();
-				break;
-			case SAMPLE_TYPE_KEY_STAY_COLOR:
-				m_pCurSample = new PortraitStayColorExample();
-				break;
-			case SAMPLE_TYPE_KEY_TRANSITIONS_1:
-				m_pCurSample = new GLTransitionExample();
-				break;
-			case SAMPLE_TYPE_KEY_TRANSITIONS_2:
-				m_pCurSample = new GLTransitionExample_2();
-				break;
-			case SAMPLE_TYPE_KEY_TRANSITIONS_3:
-				m_pCurSample = new GLTransitionExample_3();
-				break;
-			case SAMPLE_TYPE_KEY_TRANSITIONS_4:
-				m_pCurSample = new GLTransitionExample_4();
-				break;
-			case SAMPLE_TYPE_KEY_RGB2NV21:
-				m_pCurSample = new RGB2NV21Sample();
-				break;
-            case SAMPLE_TYPE_KEY_RGB2I420:
-                m_pCurSample = new RGB2I420Sample();
-                break;
-			case SAMPLE_TYPE_KEY_RGB2I444:
-				m_pCurSample = new RGB2I444Sample();
-				break;
-			case SAMPLE_TYPE_KEY_COPY_TEXTURE:
-				m_pCurSample = new CopyTextureExample();
-				break;
-            case SAMPLE_TYPE_KEY_BLIT_FRAME_BUFFER:
-                m_pCurSample = new BlitFrameBufferExample();
-                break;
-			case SAMPLE_TYPE_KEY_BINARY_PROGRAM:
-				m_pCurSample = new BinaryProgramExample();
-				break;
-//			case SAMPLE_TYPE_KEY_HWBuffer:
-//				m_pCurSample = new HardwareBufferExample();
-//				break;
-			case SAMPLE_TYPE_KEY_RENDER_16BIT_GRAY:
-				m_pCurSample = new Render16BitGraySample();
-				break;
-            case SAMPLE_TYPE_KEY_RENDER_P010:
-                m_pCurSample = new RenderP010Sample();
-                break;
-			case SAMPLE_TYPE_KEY_RENDER_NV21:
-				m_pCurSample = new RenderNV21Sample();
-				break;
-			case SAMPLE_TYPE_KEY_RENDER_I420:
-				m_pCurSample = new RenderI420Sample();
-				break;
-			case SAMPLE_TYPE_KEY_RENDER_I444:
-				m_pCurSample = new RenderI444Sample();
-				break;
-			case SAMPLE_TYPE_KEY_RENDER_YUYV:
-				m_pCurSample = new RenderYUYVSample();
-				break;
-			case SAMPLE_TYPE_KEY_COMPUTE_SHADER:
-				m_pCurSample = new ComputeShaderSample();
-				break;
-            case SAMPLE_TYPE_KEY_PORTRAIT_MODE:
-                m_pCurSample = new PortraitModeSample();
-                break;
-			case SAMPLE_TYPE_KEY_MSAA:
-				m_pCurSample = new MultiSampleAntiAliasingSample();
-				break;
-			case SAMPLE_TYPE_KEY_FULLSCREEN_TRIANGLE:
-				m_pCurSample = new FullScreenTriangleSample();
-				break;
-            case SAMPLE_TYPE_KEY_GEOMETRY_SHADER:
-                m_pCurSample = new GeometryShaderSample();
-                break;
-            case SAMPLE_TYPE_KEY_GEOMETRY_SHADER2:
-                m_pCurSample = new GeometryShader2Sample();
-                break;
-            case SAMPLE_TYPE_KEY_GEOMETRY_SHADER3:
-                m_pCurSample = new GeometryShader3Sample();
-                break;
-			default:
-			    m_pCurSample = nullptr;
+			if (iter->type == value0)
+			{
+				m_pCurSample = iter->pSample;
+				m_RetiredSamples.erase(iter);
 				break;
+			}
+		}
+		if (m_pCurSample == nullptr && cacheable)
+		{
+			m_pCurSample = m_SampleCache.Take(value0);
 		}
+		if (m_pCurSample == nullptr)
+		{
+			m_pCurSample = SampleRegistry::CreateSample(value0);
+		}
+		m_CurSampleType = value0;
+		m_CurSampleName = GetSampleName(value0);
+		m_PrewarmQueue = SampleRegistry::GetPrewarmCandidates(value0, SAMPLE_PREWARM_COUNT);
+		m_FramesSinceSwitch = 0;
 
-		LOGCATE("MyGLRenderContext::SetParamsInt m_pBeforeSample = %p, m_pCurSample=%p", m_pBeforeSample, m_pCurSample);
+		LOGCATE("MyGLRenderContext::SetParamsInt retired=%d, m_pCurSample=%p", (int) m_RetiredSamples.size(), m_pCurSample);
+	}
+	else if (paramType == SAMPLE_TYPE_SET_TRACE)
+	{
+		if (value0)
+		{
+			TraceRecorder::Start();
+		}
+		else
+		{
+			TraceRecorder::Stop();
+			TraceRecorder::Flush(DEFAULT_TRACE_PATH);
+		}
+	}
+	else if (paramType == SAMPLE_TYPE_SET_YUV_BACKEND)
+	{
+		// RGB2* 样例在 Init 时读取后端且不进 LRU，下次选中时按新后端初始化
+		ComputeYuvConverter::SetBackend(value0 == YUV_BACKEND_COMPUTE ? YUV_BACKEND_COMPUTE : YUV_BACKEND_FRAGMENT);
 	}
 }
 
@@ -347,60 +151,40 @@ void MyGLRenderContext::UpdateTransformMatrix(float rotateX, float rotateY, floa
 
 void MyGLRenderContext::SetImageDataWithIndex(int index, int format, int width, int height, uint8_t *pData)
 {
-	LOGCATE("MyGLRenderContext::SetImageDataWithIndex index=%d, format=%d, width=%d, height=%d, pData=%p", index, format, width, height, pData);
 	NativeImage nativeImage;
 	nativeImage.format = format;
 	nativeImage.width = width;
 	nativeImage.height = height;
-	nativeImage.ppPlane[0] = pData;
-
-	switch (format)
-	{
-		case IMAGE_FORMAT_NV12:
-		case IMAGE_FORMAT_NV21:
-			nativeImage.ppPlane[1] = nativeImage.ppPlane[0] + width * height;
-			break;
-		case IMAGE_FORMAT_I420:
-			nativeImage.ppPlane[1] = nativeImage.ppPlane[0] + width * height;
-			nativeImage.ppPlane[2] = nativeImage.ppPlane[1] + width * height / 4;
-			break;
-		default:
-			break;
-	}
+	NativeImageUtil::AttachNativeImage(&nativeImage, pData);
+	SetImageDataWithIndex(index, &nativeImage);
+}
 
+void MyGLRenderContext::SetImageDataWithIndex(int index, NativeImage *pImage)
+{
+	LOGCATE("MyGLRenderContext::SetImageDataWithIndex index=%d, format=%d, width=%d, height=%d, pData=%p, lineSize=%d", index, pImage->format, pImage->width, pImage->height, pImage->ppPlane[0], pImage->pLineSize[0]);
 	if (m_pCurSample)
 	{
-		m_pCurSample->LoadMultiImageWithIndex(index, &nativeImage);
+		m_pCurSample->LoadMultiImageWithIndex(index, pImage);
 	}
 
 }
 
 void MyGLRenderContext::SetImageData(int format, int width, int height, uint8_t *pData)
 {
-	LOGCATE("MyGLRenderContext::SetImageData format=%d, width=%d, height=%d, pData=%p", format, width, height, pData);
 	NativeImage nativeImage;
 	nativeImage.format = format;
 	nativeImage.width = width;
 	nativeImage.height = height;
-	nativeImage.ppPlane[0] = pData;
-
-	switch (format)
-	{
-		case IMAGE_FORMAT_NV12:
-		case IMAGE_FORMAT_NV21:
-			nativeImage.ppPlane[1] = nativeImage.ppPlane[0] + width * height;
-			break;
-		case IMAGE_FORMAT_I420:
-			nativeImage.ppPlane[1] = nativeImage.ppPlane[0] + width * height;
-			nativeImage.ppPlane[2] = nativeImage.ppPlane[1] + width * height / 4;
-			break;
-		default:
-			break;
-	}
+	NativeImageUtil::AttachNativeImage(&nativeImage, pData);
+	SetImageData(&nativeImage);
+}
 
+void MyGLRenderContext::SetImageData(NativeImage *pImage)
+{
+	LOGCATE("MyGLRenderContext::SetImageData format=%d, width=%d, height=%d, pData=%p, lineSize=%d", pImage->format, pImage->width, pImage->height, pImage->ppPlane[0], pImage->pLineSize[0]);
 	if (m_pCurSample)
 	{
-		m_pCurSample->LoadImage(&nativeImage);
+		m_pCurSample->LoadImage(pImage);
 	}
 
 }
@@ -408,6 +192,8 @@ void MyGLRenderContext::SetImageData(int format, int width, int height, uint8_t
 void MyGLRenderContext::OnSurfaceCreated()
 {
 	LOGCATE("MyGLRenderContext::OnSurfaceCreated");
+	//GLSurfaceView 重建的上下文可能复用旧句柄，旧上下文里的 program 已随之销毁
+	UniformLocationCache::InvalidateContext(eglGetCurrentContext());
 	glClearColor(1.0f,1.0f,1.0f, 1.0f);
 }
 
@@ -421,23 +207,130 @@ void MyGLRenderContext::OnSurfaceChanged(int width, int height)
 
 void MyGLRenderContext::OnDrawFrame()
 {
-	LOGCATE("MyGLRenderContext::OnDrawFrame");
-	glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
+	LOGCATV("MyGLRenderContext::OnDrawFrame");
+	PROFILE_FRAME_BEGIN();
+	{
+		PROFILE_SCOPE("OnDrawFrame");
+		glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
+
+		{ PROFILE_SCOPE("RetireSamples");
+			RetireSamples();
+		}
+
+		if (m_pCurSample)
+		{
+			{ PROFILE_SCOPE("Init");
+				m_pCurSample->Init();
+			}
+			// 每个样例的 Draw 以注册名作为 scope，样例内部的子 scope 嵌套在其下
+			{ PROFILE_SCOPE(m_CurSampleName);
+				m_pCurSample->Draw(m_ScreenW, m_ScreenH);
+			}
+		}
+
+		{ PROFILE_SCOPE("PrewarmNextSample");
+			PrewarmNextSample();
+		}
+	}
+	PROFILE_FRAME_END();
+}
+
+const char *MyGLRenderContext::GetSampleName(int type)
+{
+	const SampleRegistryEntry *pEntry = SampleRegistry::Find(type);
+	return pEntry ? pEntry->name : "UnknownSample";
+}
 
-	if (m_pBeforeSample)
+void MyGLRenderContext::DestroySample(GLSampleBase *pSample)
+{
+	if (pSample)
 	{
-		m_pBeforeSample->Destroy();
-		delete m_pBeforeSample;
-		m_pBeforeSample = nullptr;
+		pSample->Destroy();
+		delete pSample;
 	}
+}
 
-	if (m_pCurSample)
+void MyGLRenderContext::RetireSamples()
+{
+	std::vector<RetiredSample> retiredSamples;
 	{
-		m_pCurSample->Init();
-		m_pCurSample->Draw(m_ScreenW, m_ScreenH);
+		std::unique_lock<std::mutex> lock(m_SampleMutex);
+		retiredSamples.swap(m_RetiredSamples);
+	}
+
+	std::vector<GLSampleBase *> evicted;
+	for (auto &retired : retiredSamples)
+	{
+		if (SampleRegistry::GetFlags(retired.type) & SAMPLE_FLAG_NO_CACHE)
+		{
+			evicted.push_back(retired.pSample);
+		}
+		else
+		{
+			m_SampleCache.Put(retired.type, retired.pSample, evicted);
+		}
+	}
+
+	for (auto pSample : evicted)
+	{
+		DestroySample(pSample);
 	}
 }
 
+void MyGLRenderContext::PrewarmNextSample()
+{
+	int type;
+	{
+		std::unique_lock<std::mutex> lock(m_SampleMutex);
+		if (++m_FramesSinceSwitch < SAMPLE_PREWARM_DELAY_FRAMES || m_PrewarmQueue.empty()) return;
+		type = m_PrewarmQueue.front();
+		m_PrewarmQueue.erase(m_PrewarmQueue.begin());
+		if (type == m_CurSampleType) return;
+	}
+	if (m_SampleCache.Contains(type)) return;
+
+	GLSampleBase *pSample = SampleRegistry::CreateSample(type);
+	if (pSample == nullptr) return;
+
+	// 预热在 GL 线程的空闲帧同步调用 Init()，着色器编译也在这一帧完成：VAO/FBO 等容器对象不能跨上下文共享，
+	// 因此不放到共享上下文中；此时样例还没有收到 LoadImage，Init() 可能修改的绑定和开关状态在这里恢复
+	GLint viewport[4], program, vao, fbo, activeTexture;
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+	glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vao);
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &fbo);
+	glGetIntegerv(GL_ACTIVE_TEXTURE, &activeTexture);
+	const GLenum caps[] = {GL_DEPTH_TEST, GL_BLEND, GL_STENCIL_TEST, GL_CULL_FACE, GL_SCISSOR_TEST};
+	const int capCount = sizeof(caps) / sizeof(caps[0]);
+	GLboolean capEnabled[capCount];
+	for (int i = 0; i < capCount; ++i)
+	{
+		capEnabled[i] = glIsEnabled(caps[i]);
+	}
+
+	BEGIN_TIME("MyGLRenderContext::PrewarmNextSample")
+		pSample->Init();
+	END_TIME("MyGLRenderContext::PrewarmNextSample")
+
+	glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+	glUseProgram(program);
+	glBindVertexArray(vao);
+	glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	glActiveTexture(activeTexture);
+	for (int i = 0; i < capCount; ++i)
+	{
+		if (capEnabled[i]) glEnable(caps[i]); else glDisable(caps[i]);
+	}
+
+	std::vector<GLSampleBase *> evicted;
+	m_SampleCache.Put(type, pSample, evicted);
+	for (auto pEvicted : evicted)
+	{
+		DestroySample(pEvicted);
+	}
+	LOGCATE("MyGLRenderContext::PrewarmNextSample type=%d, cached=%d", type, m_SampleCache.GetSize());
+}
+
 MyGLRenderContext *MyGLRenderContext::GetInstance()
 {
 	LOGCATE("MyGLRenderContext::GetInstance");
@@ -456,7 +349,8 @@ void MyGLRenderContext::DestroyInstance()
 		delete m_pContext;
 		m_pContext = nullptr;
 	}
-
+	// 最后停止日志线程并输出缓冲中剩余的日志，之后的日志会重新创建实例
+	AsyncLogger::DestroyInstance();
 }
 
 
@@ -14,6 +14,12 @@
 #include "TextureMapSample.h"
 #include "NV21TextureMapSample.h"
 #include "TriangleSample.h"
+#include "SampleCache.h"
+
+// 切换样例后预热列表中后续 N 个样例，每帧最多预热一个
+#define SAMPLE_PREWARM_COUNT        2
+// 切换后先让当前样例稳定绘制几帧再开始预热
+#define SAMPLE_PREWARM_DELAY_FRAMES 3
 
 class MyGLRenderContext
 {
@@ -26,6 +32,11 @@ public:
 
 	void SetImageDataWithIndex(int index, int format, int width, int height, uint8_t *pData);
 
+	//支持带行尾填充的图像，各平面的行跨度由 pImage->pLineSize 指定
+	void SetImageData(NativeImage *pImage);
+
+	void SetImageDataWithIndex(int index, NativeImage *pImage);
+
 	void SetParamsInt(int paramType, int value0, int value1);
 
 	void SetParamsFloat(int paramType, float value0, float value1);
@@ -44,9 +55,31 @@ public:
 	static void DestroyInstance();
 
 private:
+	struct RetiredSample
+	{
+		int type;
+		GLSampleBase *pSample;
+	};
+
+	// GL 线程：处理切走的样例，可缓存的放入 LRU，其余销毁
+	void RetireSamples();
+
+	// GL 线程：在空闲帧预热一个后续样例
+	void PrewarmNextSample();
+
+	static void DestroySample(GLSampleBase *pSample);
+
+	static const char *GetSampleName(int type);
+
 	static MyGLRenderContext *m_pContext;
-	GLSampleBase *m_pBeforeSample;
+	std::mutex m_SampleMutex;
+	std::vector<RetiredSample> m_RetiredSamples;
+	std::vector<int> m_PrewarmQueue;
+	SampleCache m_SampleCache;
 	GLSampleBase *m_pCurSample;
+	int m_CurSampleType;
+	const char *m_CurSampleName;
+	int m_FramesSinceSwitch;
 	int m_ScreenW;
 	int m_ScreenH;
 
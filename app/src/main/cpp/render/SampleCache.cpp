@@ -0,0 +1,90 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "SampleCache.h"
+#include "LogUtil.h"
+
+SampleCache::SampleCache(int capacity)
+{
+	m_Capacity = capacity;
+}
+
+SampleCache::~SampleCache()
+{
+	for (auto &entry : m_Entries)
+	{
+		delete entry.pSample;
+	}
+	m_Entries.clear();
+}
+
+GLSampleBase *SampleCache::Take(int type)
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	for (auto iter = m_Entries.begin(); iter != m_Entries.end(); ++iter)
+	{
+		if (iter->type == type)
+		{
+			GLSampleBase *pSample = iter->pSample;
+			m_Entries.erase(iter);
+			LOGCATE("SampleCache::Take hit type=%d, sample=%p", type, pSample);
+			return pSample;
+		}
+	}
+	return nullptr;
+}
+
+bool SampleCache::Contains(int type)
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	for (auto &entry : m_Entries)
+	{
+		if (entry.type == type) return true;
+	}
+	return false;
+}
+
+void SampleCache::Put(int type, GLSampleBase *pSample, std::vector<GLSampleBase *> &evicted)
+{
+	if (pSample == nullptr) return;
+
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	for (auto iter = m_Entries.begin(); iter != m_Entries.end();)
+	{
+		// 同类型只保留最新的实例
+		if (iter->type == type)
+		{
+			evicted.push_back(iter->pSample);
+			iter = m_Entries.erase(iter);
+		}
+		else
+		{
+			++iter;
+		}
+	}
+
+	m_Entries.push_front({type, pSample});
+	while ((int) m_Entries.size() > m_Capacity)
+	{
+		LOGCATE("SampleCache::Put evict type=%d", m_Entries.back().type);
+		evicted.push_back(m_Entries.back().pSample);
+		m_Entries.pop_back();
+	}
+}
+
+void SampleCache::Clear(std::vector<GLSampleBase *> &samples)
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	for (auto &entry : m_Entries)
+	{
+		samples.push_back(entry.pSample);
+	}
+	m_Entries.clear();
+}
+
+int SampleCache::GetSize()
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	return (int) m_Entries.size();
+}
@@ -0,0 +1,51 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_SAMPLECACHE_H
+#define NDK_OPENGLES_3_0_SAMPLECACHE_H
+
+#include <list>
+#include <mutex>
+#include <vector>
+#include "GLSampleBase.h"
+
+#define SAMPLE_CACHE_CAPACITY 4
+
+/**
+ * 已经 Init() 过的样例的 LRU 缓存，切回时直接复用，不再重新编译着色器、加载资源。
+ * Take 可在任意线程调用；Put 返回的淘汰样例需在 GL 线程上 Destroy 后释放。
+ */
+class SampleCache
+{
+public:
+	SampleCache(int capacity = SAMPLE_CACHE_CAPACITY);
+
+	~SampleCache();
+
+	// 命中时从缓存中移除并返回，否则返回 nullptr
+	GLSampleBase *Take(int type);
+
+	bool Contains(int type);
+
+	// 放到最近使用的位置，超出容量的样例通过 evicted 返回
+	void Put(int type, GLSampleBase *pSample, std::vector<GLSampleBase *> &evicted);
+
+	// 清空缓存，样例的 GL 资源由调用者决定是否 Destroy
+	void Clear(std::vector<GLSampleBase *> &samples);
+
+	int GetSize();
+
+private:
+	struct CacheEntry
+	{
+		int type;
+		GLSampleBase *pSample;
+	};
+
+	int m_Capacity;
+	std::list<CacheEntry> m_Entries;
+	std::mutex m_Mutex;
+};
+
+#endif //NDK_OPENGLES_3_0_SAMPLECACHE_H
@@ -0,0 +1,208 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "SampleRegistry.h"
+#include <TriangleSample.h>
+#include <TextureMapSample.h>
+#include <NV21TextureMapSample.h>
+#include <VaoSample.h>
+#include <FBOSample.h>
+#include <FBOLegLengthenSample.h>
+#include <CoordSystemSample.h>
+#include <BasicLightingSample.h>
+#include <TransformFeedbackSample.h>
+#include <MultiLightsSample.h>
+#include <DepthTestingSample.h>
+#include <Instancing3DSample.h>
+#include <StencilTestingSample.h>
+#include <BlendingSample.h>
+#include <ParticlesSample.h>
+#include <SkyBoxSample.h>
+#include <BeatingHeartSample.h>
+#include <CloudSample.h>
+#include <BezierCurveSample.h>
+#include <BigEyesSample.h>
+#include <FaceSlenderSample.h>
+#include <BigHeadSample.h>
+#include <RotaryHeadSample.h>
+#include <VisualizeAudioSample.h>
+#include <ScratchCardSample.h>
+#include <AvatarSample.h>
+#include <ShockWaveSample.h>
+#include <MRTSample.h>
+#include <FBOBlitSample.h>
+#include <TextureBufferSample.h>
+#include <UniformBufferSample.h>
+#include <RGB2YUYVSample.h>
+#include <SharedEGLContextSample.h>
+#include <PortraitStayColorExample.h>
+#include <GLTransitionExample.h>
+#include <GLTransitionExample_2.h>
+#include <GLTransitionExample_3.h>
+#include <GLTransitionExample_4.h>
+#include <RGB2NV21Sample.h>
+#include <RGB2I420Sample.h>
+#include <RGB2I444Sample.h>
+#include <CopyTextureExample.h>
+#include <BlitFrameBufferExample.h>
+#include <BinaryProgramExample.h>
+#include <Render16BitGraySample.h>
+#include <RenderP010Sample.h>
+#include <RenderNV21Sample.h>
+#include <RenderI420Sample.h>
+#include <RenderI444Sample.h>
+#include <RenderYUYVSample.h>
+#include <ComputeShaderSample.h>
+#include <PortraitModeSample.h>
+#include <MultiSampleAntiAliasingSample.h>
+#include <FullScreenTriangleSample.h>
+#include <GeometryShaderSample.h>
+#ifndef NATIVE_RENDER_HOST
+// 依赖 opencv / assimp / freetype 预编译库的样例，主机构建不包含
+#include <Model3DSample.h>
+#include <PBOSample.h>
+#include <TimeTunnelSample.h>
+#include <TextRenderSample.h>
+#include <GeometryShader2Sample.h>
+#include <GeometryShader3Sample.h>
+#endif
+#include "LogUtil.h"
+
+template<class T>
+static GLSampleBase *CreateSample()
+{
+	return new T();
+}
+
+// 新增样例只需在这里追加一行
+static const SampleRegistryEntry s_SampleEntries[] = {
+		{SAMPLE_TYPE_KEY_TRIANGLE,             CreateSample<TriangleSample>,                 SAMPLE_FLAG_PREWARM,   "TriangleSample"},
+		{SAMPLE_TYPE_KEY_TEXTURE_MAP,          CreateSample<TextureMapSample>,               0,                     "TextureMapSample"},
+		{SAMPLE_TYPE_KEY_YUV_TEXTURE_MAP,      CreateSample<NV21TextureMapSample>,           0,                     "NV21TextureMapSample"},
+		{SAMPLE_TYPE_KEY_VAO,                  CreateSample<VaoSample>,                      0,                     "VaoSample"},
+		{SAMPLE_TYPE_KEY_FBO,                  CreateSample<FBOSample>,                      0,                     "FBOSample"},
+		{SAMPLE_TYPE_KEY_FBO_LEG_LENGTHEN,     CreateSample<FBOLegLengthenSample>,           0,                     "FBOLegLengthenSample"},
+		{SAMPLE_TYPE_KEY_COORD_SYSTEM,         CreateSample<CoordSystemSample>,              0,                     "CoordSystemSample"},
+		{SAMPLE_TYPE_KEY_BASIC_LIGHTING,       CreateSample<BasicLightingSample>,            SAMPLE_FLAG_PREWARM,   "BasicLightingSample"},
+		{SAMPLE_TYPE_KEY_TRANSFORM_FEEDBACK,   CreateSample<TransformFeedbackSample>,        0,                     "TransformFeedbackSample"},
+		{SAMPLE_TYPE_KEY_MULTI_LIGHTS,         CreateSample<MultiLightsSample>,              0,                     "MultiLightsSample"},
+		{SAMPLE_TYPE_KEY_DEPTH_TESTING,        CreateSample<DepthTestingSample>,             0,                     "DepthTestingSample"},
+		{SAMPLE_TYPE_KEY_INSTANCING,           CreateSample<Instancing3DSample>,             0,                     "Instancing3DSample"},
+		{SAMPLE_TYPE_KEY_STENCIL_TESTING,      CreateSample<StencilTestingSample>,           0,                     "StencilTestingSample"},
+		{SAMPLE_TYPE_KEY_BLENDING,             CreateSample<BlendingSample>,                 0,                     "BlendingSample"},
+		{SAMPLE_TYPE_KEY_PARTICLES,            CreateSample<ParticlesSample>,                0,                     "ParticlesSample"},
+		{SAMPLE_TYPE_KEY_SKYBOX,               CreateSample<SkyBoxSample>,                   SAMPLE_FLAG_PREWARM,   "SkyBoxSample"},
+#ifndef NATIVE_RENDER_HOST
+		{SAMPLE_TYPE_KEY_3D_MODEL,             CreateSample<Model3DSample>,                  0,                     "Model3DSample"},
+		{SAMPLE_TYPE_KEY_PBO,                  CreateSample<PBOSample>,                      0,                     "PBOSample"},
+#endif
+		{SAMPLE_TYPE_KEY_BEATING_HEART,        CreateSample<BeatingHeartSample>,             SAMPLE_FLAG_PREWARM,   "BeatingHeartSample"},
+		{SAMPLE_TYPE_KEY_CLOUD,                CreateSample<CloudSample>,                    SAMPLE_FLAG_PREWARM,   "CloudSample"},
+#ifndef NATIVE_RENDER_HOST
+		{SAMPLE_TYPE_KEY_TIME_TUNNEL,          CreateSample<TimeTunnelSample>,               0,                     "TimeTunnelSample"},
+#endif
+		{SAMPLE_TYPE_KEY_BEZIER_CURVE,         CreateSample<BezierCurveSample>,              SAMPLE_FLAG_PREWARM,   "BezierCurveSample"},
+		{SAMPLE_TYPE_KEY_BIG_EYES,             CreateSample<BigEyesSample>,                  SAMPLE_FLAG_PREWARM,   "BigEyesSample"},
+		{SAMPLE_TYPE_KEY_FACE_SLENDER,         CreateSample<FaceSlenderSample>,              SAMPLE_FLAG_PREWARM,   "FaceSlenderSample"},
+		{SAMPLE_TYPE_KEY_BIG_HEAD,             CreateSample<BigHeadSample>,                  0,                     "BigHeadSample"},
+		{SAMPLE_TYPE_KEY_RATARY_HEAD,          CreateSample<RotaryHeadSample>,               0,                     "RotaryHeadSample"},
+		{SAMPLE_TYPE_KEY_VISUALIZE_AUDIO,      CreateSample<VisualizeAudioSample>,           SAMPLE_FLAG_NO_CACHE,  "VisualizeAudioSample"},
+		{SAMPLE_TYPE_KEY_SCRATCH_CARD,         CreateSample<ScratchCardSample>,              0,                     "ScratchCardSample"},
+		{SAMPLE_TYPE_KEY_AVATAR,               CreateSample<AvatarSample>,                   0,                     "AvatarSample"},
+		{SAMPLE_TYPE_KEY_SHOCK_WAVE,           CreateSample<ShockWaveSample>,                0,                     "ShockWaveSample"},
+		{SAMPLE_TYPE_KEY_MRT,                  CreateSample<MRTSample>,                      0,                     "MRTSample"},
+		{SAMPLE_TYPE_KEY_FBO_BLIT,             CreateSample<FBOBlitSample>,                  0,                     "FBOBlitSample"},
+		{SAMPLE_TYPE_KEY_TBO,                  CreateSample<TextureBufferSample>,            0,                     "TextureBufferSample"},
+		{SAMPLE_TYPE_KEY_UBO,                  CreateSample<UniformBufferSample>,            0,                     "UniformBufferSample"},
+		{SAMPLE_TYPE_KEY_RGB2YUYV,             CreateSample<RGB2YUYVSample>,                 SAMPLE_FLAG_NO_CACHE,  "RGB2YUYVSample"},
+		{SAMPLE_TYPE_KEY_MULTI_THREAD_RENDER,  CreateSample<SharedEGLContextSample>,         SAMPLE_FLAG_NO_CACHE,  "SharedEGLContextSample"},
+#ifndef NATIVE_RENDER_HOST
+		{SAMPLE_TYPE_KEY_TEXT_RENDER,          CreateSample<TextRenderSample>,               0,                     "TextRenderSample"},
+#endif
+		{SAMPLE_TYPE_KEY_STAY_COLOR,           CreateSample<PortraitStayColorExample>,       0,                     "PortraitStayColorExample"},
+		{SAMPLE_TYPE_KEY_TRANSITIONS_1,        CreateSample<GLTransitionExample>,            0,                     "GLTransitionExample"},
+		{SAMPLE_TYPE_KEY_TRANSITIONS_2,        CreateSample<GLTransitionExample_2>,          0,                     "GLTransitionExample_2"},
+		{SAMPLE_TYPE_KEY_TRANSITIONS_3,        CreateSample<GLTransitionExample_3>,          0,                     "GLTransitionExample_3"},
+		{SAMPLE_TYPE_KEY_TRANSITIONS_4,        CreateSample<GLTransitionExample_4>,          0,                     "GLTransitionExample_4"},
+		{SAMPLE_TYPE_KEY_RGB2NV21,             CreateSample<RGB2NV21Sample>,                 SAMPLE_FLAG_NO_CACHE,  "RGB2NV21Sample"},
+		{SAMPLE_TYPE_KEY_RGB2I420,             CreateSample<RGB2I420Sample>,                 SAMPLE_FLAG_NO_CACHE,  "RGB2I420Sample"},
+		{SAMPLE_TYPE_KEY_RGB2I444,             CreateSample<RGB2I444Sample>,                 SAMPLE_FLAG_NO_CACHE,  "RGB2I444Sample"},
+		{SAMPLE_TYPE_KEY_COPY_TEXTURE,         CreateSample<CopyTextureExample>,             0,                     "CopyTextureExample"},
+		{SAMPLE_TYPE_KEY_BLIT_FRAME_BUFFER,    CreateSample<BlitFrameBufferExample>,         0,                     "BlitFrameBufferExample"},
+		{SAMPLE_TYPE_KEY_BINARY_PROGRAM,       CreateSample<BinaryProgramExample>,           0,                     "BinaryProgramExample"},
+		{SAMPLE_TYPE_KEY_RENDER_16BIT_GRAY,    CreateSample<Render16BitGraySample>,          0,                     "Render16BitGraySample"},
+		{SAMPLE_TYPE_KEY_RENDER_P010,          CreateSample<RenderP010Sample>,               0,                     "RenderP010Sample"},
+		{SAMPLE_TYPE_KEY_RENDER_NV21,          CreateSample<RenderNV21Sample>,               0,                     "RenderNV21Sample"},
+		{SAMPLE_TYPE_KEY_RENDER_I420,          CreateSample<RenderI420Sample>,               0,                     "RenderI420Sample"},
+		{SAMPLE_TYPE_KEY_RENDER_I444,          CreateSample<RenderI444Sample>,               0,                     "RenderI444Sample"},
+		{SAMPLE_TYPE_KEY_RENDER_YUYV,          CreateSample<RenderYUYVSample>,               0,                     "RenderYUYVSample"},
+		{SAMPLE_TYPE_KEY_COMPUTE_SHADER,       CreateSample<ComputeShaderSample>,            SAMPLE_FLAG_PREWARM,   "ComputeShaderSample"},
+		{SAMPLE_TYPE_KEY_PORTRAIT_MODE,        CreateSample<PortraitModeSample>,             0,                     "PortraitModeSample"},
+		{SAMPLE_TYPE_KEY_MSAA,                 CreateSample<MultiSampleAntiAliasingSample>,  0,                     "MultiSampleAntiAliasingSample"},
+		{SAMPLE_TYPE_KEY_FULLSCREEN_TRIANGLE,  CreateSample<FullScreenTriangleSample>,       0,                     "FullScreenTriangleSample"},
+		{SAMPLE_TYPE_KEY_GEOMETRY_SHADER,      CreateSample<GeometryShaderSample>,           0,                     "GeometryShaderSample"},
+#ifndef NATIVE_RENDER_HOST
+		{SAMPLE_TYPE_KEY_GEOMETRY_SHADER2,     CreateSample<GeometryShader2Sample>,          SAMPLE_FLAG_PREWARM,   "GeometryShader2Sample"},
+		{SAMPLE_TYPE_KEY_GEOMETRY_SHADER3,     CreateSample<GeometryShader3Sample>,          SAMPLE_FLAG_PREWARM,   "GeometryShader3Sample"},
+#endif
+};
+
+static const int SAMPLE_ENTRY_COUNT = sizeof(s_SampleEntries) / sizeof(s_SampleEntries[0]);
+
+const SampleRegistryEntry *SampleRegistry::GetEntries(int &count)
+{
+	count = SAMPLE_ENTRY_COUNT;
+	return s_SampleEntries;
+}
+
+const SampleRegistryEntry *SampleRegistry::Find(int type)
+{
+	for (int i = 0; i < SAMPLE_ENTRY_COUNT; ++i)
+	{
+		if (s_SampleEntries[i].type == type) return &s_SampleEntries[i];
+	}
+	return nullptr;
+}
+
+GLSampleBase *SampleRegistry::CreateSample(int type)
+{
+	const SampleRegistryEntry *pEntry = Find(type);
+	if (pEntry == nullptr)
+	{
+		LOGCATE("SampleRegistry::CreateSample unknown sample type=%d", type);
+		return nullptr;
+	}
+	return pEntry->factory();
+}
+
+int SampleRegistry::GetFlags(int type)
+{
+	const SampleRegistryEntry *pEntry = Find(type);
+	return pEntry != nullptr ? pEntry->flags : 0;
+}
+
+std::vector<int> SampleRegistry::GetPrewarmCandidates(int type, int count)
+{
+	std::vector<int> candidates;
+	int start = 0;
+	for (int i = 0; i < SAMPLE_ENTRY_COUNT; ++i)
+	{
+		if (s_SampleEntries[i].type == type)
+		{
+			start = i + 1;
+			break;
+		}
+	}
+
+	// 只向后查找一圈，用户通常按列表顺序浏览
+	for (int i = 0; i < SAMPLE_ENTRY_COUNT - 1 && (int) candidates.size() < count; ++i)
+	{
+		const SampleRegistryEntry &entry = s_SampleEntries[(start + i) % SAMPLE_ENTRY_COUNT];
+		if (entry.type != type && (entry.flags & SAMPLE_FLAG_PREWARM) && !(entry.flags & SAMPLE_FLAG_NO_CACHE))
+		{
+			candidates.push_back(entry.type);
+		}
+	}
+	return candidates;
+}
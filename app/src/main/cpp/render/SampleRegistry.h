@@ -0,0 +1,45 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_SAMPLEREGISTRY_H
+#define NDK_OPENGLES_3_0_SAMPLEREGISTRY_H
+
+#include <vector>
+#include "GLSampleBase.h"
+
+// Init() 只编译程序、创建顶点缓冲，纹理在 Draw() 中才从 m_RenderImage 上传，且自带重复初始化保护，可以在切换前预热。
+// 预热在 GL 线程的空闲帧同步执行，在 Init() 里上传图像的样例不能加这个标记，否则预热后画面为空
+#define SAMPLE_FLAG_PREWARM  0x01
+// 持有独立线程或全局单例，或 Init() 读取运行时可切换的全局设置，切走后必须销毁，不能放入 LRU
+#define SAMPLE_FLAG_NO_CACHE 0x02
+
+typedef GLSampleBase *(*SampleFactory)();
+
+struct SampleRegistryEntry
+{
+	int type;
+	SampleFactory factory;
+	int flags;
+	const char *name;
+};
+
+/**
+ * SAMPLE_TYPE_KEY_* 到样例工厂的映射表，顺序与界面列表一致
+ */
+class SampleRegistry
+{
+public:
+	static GLSampleBase *CreateSample(int type);
+
+	static const SampleRegistryEntry *Find(int type);
+
+	static int GetFlags(int type);
+
+	// 按注册顺序返回 type 之后最多 count 个可预热的样例
+	static std::vector<int> GetPrewarmCandidates(int type, int count);
+
+	static const SampleRegistryEntry *GetEntries(int &count);
+};
+
+#endif //NDK_OPENGLES_3_0_SAMPLEREGISTRY_H
@@ -43,7 +43,7 @@ AvatarSample::AvatarSample()
 	m_TransY = 0.0f;
 
 	memset(m_TextureIds, 0, sizeof(m_TextureIds));
-    memset(m_RenderImages, 0, sizeof(m_RenderImages));
+    // m_RenderImages 由 NativeImage 的构造函数置零，不能再 memset
 
     m_FrameIndex = 0;
 }
@@ -232,7 +232,7 @@ void AvatarSample::LoadMultiImageWithIndex(int index, NativeImage *pImage) {
 
 void AvatarSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("AvatarSample::Draw()");
+	LOGCATV("AvatarSample::Draw()");
 
 	if(m_ProgramObj == GL_NONE) return;
 	float dScaleLevel = m_FrameIndex % 200 * 1.0f / 1000 + 0.0001f;
@@ -265,7 +265,7 @@ void AvatarSample::Draw(int screenW, int screenH)
 	scaleLevel = static_cast<float>(1.0f + dScaleLevel * pow(-1, m_FrameIndex / 200 + 1));
 	scaleLevel = scaleLevel < 1.0 ? scaleLevel + 0.2f : scaleLevel;
 	m_ScaleY = m_ScaleX = scaleLevel + 0.4f;
-	LOGCATE("AvatarSample::Draw() scaleLevel=%f", scaleLevel);
+	LOGCATV("AvatarSample::Draw() scaleLevel=%f", scaleLevel);
 	UpdateMVPMatrix(m_MVPMatrix, m_AngleX, m_AngleY, m_TransX * 1.2f, m_TransY * 1.2f, (float)screenW / screenH);
 	GLUtils::setVec2(m_ProgramObj, "u_texSize", glm::vec2(m_RenderImages[0].width, m_RenderImages[0].height));
 	GLUtils::setFloat(m_ProgramObj, "u_needRotate", 0.0f);// u_needRotate == 0 关闭形变
@@ -314,7 +314,7 @@ void AvatarSample::Destroy()
  */
 void AvatarSample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float transX, float transY, float ratio)
 {
-	LOGCATE("AvatarSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("AvatarSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
 
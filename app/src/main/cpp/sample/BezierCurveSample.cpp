@@ -175,7 +175,7 @@ void BezierCurveSample::LoadImage(NativeImage *pImage) {
 }
 
 void BezierCurveSample::Draw(int screenW, int screenH) {
-    LOGCATE("BezierCurveSample::Draw()");
+    LOGCATV("BezierCurveSample::Draw()");
 
     if (m_pCoordSystemSample != nullptr) {
         //m_pCoordSystemSample->Draw(screenW, screenH);
@@ -309,7 +309,7 @@ void BezierCurveSample::Destroy() {
  * @param ratio 宽高比
  * */
 void BezierCurveSample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio) {
-    LOGCATE("BezierCurveSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX,
+    LOGCATV("BezierCurveSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX,
             angleY, ratio);
     angleX = angleX % 360;
     angleY = angleY % 360;
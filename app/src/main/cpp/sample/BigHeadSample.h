@@ -12,6 +12,8 @@
 
 #include <detail/type_mat.hpp>
 #include <detail/type_mat4x4.hpp>
+#include <vec2.hpp>
+#include <vec3.hpp>
 #include <ByteFlowLock.h>
 #include <CommonDef.h>
 #include "GLSampleBase.h"
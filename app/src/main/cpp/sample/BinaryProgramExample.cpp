@@ -262,6 +262,7 @@ void BinaryProgramExample::LoadBinary2Program(GLuint *pProgram, char *binFilePat
 			glDeleteProgram(*pProgram);
 			*pProgram = GL_NONE;
 		}
+		UniformLocationCache::Build(*pProgram);
 
 		delete[] buffer;
 	}
@@ -199,7 +199,7 @@ void ConveyorBeltExample::LoadImage(NativeImage *pImage)
 
 void ConveyorBeltExample::Draw(int screenW, int screenH)
 {
-	LOGCATE("ConveyorBeltExample::Draw()");
+	LOGCATV("ConveyorBeltExample::Draw()");
 
 	if(m_ProgramObj == GL_NONE || m_TextureIds[0] == GL_NONE) return;
 
@@ -258,7 +258,7 @@ void ConveyorBeltExample::Destroy()
 
 void ConveyorBeltExample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("ConveyorBeltExample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("ConveyorBeltExample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
 
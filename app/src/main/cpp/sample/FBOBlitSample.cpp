@@ -202,7 +202,7 @@ void FBOBlitSample::LoadImage(NativeImage *pImage)
 // 渲染函数：执行离屏渲染和屏幕显示
 void FBOBlitSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("FBOBlitSample::Draw()");
+	LOGCATV("FBOBlitSample::Draw()");
 	m_SurfaceWidth = screenW;
 	m_SurfaceHeight = screenH;
 
@@ -262,7 +262,7 @@ void FBOBlitSample::Destroy()
  * */
 void FBOBlitSample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("FBOBlitSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("FBOBlitSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
 
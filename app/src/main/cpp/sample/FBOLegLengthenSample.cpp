@@ -14,12 +14,14 @@
  * */
 
 #include <GLUtils.h>
+#include <FrameProfiler.h>
 #include <gtc/matrix_transform.hpp>
 #include "FBOLegLengthenSample.h"
 
 // 顶点属性索引定义
 #define VERTEX_POS_INDX  0   // 顶点位置属性索引
 #define TEXTURE_POS_INDX 1   // 纹理坐标属性索引
+//#define FBO_LEG_DUMP_IMAGE   // 开启后把拉伸结果异步回读并保存到 DEFAULT_OGL_ASSETS_DIR
 
 // 普通渲染的顶点着色器（用于将FBO纹理渲染到屏幕）
 const char vShaderStr[] =
@@ -110,6 +112,8 @@ FBOLegLengthenSample::FBOLegLengthenSample()
 
 	// 默认拉伸模式：垂直8点拉伸（大长腿效果）
 	m_StretchMode = VERTICAL_STRETCH_8_POINTS;
+
+	m_Readback.SetCallback(OnReadbackDone, this);
 }
 
 FBOLegLengthenSample::~FBOLegLengthenSample()
@@ -754,7 +758,7 @@ void FBOLegLengthenSample::Init()
 
 void FBOLegLengthenSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("FBOLegLengthenSample::Draw [screenW, screenH] = [%d, %d]", screenW, screenH);
+	LOGCATV("FBOLegLengthenSample::Draw [screenW, screenH] = [%d, %d]", screenW, screenH);
 	//纹理就是一个“可以被采样的复杂的数据集合” 纹理作为 GPU 图像数据结构
 	//glPixelStorei(GL_UNPACK_ALIGNMENT,1);
 	if (m_bIsVerticalMode)
@@ -821,25 +825,30 @@ void FBOLegLengthenSample::Draw(int screenW, int screenH)
 	glBindTexture(GL_TEXTURE_2D, GL_NONE);
 	glBindVertexArray(GL_NONE);
 
-//	glBindFramebuffer(GL_FRAMEBUFFER, m_FboId);
-//	NativeImage nativeImage = m_RenderImage;
-//	nativeImage.format = IMAGE_FORMAT_RGBA;
-//	nativeImage.height = static_cast<int>(m_RenderImage.height * (1 + 2 * m_dt));
-//	uint8_t *pBuffer = new uint8_t[nativeImage.width * nativeImage.height * 4];
-//
-//	nativeImage.ppPlane[0] = pBuffer;
-//	FUN_BEGIN_TIME("FBO glReadPixels")
-//		glReadPixels(0, 0, nativeImage.width, nativeImage.height, GL_RGBA, GL_UNSIGNED_BYTE, pBuffer);
-//	FUN_END_TIME("FBO cost glReadPixels")
-//
-//	NativeImageUtil::DumpNativeImage(&nativeImage, "/sdcard/DCIM", "NDK");
-//	delete []pBuffer;
-//	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#ifdef FBO_LEG_DUMP_IMAGE
+	// 异步回读拉伸结果，fence 触发后在之后的帧回调保存，不阻塞当前帧
+	glBindFramebuffer(GL_FRAMEBUFFER, m_FboId);
+	{ PROFILE_SCOPE("FBO AsyncReadback");
+		int width = m_bIsVerticalMode ? m_RenderImage.width : static_cast<int>(m_RenderImage.width * (1 + 2 * m_dt));
+		int height = m_bIsVerticalMode ? static_cast<int>(m_RenderImage.height * (1 + 2 * m_dt)) : m_RenderImage.height;
+		m_Readback.Submit(IMAGE_FORMAT_RGBA, width, height);
+		m_Readback.Poll();
+	}
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#endif
+
+}
 
+void FBOLegLengthenSample::OnReadbackDone(void *pContext, const NativeImage *pImage, int64_t frameId)
+{
+	std::string path(DEFAULT_OGL_ASSETS_DIR);
+	NativeImageUtil::DumpNativeImage(const_cast<NativeImage *>(pImage), path.c_str(), "FBOLegLengthen");
 }
 
 void FBOLegLengthenSample::Destroy()
 {
+	m_Readback.Destroy();
+
 	if (m_ProgramObj)
 	{
 		glDeleteProgram(m_ProgramObj);
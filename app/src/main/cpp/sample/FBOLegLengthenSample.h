@@ -13,6 +13,7 @@
 #include <detail/type_mat4x4.hpp>
 #include "GLSampleBase.h"
 #include "../util/ImageDef.h"
+#include "../util/AsyncReadback.h"
 
 #define VERTICAL_STRETCH_8_POINTS          0x10
 #define VERTICAL_STRETCH_TOP_6_POINTS      0x11
@@ -40,6 +41,8 @@ public:
 
 	bool CreateFrameBufferObj();
 
+	static void OnReadbackDone(void *pContext, const NativeImage *pImage, int64_t frameId);
+
 private:
 	GLuint m_ImageTextureId;
 	GLuint m_FboTextureId;
@@ -66,6 +69,8 @@ private:
 	int   m_StretchMode;
 
 	bool  m_bIsVerticalMode;
+
+	AsyncReadback m_Readback; // FBO_LEG_DUMP_IMAGE 开启时异步回读拉伸结果
 };
 
 
@@ -71,7 +71,7 @@ void FullScreenTriangleSample::Init()
 
 void FullScreenTriangleSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("FullScreenTriangleSample::Draw()");
+	LOGCATV("FullScreenTriangleSample::Draw()");
 
 	if(m_ProgramObj == GL_NONE || m_TextureId == GL_NONE) return;
 
@@ -111,6 +111,8 @@
 // 特殊控制类型
 #define SAMPLE_TYPE_KEY_SET_TOUCH_LOC           SAMPLE_TYPE + 999   // 设置触摸位置
 #define SAMPLE_TYPE_SET_GRAVITY_XY              SAMPLE_TYPE + 1000  // 设置重力感应 XY
+#define SAMPLE_TYPE_SET_TRACE                   SAMPLE_TYPE + 1001  // 开关 trace 录制，value0=1 开始，0 停止并导出 JSON
+#define SAMPLE_TYPE_SET_YUV_BACKEND             SAMPLE_TYPE + 1002  // RGB2* 样例的转换后端，value0 为 YUV_BACKEND_*，之后选中的样例生效
 
 // ==================== 资源路径定义 ====================
 #define DEFAULT_OGL_ASSETS_DIR "/sdcard/Android/data/com.byteflow.app/files/Download"  // 默认资源目录
@@ -154,6 +156,8 @@ public:
 	 * @brief 加载图像数据（单张图像）
 	 * @param pImage 图像数据结构指针
 	 * @details 用于加载纹理贴图、视频帧等图像数据
+	 *          pImage 为借用的数据（可能直接指向 Java 内存），只在本次调用内有效，
+	 *          需要在 Draw 中使用时须通过 NativeImageUtil::CopyNativeImage 拷贝
 	 */
 	virtual void LoadImage(NativeImage *pImage)
 	{};
@@ -225,6 +229,16 @@ public:
 	 */
 	virtual void Destroy() = 0;
 
+	/**
+	 * @brief 获取最近一次 Draw 离屏输出的图像（如 RGB 转 YUV 的结果）
+	 * @param pImage 输出参数，浅拷贝，平面内存归样例所有，下次 Draw 或 Destroy 前有效
+	 * @return 样例没有离屏输出或尚未绘制时返回 false
+	 */
+	virtual bool GetOutputImage(NativeImage *pImage)
+	{
+		return false;
+	}
+
 protected:
 	GLuint m_VertexShader;      // 顶点着色器对象 ID
 	GLuint m_FragmentShader;    // 片段着色器对象 ID
@@ -396,7 +396,7 @@ void GLTransitionExample::LoadImage(NativeImage *pImage)
  */
 void GLTransitionExample::Draw(int screenW, int screenH)
 {
-	LOGCATE("GLTransitionExample::Draw()");
+	LOGCATV("GLTransitionExample::Draw()");
 
 	// 检查着色器程序和纹理是否已初始化
 	if(m_ProgramObj == GL_NONE || m_TextureIds[0] == GL_NONE) return;
@@ -465,7 +465,7 @@ void GLTransitionExample::Destroy()
  */
 void GLTransitionExample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("GLTransitionExample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("GLTransitionExample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	// 将角度限制在 0-360 度范围内
 	angleX = angleX % 360;
 	angleY = angleY % 360;
@@ -169,7 +169,7 @@ void GLTransitionExample_2::LoadImage(NativeImage *pImage)
 
 void GLTransitionExample_2::Draw(int screenW, int screenH)
 {
-	LOGCATE("GLTransitionExample_2::Draw()");
+	LOGCATV("GLTransitionExample_2::Draw()");
 
 	if(m_ProgramObj == GL_NONE || m_TextureIds[0] == GL_NONE) return;
 
@@ -217,7 +217,7 @@ void GLTransitionExample_2::Destroy()
 
 void GLTransitionExample_2::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("GLTransitionExample_2::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("GLTransitionExample_2::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
 
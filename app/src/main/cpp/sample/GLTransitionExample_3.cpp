@@ -164,7 +164,7 @@ void GLTransitionExample_3::LoadImage(NativeImage *pImage)
 
 void GLTransitionExample_3::Draw(int screenW, int screenH)
 {
-	LOGCATE("GLTransitionExample_3::Draw()");
+	LOGCATV("GLTransitionExample_3::Draw()");
 
 	if(m_ProgramObj == GL_NONE || m_TextureIds[0] == GL_NONE) return;
 
@@ -212,7 +212,7 @@ void GLTransitionExample_3::Destroy()
 
 void GLTransitionExample_3::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("GLTransitionExample_3::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("GLTransitionExample_3::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
 
@@ -211,7 +211,7 @@ void GLTransitionExample_4::LoadImage(NativeImage *pImage)
 
 void GLTransitionExample_4::Draw(int screenW, int screenH)
 {
-	LOGCATE("GLTransitionExample_4::Draw()");
+	LOGCATV("GLTransitionExample_4::Draw()");
 
 	if(m_ProgramObj == GL_NONE || m_TextureIds[0] == GL_NONE) return;
 
@@ -259,7 +259,7 @@ void GLTransitionExample_4::Destroy()
 
 void GLTransitionExample_4::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("GLTransitionExample_4::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("GLTransitionExample_4::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
 
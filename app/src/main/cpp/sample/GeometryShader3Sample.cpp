@@ -170,7 +170,7 @@ void GeometryShader3Sample::LoadImage(NativeImage *pImage)
 void GeometryShader3Sample::Draw(int screenW, int screenH)
 {
 	if(m_pModel == nullptr || m_pShader == nullptr) return;
-    LOGCATE("GeometryShader3Sample::Draw()");
+    LOGCATV("GeometryShader3Sample::Draw()");
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     glEnable(GL_DEPTH_TEST);
@@ -219,7 +219,7 @@ void GeometryShader3Sample::Destroy()
 
 void GeometryShader3Sample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("GeometryShader3Sample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("GeometryShader3Sample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
 
@@ -122,7 +122,7 @@ void GeometryShaderSample::Init()
 
 void GeometryShaderSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("GeometryShaderSample::Draw()");
+	LOGCATV("GeometryShaderSample::Draw()");
 
 	if(m_ProgramObj == GL_NONE || m_TextureId == GL_NONE) return;
 
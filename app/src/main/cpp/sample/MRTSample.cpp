@@ -194,7 +194,7 @@ void MRTSample::LoadImage(NativeImage *pImage)
 
 void MRTSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("MRTSample::Draw()");
+	LOGCATV("MRTSample::Draw()");
 	m_SurfaceWidth = screenW;
 	m_SurfaceHeight = screenH;
 
@@ -261,7 +261,7 @@ void MRTSample::Destroy()
  * */
 void MRTSample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("MRTSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("MRTSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
 
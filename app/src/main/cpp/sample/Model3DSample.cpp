@@ -136,7 +136,8 @@ void Model3DSample::Init()
     // 然后可以选择你要加载的模型
 	//m_pModel = new Model(path + "/model/nanosuit/nanosuit.obj");  // 纳米服模型
 	std::string path(DEFAULT_OGL_ASSETS_DIR);
-    m_pModel = new Model(path + "/model/poly/Apricot_02_hi_poly.obj");  // 当前使用的模型
+    // 着色器只读取位置、法线和纹理坐标，使用紧凑顶点格式（见 mesh.h 的 PackedVertex）
+    m_pModel = new Model(path + "/model/poly/Apricot_02_hi_poly.obj", false, true);  // 当前使用的模型
     //m_pModel = new Model(path + "/model/tank/Abrams_BF3.obj");        // 坦克模型
     //m_pModel = new Model(path + "/model/girl/091_W_Aya_10K.obj");     // 人物模型
     //m_pModel = new Model(path + "/model/new/camaro.obj");             // 汽车模型
@@ -172,7 +173,7 @@ void Model3DSample::LoadImage(NativeImage *pImage)
 void Model3DSample::Draw(int screenW, int screenH)
 {
 	if(m_pModel == nullptr || m_pShader == nullptr) return;
-    LOGCATE("Model3DSample::Draw()");
+    LOGCATV("Model3DSample::Draw()");
 
     // 设置背景色为灰色并清除颜色和深度缓冲区
     glClearColor(0.5f, 0.5f, 0.5f, 1.0f);
@@ -227,7 +228,7 @@ void Model3DSample::Destroy()
  */
 void Model3DSample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("Model3DSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("Model3DSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;  // 角度归一化到 [0, 360) 范围
 	angleY = angleY % 360;
 
@@ -32,6 +32,7 @@ void NV21TextureMapSample::LoadImage(NativeImage *pImage)
 		m_RenderImage.height = pImage->height;
 		m_RenderImage.format = pImage->format;
 		NativeImageUtil::CopyNativeImage(pImage, &m_RenderImage);
+		m_bImageDirty = true;
 	}
 }
 
@@ -41,6 +42,8 @@ void NV21TextureMapSample::LoadImage(NativeImage *pImage)
  */
 void NV21TextureMapSample::Init()
 {
+	if (m_ProgramObj) return;
+
 	// 顶点着色器: 传递顶点位置和纹理坐标
 	char vShaderStr[] =
 			"#version 300 es                            \n"
@@ -58,7 +61,7 @@ void NV21TextureMapSample::Init()
 	 *
 	 * NV21 采样说明:
 	 * - Y 分量: 从 y_texture 的 r 通道采样 (全分辨率)
-	 * - U 分量: 从 uv_texture 的 a 通道采样 (NV21 格式中 V 在前, U 在后)
+	 * - U 分量: 从 uv_texture 的 g 通道采样 (NV21 格式中 V 在前, U 在后)
 	 * - V 分量: 从 uv_texture 的 r 通道采样
 	 *
 	 * YUV 取值范围归一化:
@@ -87,8 +90,8 @@ void NV21TextureMapSample::Init()
 			"	vec3 yuv;										\n"
 			// 采样 Y 分量 (亮度),减去偏移量 16/255
 			"   yuv.x = texture(y_texture, v_texCoord).r -0.063;  	\n"
-			// 采样 U 分量 (蓝色色度),NV21 格式 U 在 alpha 通道
-			"   yuv.y = texture(uv_texture, v_texCoord).a-0.502;	\n"
+			// 采样 U 分量 (蓝色色度),NV21 格式 U 在 green 通道
+			"   yuv.y = texture(uv_texture, v_texCoord).g-0.502;	\n"
 			// 采样 V 分量 (红色色度),NV21 格式 V 在 red 通道
 			"   yuv.z = texture(uv_texture, v_texCoord).r-0.502;	\n"
 			// 使用 BT.601 标准矩阵将 YUV 转换为 RGB
@@ -104,13 +107,6 @@ void NV21TextureMapSample::Init()
 	// 获取纹理采样器的 uniform 位置
 	m_ySamplerLoc = glGetUniformLocation (m_ProgramObj, "y_texture" );
 	m_uvSamplerLoc = glGetUniformLocation(m_ProgramObj, "uv_texture");
-
-	// 创建两个纹理对象: Y 平面和 UV 平面
-	GLuint textureIds[2] = {0};
-	glGenTextures(2, textureIds);
-
-	m_yTextureId = textureIds[0];   // Y 平面纹理
-	m_uvTextureId = textureIds[1];  // UV 平面纹理
 }
 
 /**
@@ -120,38 +116,30 @@ void NV21TextureMapSample::Init()
  */
 void NV21TextureMapSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("NV21TextureMapSample::Draw()");
-
-	if(m_ProgramObj == GL_NONE || m_yTextureId == GL_NONE || m_uvTextureId == GL_NONE) return;
+	LOGCATV("NV21TextureMapSample::Draw()");
 
-	/**
-	 * 上传 Y 平面数据
-	 * - 格式: GL_LUMINANCE (单通道亮度)
-	 * - 尺寸: width × height (全分辨率)
-	 * - 数据: m_RenderImage.ppPlane[0]
-	 */
-	glBindTexture(GL_TEXTURE_2D, m_yTextureId);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, m_RenderImage.width, m_RenderImage.height, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, m_RenderImage.ppPlane[0]);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glBindTexture(GL_TEXTURE_2D, GL_NONE);
+	if(m_ProgramObj == GL_NONE) return;
 
 	/**
-	 * 上传 UV 平面数据
-	 * - 格式: GL_LUMINANCE_ALPHA (双通道: V 在 L, U 在 A)
-	 * - 尺寸: (width/2) × (height/2) (4:2:0 采样,宽高各减半)
-	 * - 数据: m_RenderImage.ppPlane[1] (VU 交错排列)
-	 * - NV21 特点: V 和 U 交错存储 VUVUVU...
+	 * 图像更新后才上传, 纹理存储只在尺寸变化时分配
+	 * - Y 平面: GL_R8, width × height (全分辨率)
+	 * - UV 平面: GL_RG8, (width/2) × (height/2), V 在 r, U 在 g
+	 *   紧跟在 Y 平面之后, NV21 特点: V 和 U 交错存储 VUVUVU...
 	 */
-	glBindTexture(GL_TEXTURE_2D, m_uvTextureId);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE_ALPHA, m_RenderImage.width >> 1, m_RenderImage.height >> 1, 0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, m_RenderImage.ppPlane[1]);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glBindTexture(GL_TEXTURE_2D, GL_NONE);
+	if (m_bImageDirty)
+	{
+		m_bImageDirty = false;
+		StreamingPlaneDesc planes[2];
+		planes[0].width = m_RenderImage.width;
+		planes[0].height = m_RenderImage.height;
+		planes[1].internalFormat = GL_RG8;
+		planes[1].format = GL_RG;
+		planes[1].width = m_RenderImage.width >> 1;
+		planes[1].height = m_RenderImage.height >> 1;
+		planes[1].offset = (size_t) m_RenderImage.width * m_RenderImage.height;
+		m_Uploader.Upload(&m_RenderImage, planes, 2);
+	}
+	if(m_Uploader.GetPlaneCount() != 2) return;
 
 	// 顶点坐标 (NDC 归一化设备坐标)
 	GLfloat verticesCoords[] = {
@@ -187,14 +175,14 @@ void NV21TextureMapSample::Draw(int screenW, int screenH)
 
 	// 绑定 Y 平面纹理到纹理单元 0
 	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, m_yTextureId);
+	glBindTexture(GL_TEXTURE_2D, m_Uploader.GetTextureId(0));
 
 	// 设置 Y 平面采样器对应纹理单元 0
 	glUniform1i(m_ySamplerLoc, 0);
 
 	// 绑定 UV 平面纹理到纹理单元 1
 	glActiveTexture(GL_TEXTURE1);
-	glBindTexture(GL_TEXTURE_2D, m_uvTextureId);
+	glBindTexture(GL_TEXTURE_2D, m_Uploader.GetTextureId(1));
 
 	// 设置 UV 平面采样器对应纹理单元 1
 	glUniform1i(m_uvSamplerLoc, 1);
@@ -212,9 +200,9 @@ void NV21TextureMapSample::Destroy()
 	if (m_ProgramObj)
 	{
 		glDeleteProgram(m_ProgramObj);
-		glDeleteTextures(1, &m_yTextureId);
-		glDeleteTextures(1, &m_uvTextureId);
+		m_Uploader.Destroy();
 		m_ProgramObj = GL_NONE;
+		m_bImageDirty = true;
 	}
 
 }
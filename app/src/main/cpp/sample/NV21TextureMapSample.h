@@ -12,17 +12,16 @@
 
 #include "GLSampleBase.h"
 #include "../util/ImageDef.h"
+#include "../util/StreamingTextureUploader.h"
 
 class NV21TextureMapSample: public GLSampleBase
 {
 public:
 	NV21TextureMapSample()
 	{
-		m_yTextureId = GL_NONE;
-		m_uvTextureId = GL_NONE;
-
 		m_ySamplerLoc = GL_NONE;
 		m_uvSamplerLoc = GL_NONE;
+		m_bImageDirty = false;
 
 	}
 
@@ -40,13 +39,12 @@ public:
 	virtual void Destroy();
 
 private:
-	GLuint m_yTextureId;
-	GLuint m_uvTextureId;
-
 	GLint m_ySamplerLoc;
 	GLint m_uvSamplerLoc;
 
 	NativeImage m_RenderImage;
+	volatile bool m_bImageDirty;   // LoadImage 后置位，Draw 中上传
+	StreamingTextureUploader m_Uploader;
 
 };
 
@@ -23,6 +23,7 @@
  * */
 
 #include <GLUtils.h>
+#include <FrameProfiler.h>
 #include <gtc/matrix_transform.hpp>
 #include <cstdlib>
 #include <opencv2/opencv.hpp>
@@ -482,7 +483,7 @@ bool PBOSample::CreateFrameBufferObj()
  */
 void PBOSample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-    LOGCATE("PBOSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+    LOGCATV("PBOSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
     angleX = angleX % 360;
     angleY = angleY % 360;
 
@@ -528,24 +529,24 @@ void PBOSample::UploadPixels() {
 	int nextIndex = (index + 1) % 2;
 
 	// 步骤1：从 PBO[index] 复制数据到纹理（GPU内部操作，快速）
-	BEGIN_TIME("PBOSample::UploadPixels Copy Pixels from PBO to Textrure Obj")
+	{ PROFILE_SCOPE("PBOSample::UploadPixels Copy Pixels from PBO to Textrure Obj");
 		glBindTexture(GL_TEXTURE_2D, m_ImageTextureId);
 		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_UploadPboIds[index]);
 		// 最后一个参数为 0 表示从绑定的 PBO 读取数据，而非系统内存
 		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_RenderImage.width, m_RenderImage.height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
-	END_TIME("PBOSample::UploadPixels Copy Pixels from PBO to Textrure Obj")
+	}
 #else
 	// ==================== 方式2：不使用 PBO（同步传输）====================
 	// 直接从系统内存复制到纹理（CPU->GPU，较慢）
-	BEGIN_TIME("PBOSample::UploadPixels Copy Pixels from System Mem to Textrure Obj")
+	{ PROFILE_SCOPE("PBOSample::UploadPixels Copy Pixels from System Mem to Textrure Obj");
     glBindTexture(GL_TEXTURE_2D, m_ImageTextureId);
     glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_RenderImage.width, m_RenderImage.height, GL_RGBA, GL_UNSIGNED_BYTE, m_RenderImage.ppPlane[0]);
-    END_TIME("PBOSample::UploadPixels Copy Pixels from System Mem to Textrure Obj")
+    }
 #endif
 
 #ifdef PBO_UPLOAD
 	// 步骤2：更新下一帧数据到 PBO[nextIndex]（与步骤1异步执行）
-	BEGIN_TIME("PBOSample::UploadPixels Update Image data")
+	{ PROFILE_SCOPE("PBOSample::UploadPixels Update Image data");
 	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_UploadPboIds[nextIndex]);
 	// 先调用 glBufferData 使旧数据失效（提高性能）
 	glBufferData(GL_PIXEL_UNPACK_BUFFER, dataSize, nullptr, GL_STREAM_DRAW);
@@ -573,19 +574,19 @@ void PBOSample::UploadPixels() {
 		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
 	}
 	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
-	END_TIME("PBOSample::UploadPixels Update Image data")
+	}
 
 #else
 	// 方式2：模拟更新图像数据（用于性能对比）
     NativeImage nativeImage = m_RenderImage;
 	NativeImageUtil::AllocNativeImage(&nativeImage);
-	BEGIN_TIME("PBOSample::UploadPixels Update Image data")
+	{ PROFILE_SCOPE("PBOSample::UploadPixels Update Image data");
 		// 随机位置绘制5行灰色条纹
 		int randomRow = rand() % (m_RenderImage.height - 5);
 		memset(m_RenderImage.ppPlane[0] + randomRow * m_RenderImage.width * 4, 188,
 		static_cast<size_t>(m_RenderImage.width * 4 * 5));
         NativeImageUtil::CopyNativeImage(&m_RenderImage, &nativeImage);
-	END_TIME("PBOSample::UploadPixels Update Image data")
+	}
 	NativeImageUtil::FreeNativeImage(&nativeImage);
 #endif
 
@@ -605,26 +606,26 @@ void PBOSample::DownloadPixels() {
 
 	uint8_t *pBuffer = new uint8_t[dataSize];
 	nativeImage.ppPlane[0] = pBuffer;
-	BEGIN_TIME("DownloadPixels glReadPixels without PBO")
+	{ PROFILE_SCOPE("DownloadPixels glReadPixels without PBO");
 		glReadPixels(0, 0, nativeImage.width, nativeImage.height, GL_RGBA, GL_UNSIGNED_BYTE, pBuffer);
 	//NativeImageUtil::DumpNativeImage(&nativeImage, "/sdcard/DCIM", "Normal");
-	END_TIME("DownloadPixels glReadPixels without PBO")
+	}
     delete []pBuffer;
 
     int index = m_FrameIndex % 2;
     int nextIndex = (index + 1) % 2;
 
-    BEGIN_TIME("DownloadPixels glReadPixels with PBO")
+    { PROFILE_SCOPE("DownloadPixels glReadPixels with PBO");
     glBindBuffer(GL_PIXEL_PACK_BUFFER, m_DownloadPboIds[index]);
     glReadPixels(0, 0, m_RenderImage.width, m_RenderImage.height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-    END_TIME("DownloadPixels glReadPixels with PBO")
+    }
 
     if(m_DownloadImages[nextIndex].ppPlane[0] == nullptr)
     {
 		m_DownloadImages[nextIndex] = m_RenderImage;
 		m_DownloadImages[nextIndex].format = IMAGE_FORMAT_RGBA;
 
-		BEGIN_TIME("DownloadPixels PBO glMapBufferRange")
+		{ PROFILE_SCOPE("DownloadPixels PBO glMapBufferRange");
 			glBindBuffer(GL_PIXEL_PACK_BUFFER, m_DownloadPboIds[nextIndex]);
 			GLubyte *bufPtr = static_cast<GLubyte *>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
 																	  dataSize,
@@ -635,7 +636,7 @@ void PBOSample::DownloadPixels() {
 				//NativeImageUtil::DumpNativeImage(&nativeImage, "/sdcard/DCIM", "PBO");
 			}
 			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
-		END_TIME("DownloadPixels PBO glMapBufferRange")
+		}
 		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
     }
 
@@ -192,7 +192,7 @@ void PortraitModeSample::Init()
 
 void PortraitModeSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("PortraitModeSample::Draw");
+	LOGCATV("PortraitModeSample::Draw");
 	RenderToFrameBuffer(m_FastGaussianBlurProgramObj, m_SrcTexId, m_FboTextureId);
 	RenderToFrameBuffer(m_CircleBokehProgramObj, m_FboTextureId, m_SrcTexId);
 
@@ -276,7 +276,7 @@ bool PortraitModeSample::CreateFrameBufferObj()
 }
 
 int PortraitModeSample::RenderToFrameBuffer(GLuint program, GLuint srcTexId, GLuint dstTexId) {
-	LOGCATE("PortraitModeSample::RenderToFrameBuffer [program=%d, srcTexId=%d, dstTexId=%d]", program, srcTexId, dstTexId);
+	LOGCATV("PortraitModeSample::RenderToFrameBuffer [program=%d, srcTexId=%d, dstTexId=%d]", program, srcTexId, dstTexId);
 
 	glBindFramebuffer(GL_FRAMEBUFFER, m_FboId);
 	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, dstTexId, 0);
@@ -198,7 +198,7 @@ void PortraitStayColorExample::LoadImage(NativeImage *pImage)
 
 void PortraitStayColorExample::Draw(int screenW, int screenH)
 {
-	LOGCATE("PortraitStayColorExample::Draw()");
+	LOGCATV("PortraitStayColorExample::Draw()");
 
 	if(m_ProgramObj == GL_NONE || m_TextureId == GL_NONE) return;
 
@@ -258,7 +258,7 @@ void PortraitStayColorExample::Destroy()
  * */
 void PortraitStayColorExample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("PortraitStayColorExample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("PortraitStayColorExample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
 
@@ -7,10 +7,12 @@
  * */
 
 #include <GLUtils.h>
+#include <FrameProfiler.h>
 #include "RGB2I420Sample.h"
 
 #define VERTEX_POS_INDX  0
 #define TEXTURE_POS_INDX 1
+//#define RGB2I420_DUMP_IMAGE   // 开启后在回读完成回调里把 YUV 结果同步写到 DEFAULT_OGL_ASSETS_DIR，会阻塞 GL 线程
 
 RGB2I420Sample::RGB2I420Sample()
 {
@@ -22,11 +24,15 @@ RGB2I420Sample::RGB2I420Sample()
 	m_FboVertexShader = GL_NONE;
 	m_FboFragmentShader = GL_NONE;
 	m_FboSamplerLoc = GL_NONE;
+	m_Readback.SetCallback(OnReadbackDone, this);
+	m_ComputeConverter.SetCallback(OnReadbackDone, this);
+	m_Backend = YUV_BACKEND_FRAGMENT;
 }
 
 RGB2I420Sample::~RGB2I420Sample()
 {
 	NativeImageUtil::FreeNativeImage(&m_RenderImage);
+	NativeImageUtil::FreeNativeImage(&m_YuvImage);
 }
 
 void RGB2I420Sample::LoadImage(NativeImage *pImage)
@@ -43,6 +49,9 @@ void RGB2I420Sample::LoadImage(NativeImage *pImage)
 
 void RGB2I420Sample::Init()
 {
+	if (m_ProgramObj)
+		return;
+
 	//顶点坐标
 	GLfloat vVertices[] = {
 			-1.0f, -1.0f, 0.0f,
@@ -118,7 +127,7 @@ void RGB2I420Sample::Init()
     // 用于普通渲染的片段着色器脚本，简单纹理映射
     char fFboShaderStr[] =
 	    "#version 300 es\n"
-            "precision mediump float;\n"
+            "precision highp float;\n"
             "in vec2 v_texCoord;\n"
             "layout(location = 0) out vec4 outColor;\n"
             "uniform sampler2D s_TextureMap;\n"
@@ -133,7 +142,7 @@ void RGB2I420Sample::Init()
             "{\n"
             "    vec2 texelOffset = vec2(u_Offset, 0.0);\n"
             "    if(v_texCoord.y <= U_DIVIDE_LINE) {\n"
-            "        vec2 texCoord = vec2(v_texCoord.x, v_texCoord.y * 3.0 / 2.0);\n"
+            "        vec2 texCoord = vec2(v_texCoord.x - u_Offset * 1.5, v_texCoord.y * 3.0 / 2.0);\n"
             "        vec4 color0 = texture(s_TextureMap, texCoord);\n"
             "        vec4 color1 = texture(s_TextureMap, texCoord + texelOffset);\n"
             "        vec4 color2 = texture(s_TextureMap, texCoord + texelOffset * 2.0);\n"
@@ -146,13 +155,14 @@ void RGB2I420Sample::Init()
             "        outColor = vec4(y0, y1, y2, y3);\n"
             "    }\n"
             "    else if(v_texCoord.y <= V_DIVIDE_LINE){\n"
-            "        float offsetY = 1.0 / 3.0 / u_ImgSize.y;\n"
+            "        // 采样点落在 2x2 像素块的中心，线性过滤得到块内均值\n"
+            "        float offsetY = 1.0 / u_ImgSize.y;\n"
             "        vec2 texCoord;\n"
             "        if(v_texCoord.x <= 0.5) {\n"
-            "            texCoord = vec2(v_texCoord.x * 2.0, (v_texCoord.y - U_DIVIDE_LINE) * 2.0 * 3.0);\n"
+            "            texCoord = vec2(v_texCoord.x * 2.0 - u_Offset * 3.0, (v_texCoord.y - U_DIVIDE_LINE) * 2.0 * 3.0 - offsetY);\n"
             "        }\n"
             "        else {\n"
-            "            texCoord = vec2((v_texCoord.x - 0.5) * 2.0, ((v_texCoord.y - U_DIVIDE_LINE) * 2.0 + offsetY) * 3.0);\n"
+            "            texCoord = vec2((v_texCoord.x - 0.5) * 2.0 - u_Offset * 3.0, (v_texCoord.y - U_DIVIDE_LINE) * 2.0 * 3.0 + offsetY);\n"
             "        }\n"
             "\n"
             "        vec4 color0 = texture(s_TextureMap, texCoord);\n"
@@ -167,13 +177,13 @@ void RGB2I420Sample::Init()
             "        outColor = vec4(u0, u1, u2, u3);\n"
             "    }\n"
             "    else {\n"
-            "        float offsetY = 1.0 / 3.0 / u_ImgSize.y;\n"
+            "        float offsetY = 1.0 / u_ImgSize.y;\n"
             "        vec2 texCoord;\n"
             "        if(v_texCoord.x <= 0.5) {\n"
-            "            texCoord = vec2(v_texCoord.x * 2.0, (v_texCoord.y - V_DIVIDE_LINE) * 2.0 * 3.0);\n"
+            "            texCoord = vec2(v_texCoord.x * 2.0 - u_Offset * 3.0, (v_texCoord.y - V_DIVIDE_LINE) * 2.0 * 3.0 - offsetY);\n"
             "        }\n"
             "        else {\n"
-            "            texCoord = vec2((v_texCoord.x - 0.5) * 2.0, ((v_texCoord.y - V_DIVIDE_LINE) * 2.0 + offsetY) * 3.0);\n"
+            "            texCoord = vec2((v_texCoord.x - 0.5) * 2.0 - u_Offset * 3.0, (v_texCoord.y - V_DIVIDE_LINE) * 2.0 * 3.0 + offsetY);\n"
             "        }\n"
             "\n"
             "        vec4 color0 = texture(s_TextureMap, texCoord);\n"
@@ -271,7 +281,15 @@ void RGB2I420Sample::Init()
 	glBindTexture(GL_TEXTURE_2D, GL_NONE);
 	GO_CHECK_GL_ERROR();
 
-	if (!CreateFrameBufferObj())
+	m_Backend = ComputeYuvConverter::GetBackend();
+	if (m_Backend == YUV_BACKEND_COMPUTE && m_ComputeConverter.Init(IMAGE_FORMAT_I420) != 0)
+	{
+		LOGCATE("RGB2I420Sample::Init compute backend unavailable, fall back to fragment shader");
+		m_Backend = YUV_BACKEND_FRAGMENT;
+	}
+
+	// 计算着色器直接写 SSBO，不需要打包用的 FBO
+	if (m_Backend == YUV_BACKEND_FRAGMENT && !CreateFrameBufferObj())
 	{
 		LOGCATE("RGB2I420Sample::Init CreateFrameBufferObj fail");
 		return;
@@ -281,44 +299,43 @@ void RGB2I420Sample::Init()
 
 void RGB2I420Sample::Draw(int screenW, int screenH)
 {
-	// 离屏渲染
-	glPixelStorei(GL_UNPACK_ALIGNMENT,1);
-	// Do FBO off screen rendering
-	glBindFramebuffer(GL_FRAMEBUFFER, m_FboId);
-    // 渲染成 I420 宽度像素变为 1/4 宽度，高度为 height * 1.5
-    glViewport(0, 0, m_RenderImage.width / 4, m_RenderImage.height * 1.5);
-	glUseProgram(m_FboProgramObj);
-	glBindVertexArray(m_VaoIds[1]);
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, m_ImageTextureId);
-	glUniform1i(m_FboSamplerLoc, 0);
-	float texelOffset = (float) (1.f / (float) m_RenderImage.width);
-	GLUtils::setFloat(m_FboProgramObj, "u_Offset", texelOffset);
-    GLUtils::setVec2(m_FboProgramObj, "u_ImgSize", m_RenderImage.width, m_RenderImage.height);
-	GO_CHECK_GL_ERROR();
-	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (const void *)0);
-	GO_CHECK_GL_ERROR();
-	glBindVertexArray(0);
-	glBindTexture(GL_TEXTURE_2D, 0);
-
-	//I420 buffer = width * height * 1.5;
-	uint8_t *pBuffer = new uint8_t[m_RenderImage.width * m_RenderImage.height * 3 / 2];
-
-	NativeImage nativeImage = m_RenderImage;
-	nativeImage.format = IMAGE_FORMAT_I420;
-	nativeImage.ppPlane[0] = pBuffer;
-	nativeImage.ppPlane[1] = pBuffer + m_RenderImage.width * m_RenderImage.height;
-    nativeImage.ppPlane[2] = nativeImage.ppPlane[1] + m_RenderImage.width * m_RenderImage.height / 4;
-	BEGIN_TIME("FBO glReadPixels")
-		glReadPixels(0, 0, nativeImage.width / 4, nativeImage.height * 1.5, GL_RGBA, GL_UNSIGNED_BYTE, pBuffer);
-	END_TIME("FBO glReadPixels")
-
-	//保存 I420 格式的 YUV 图片
-	std::string path(DEFAULT_OGL_ASSETS_DIR);
-	NativeImageUtil::DumpNativeImage(&nativeImage, path.c_str(), "RGB2I420");
-	delete []pBuffer;
-
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	if (m_Backend == YUV_BACKEND_COMPUTE)
+	{
+		// 计算着色器直接输出平面 YUV，回读同样异步完成
+		PROFILE_SCOPE("RGB2I420 ComputeConvert");
+		m_ComputeConverter.Submit(m_ImageTextureId, m_RenderImage.width, m_RenderImage.height);
+		m_ComputeConverter.Poll();
+	}
+	else
+	{
+		// 离屏渲染
+		glPixelStorei(GL_UNPACK_ALIGNMENT,1);
+		// Do FBO off screen rendering
+		glBindFramebuffer(GL_FRAMEBUFFER, m_FboId);
+		// 渲染成 I420 宽度像素变为 1/4 宽度，高度为 height * 1.5
+		glViewport(0, 0, m_RenderImage.width / 4, m_RenderImage.height * 1.5);
+		glUseProgram(m_FboProgramObj);
+		glBindVertexArray(m_VaoIds[1]);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, m_ImageTextureId);
+		glUniform1i(m_FboSamplerLoc, 0);
+		float texelOffset = (float) (1.f / (float) m_RenderImage.width);
+		GLUtils::setFloat(m_FboProgramObj, "u_Offset", texelOffset);
+		GLUtils::setVec2(m_FboProgramObj, "u_ImgSize", m_RenderImage.width, m_RenderImage.height);
+		GO_CHECK_GL_ERROR();
+		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (const void *)0);
+		GO_CHECK_GL_ERROR();
+		glBindVertexArray(0);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		// 异步回读，结果在之后的帧通过 OnReadbackDone 回调，不阻塞当前帧
+		{ PROFILE_SCOPE("RGB2I420 AsyncReadback");
+			m_Readback.Submit(IMAGE_FORMAT_I420, m_RenderImage.width, m_RenderImage.height);
+			m_Readback.Poll();
+		}
+
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	}
 
 	// 普通渲染
 	// Do normal rendering
@@ -337,8 +354,39 @@ void RGB2I420Sample::Draw(int screenW, int screenH)
 
 }
 
+void RGB2I420Sample::OnReadbackDone(void *pContext, const NativeImage *pImage, int64_t frameId)
+{
+	RGB2I420Sample *pSample = static_cast<RGB2I420Sample *>(pContext);
+	NativeImage *pYuvImage = &pSample->m_YuvImage;
+	if (pYuvImage->ppPlane[0] == nullptr)
+	{
+		pYuvImage->width = pImage->width;
+		pYuvImage->height = pImage->height;
+		pYuvImage->format = pImage->format;
+	}
+	NativeImageUtil::CopyNativeImage(const_cast<NativeImage *>(pImage), pYuvImage);
+
+	//保存 I420 格式的 YUV 图片
+#ifdef RGB2I420_DUMP_IMAGE
+	std::string path(DEFAULT_OGL_ASSETS_DIR);
+	NativeImageUtil::DumpNativeImage(pYuvImage, path.c_str(), "RGB2I420");
+#endif
+}
+
+bool RGB2I420Sample::GetOutputImage(NativeImage *pImage)
+{
+	m_Readback.Flush();
+	m_ComputeConverter.Flush();
+	if (m_YuvImage.ppPlane[0] == nullptr) return false;
+	*pImage = m_YuvImage;
+	return true;
+}
+
 void RGB2I420Sample::Destroy()
 {
+	m_Readback.Destroy();
+	m_ComputeConverter.Destroy();
+
 	if (m_ProgramObj)
 	{
 		glDeleteProgram(m_ProgramObj);
@@ -11,6 +11,8 @@
 
 #include "GLSampleBase.h"
 #include "../util/ImageDef.h"
+#include "../util/AsyncReadback.h"
+#include "../util/ComputeYuvConverter.h"
 
 class RGB2I420Sample : public GLSampleBase
 {
@@ -26,8 +28,12 @@ public:
 
 	virtual void Destroy();
 
+	virtual bool GetOutputImage(NativeImage *pImage);
+
 	bool CreateFrameBufferObj();
 
+	static void OnReadbackDone(void *pContext, const NativeImage *pImage, int64_t frameId);
+
 private:
 	GLuint m_ImageTextureId;
 	GLuint m_FboTextureId;
@@ -36,6 +42,10 @@ private:
 	GLuint m_VboIds[4] = {GL_NONE};
 	GLint m_SamplerLoc;
 	NativeImage m_RenderImage;
+	NativeImage m_YuvImage; // 最近一次完成的回读结果，首次回调时分配后复用
+	AsyncReadback m_Readback;
+	ComputeYuvConverter m_ComputeConverter;
+	int m_Backend; // YUV_BACKEND_*，Init 时确定
 	GLuint m_FboProgramObj;
 	GLuint m_FboVertexShader;
 	GLuint m_FboFragmentShader;
@@ -7,10 +7,12 @@
  * */
 
 #include <GLUtils.h>
+#include <FrameProfiler.h>
 #include "RGB2NV21Sample.h"
 
 #define VERTEX_POS_INDX  0
 #define TEXTURE_POS_INDX 1
+//#define RGB2NV21_DUMP_IMAGE   // 开启后在回读完成回调里把 YUV 结果同步写到 DEFAULT_OGL_ASSETS_DIR，会阻塞 GL 线程
 
 RGB2NV21Sample::RGB2NV21Sample()
 {
@@ -22,11 +24,15 @@ RGB2NV21Sample::RGB2NV21Sample()
 	m_FboVertexShader = GL_NONE;
 	m_FboFragmentShader = GL_NONE;
 	m_FboSamplerLoc = GL_NONE;
+	m_Readback.SetCallback(OnReadbackDone, this);
+	m_ComputeConverter.SetCallback(OnReadbackDone, this);
+	m_Backend = YUV_BACKEND_FRAGMENT;
 }
 
 RGB2NV21Sample::~RGB2NV21Sample()
 {
 	NativeImageUtil::FreeNativeImage(&m_RenderImage);
+	NativeImageUtil::FreeNativeImage(&m_YuvImage);
 }
 
 void RGB2NV21Sample::LoadImage(NativeImage *pImage)
@@ -43,6 +49,9 @@ void RGB2NV21Sample::LoadImage(NativeImage *pImage)
 
 void RGB2NV21Sample::Init()
 {
+	if (m_ProgramObj)
+		return;
+
 	//顶点坐标
 	GLfloat vVertices[] = {
 			-1.0f, -1.0f, 0.0f,
@@ -119,7 +128,7 @@ void RGB2NV21Sample::Init()
 	// 用于离屏渲染的片段着色器脚本，RGB to YUV
 	char fFboShaderStr[] =
 			"#version 300 es\n"
-			"precision mediump float;\n"
+			"precision highp float;\n"
 			"in vec2 v_texCoord;\n"
 			"layout(location = 0) out vec4 outColor;\n"
 			"uniform sampler2D s_TextureMap;\n"
@@ -132,7 +141,7 @@ void RGB2NV21Sample::Init()
 			"{\n"
 			"    vec2 texelOffset = vec2(u_Offset, 0.0);\n"
 			"    if(v_texCoord.y <= UV_DIVIDE_LINE) {\n"
-			"        vec2 texCoord = vec2(v_texCoord.x, v_texCoord.y * 3.0 / 2.0);\n"
+			"        vec2 texCoord = vec2(v_texCoord.x - u_Offset * 1.5, v_texCoord.y * 3.0 / 2.0);\n"
 			"        vec4 color0 = texture(s_TextureMap, texCoord);\n"
 			"        vec4 color1 = texture(s_TextureMap, texCoord + texelOffset);\n"
 			"        vec4 color2 = texture(s_TextureMap, texCoord + texelOffset * 2.0);\n"
@@ -145,16 +154,15 @@ void RGB2NV21Sample::Init()
 			"        outColor = vec4(y0, y1, y2, y3);\n"
 			"    }\n"
 			"    else {\n"
+			"        // 采样点落在相邻两列像素的交界，线性过滤得到 2x2 像素块的均值\n"
 			"        vec2 texCoord = vec2(v_texCoord.x, (v_texCoord.y - UV_DIVIDE_LINE) * 3.0);\n"
-			"        vec4 color0 = texture(s_TextureMap, texCoord);\n"
+			"        vec4 color0 = texture(s_TextureMap, texCoord - texelOffset);\n"
 			"        vec4 color1 = texture(s_TextureMap, texCoord + texelOffset);\n"
-			"        vec4 color2 = texture(s_TextureMap, texCoord + texelOffset * 2.0);\n"
-			"        vec4 color3 = texture(s_TextureMap, texCoord + texelOffset * 3.0);\n"
 			"\n"
 			"        float v0 = dot(color0.rgb, COEF_V) + 0.502;\n"
-			"        float u0 = dot(color1.rgb, COEF_U) + 0.502;\n"
-			"        float v1 = dot(color2.rgb, COEF_V) + 0.502;\n"
-			"        float u1 = dot(color3.rgb, COEF_U) + 0.502;\n"
+			"        float u0 = dot(color0.rgb, COEF_U) + 0.502;\n"
+			"        float v1 = dot(color1.rgb, COEF_V) + 0.502;\n"
+			"        float u1 = dot(color1.rgb, COEF_U) + 0.502;\n"
 			"        outColor = vec4(v0, u0, v1, u1);\n"
 			"    }\n"
 			"}";
@@ -241,7 +249,15 @@ void RGB2NV21Sample::Init()
 	glBindTexture(GL_TEXTURE_2D, GL_NONE);
 	GO_CHECK_GL_ERROR();
 
-	if (!CreateFrameBufferObj())
+	m_Backend = ComputeYuvConverter::GetBackend();
+	if (m_Backend == YUV_BACKEND_COMPUTE && m_ComputeConverter.Init(IMAGE_FORMAT_NV21) != 0)
+	{
+		LOGCATE("RGB2NV21Sample::Init compute backend unavailable, fall back to fragment shader");
+		m_Backend = YUV_BACKEND_FRAGMENT;
+	}
+
+	// 计算着色器直接写 SSBO，不需要打包用的 FBO
+	if (m_Backend == YUV_BACKEND_FRAGMENT && !CreateFrameBufferObj())
 	{
 		LOGCATE("RGB2NV21Sample::Init CreateFrameBufferObj fail");
 		return;
@@ -251,42 +267,43 @@ void RGB2NV21Sample::Init()
 
 void RGB2NV21Sample::Draw(int screenW, int screenH)
 {
-	LOGCATE("RGB2NV21Sample::Draw");
-	// 离屏渲染
-	glPixelStorei(GL_UNPACK_ALIGNMENT,1);
-	// Do FBO off screen rendering
-	glBindFramebuffer(GL_FRAMEBUFFER, m_FboId);
-	// 渲染成 NV21 宽度像素变为 1/4 宽度，高度为 height * 1.5
-    glViewport(0, 0, m_RenderImage.width / 4, m_RenderImage.height * 1.5);
-	glUseProgram(m_FboProgramObj);
-	glBindVertexArray(m_VaoIds[1]);
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, m_ImageTextureId);
-	glUniform1i(m_FboSamplerLoc, 0);
-	float texelOffset = (float) (1.f / (float) m_RenderImage.width);
-	GLUtils::setFloat(m_FboProgramObj, "u_Offset", texelOffset);
-	GO_CHECK_GL_ERROR();
-	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (const void *)0);
-	GO_CHECK_GL_ERROR();
-	glBindVertexArray(0);
-	glBindTexture(GL_TEXTURE_2D, 0);
-
-	//NV21 buffer = width * height * 1.5;
-	uint8_t *pBuffer = new uint8_t[m_RenderImage.width * m_RenderImage.height * 3 / 2];
-
-	NativeImage nativeImage = m_RenderImage;
-	nativeImage.format = IMAGE_FORMAT_NV21;
-	nativeImage.ppPlane[0] = pBuffer;
-	nativeImage.ppPlane[1] = pBuffer + m_RenderImage.width * m_RenderImage.height;
-	FUN_BEGIN_TIME("RGB2NV21 glReadPixels")
-		glReadPixels(0, 0, nativeImage.width / 4, nativeImage.height * 1.5, GL_RGBA, GL_UNSIGNED_BYTE, pBuffer);
-	FUN_END_TIME("RGB2NV21 glReadPixels")
-
-	std::string path(DEFAULT_OGL_ASSETS_DIR);
-	NativeImageUtil::DumpNativeImage(&nativeImage, path.c_str(), "RGB2NV21");
-	delete []pBuffer;
-
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	LOGCATV("RGB2NV21Sample::Draw");
+	if (m_Backend == YUV_BACKEND_COMPUTE)
+	{
+		// 计算着色器直接输出平面 YUV，回读同样异步完成
+		PROFILE_SCOPE("RGB2NV21 ComputeConvert");
+		m_ComputeConverter.Submit(m_ImageTextureId, m_RenderImage.width, m_RenderImage.height);
+		m_ComputeConverter.Poll();
+	}
+	else
+	{
+		// 离屏渲染
+		glPixelStorei(GL_UNPACK_ALIGNMENT,1);
+		// Do FBO off screen rendering
+		glBindFramebuffer(GL_FRAMEBUFFER, m_FboId);
+		// 渲染成 NV21 宽度像素变为 1/4 宽度，高度为 height * 1.5
+		glViewport(0, 0, m_RenderImage.width / 4, m_RenderImage.height * 1.5);
+		glUseProgram(m_FboProgramObj);
+		glBindVertexArray(m_VaoIds[1]);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, m_ImageTextureId);
+		glUniform1i(m_FboSamplerLoc, 0);
+		float texelOffset = (float) (1.f / (float) m_RenderImage.width);
+		GLUtils::setFloat(m_FboProgramObj, "u_Offset", texelOffset);
+		GO_CHECK_GL_ERROR();
+		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (const void *)0);
+		GO_CHECK_GL_ERROR();
+		glBindVertexArray(0);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		// 异步回读，结果在之后的帧通过 OnReadbackDone 回调，不阻塞当前帧
+		{ PROFILE_SCOPE("RGB2NV21 AsyncReadback");
+			m_Readback.Submit(IMAGE_FORMAT_NV21, m_RenderImage.width, m_RenderImage.height);
+			m_Readback.Poll();
+		}
+
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	}
 
 	// 普通渲染
 	// Do normal rendering
@@ -305,8 +322,38 @@ void RGB2NV21Sample::Draw(int screenW, int screenH)
 
 }
 
+void RGB2NV21Sample::OnReadbackDone(void *pContext, const NativeImage *pImage, int64_t frameId)
+{
+	RGB2NV21Sample *pSample = static_cast<RGB2NV21Sample *>(pContext);
+	NativeImage *pYuvImage = &pSample->m_YuvImage;
+	if (pYuvImage->ppPlane[0] == nullptr)
+	{
+		pYuvImage->width = pImage->width;
+		pYuvImage->height = pImage->height;
+		pYuvImage->format = pImage->format;
+	}
+	NativeImageUtil::CopyNativeImage(const_cast<NativeImage *>(pImage), pYuvImage);
+
+#ifdef RGB2NV21_DUMP_IMAGE
+	std::string path(DEFAULT_OGL_ASSETS_DIR);
+	NativeImageUtil::DumpNativeImage(pYuvImage, path.c_str(), "RGB2NV21");
+#endif
+}
+
+bool RGB2NV21Sample::GetOutputImage(NativeImage *pImage)
+{
+	m_Readback.Flush();
+	m_ComputeConverter.Flush();
+	if (m_YuvImage.ppPlane[0] == nullptr) return false;
+	*pImage = m_YuvImage;
+	return true;
+}
+
 void RGB2NV21Sample::Destroy()
 {
+	m_Readback.Destroy();
+	m_ComputeConverter.Destroy();
+
 	if (m_ProgramObj)
 	{
 		glDeleteProgram(m_ProgramObj);
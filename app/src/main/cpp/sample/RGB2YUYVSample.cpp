@@ -7,10 +7,12 @@
  * */
 
 #include <GLUtils.h>
+#include <FrameProfiler.h>
 #include "RGB2YUYVSample.h"
 
 #define VERTEX_POS_INDX  0
 #define TEXTURE_POS_INDX 1
+//#define RGB2YUYV_DUMP_IMAGE   // 开启后在回读完成回调里把 YUV 结果同步写到 DEFAULT_OGL_ASSETS_DIR，会阻塞 GL 线程
 
 RGB2YUYVSample::RGB2YUYVSample()
 {
@@ -22,11 +24,15 @@ RGB2YUYVSample::RGB2YUYVSample()
 	m_FboVertexShader = GL_NONE;
 	m_FboFragmentShader = GL_NONE;
 	m_FboSamplerLoc = GL_NONE;
+	m_Readback.SetCallback(OnReadbackDone, this);
+	m_ComputeConverter.SetCallback(OnReadbackDone, this);
+	m_Backend = YUV_BACKEND_FRAGMENT;
 }
 
 RGB2YUYVSample::~RGB2YUYVSample()
 {
 	NativeImageUtil::FreeNativeImage(&m_RenderImage);
+	NativeImageUtil::FreeNativeImage(&m_YuvImage);
 }
 
 void RGB2YUYVSample::LoadImage(NativeImage *pImage)
@@ -43,6 +49,9 @@ void RGB2YUYVSample::LoadImage(NativeImage *pImage)
 
 void RGB2YUYVSample::Init()
 {
+	if (m_ProgramObj)
+		return;
+
 	//顶点坐标
 	GLfloat vVertices[] = {
 			-1.0f, -1.0f, 0.0f,
@@ -119,7 +128,7 @@ void RGB2YUYVSample::Init()
 	// 用于离屏渲染的片段着色器脚本，RGB to YUV
 	char fFboShaderStr[] =
 			"#version 300 es\n"
-			"precision mediump float;\n"
+			"precision highp float;\n"
 			"in vec2 v_texCoord;\n"
 			"layout(location = 0) out vec4 outColor;\n"
 			"uniform sampler2D s_TextureMap;\n"
@@ -131,11 +140,13 @@ void RGB2YUYVSample::Init()
 			"void main()\n"
 			"{\n"
 			"    vec2 texelOffset = vec2(u_Offset, 0.0);\n"
-			"    vec4 color0 = texture(s_TextureMap, v_texCoord);\n"
-			"    vec4 color1 = texture(s_TextureMap, v_texCoord + texelOffset);\n"
+			"    // 输出像素中心位于两个输入像素的交界，各偏移半个像素取到像素中心\n"
+			"    vec4 color0 = texture(s_TextureMap, v_texCoord - texelOffset * 0.5);\n"
+			"    vec4 color1 = texture(s_TextureMap, v_texCoord + texelOffset * 0.5);\n"
+			"    vec3 color = (color0.rgb + color1.rgb) * 0.5;\n"
 			"    float y0 = dot(color0.rgb, COEF_Y) + 0.063;\n"
-			"    float u0 = dot(color0.rgb, COEF_U) + 0.502;\n"
-			"    float v0 = dot(color0.rgb, COEF_V) + 0.502;\n"
+			"    float u0 = dot(color, COEF_U) + 0.502;\n"
+			"    float v0 = dot(color, COEF_V) + 0.502;\n"
 			"    float y1 = dot(color1.rgb, COEF_Y) + 0.063;\n"
 			"    outColor = vec4(y0, u0, y1, v0);\n"
 			"}";
@@ -222,7 +233,15 @@ void RGB2YUYVSample::Init()
 	glBindTexture(GL_TEXTURE_2D, GL_NONE);
 	GO_CHECK_GL_ERROR();
 
-	if (!CreateFrameBufferObj())
+	m_Backend = ComputeYuvConverter::GetBackend();
+	if (m_Backend == YUV_BACKEND_COMPUTE && m_ComputeConverter.Init(IMAGE_FORMAT_YUYV) != 0)
+	{
+		LOGCATE("RGB2YUYVSample::Init compute backend unavailable, fall back to fragment shader");
+		m_Backend = YUV_BACKEND_FRAGMENT;
+	}
+
+	// 计算着色器直接写 SSBO，不需要打包用的 FBO
+	if (m_Backend == YUV_BACKEND_FRAGMENT && !CreateFrameBufferObj())
 	{
 		LOGCATE("RGB2YUYVSample::Init CreateFrameBufferObj fail");
 		return;
@@ -232,40 +251,42 @@ void RGB2YUYVSample::Init()
 
 void RGB2YUYVSample::Draw(int screenW, int screenH)
 {
-	// 离屏渲染
-	glPixelStorei(GL_UNPACK_ALIGNMENT,1);
-	// Do FBO off screen rendering
-	glBindFramebuffer(GL_FRAMEBUFFER, m_FboId);
-    // 渲染成 yuyv 宽度像素减半,glviewport 宽度减半
-    glViewport(0, 0, m_RenderImage.width / 2, m_RenderImage.height);
-	glUseProgram(m_FboProgramObj);
-	glBindVertexArray(m_VaoIds[1]);
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, m_ImageTextureId);
-	glUniform1i(m_FboSamplerLoc, 0);
-	float texelOffset = (float) (1.f / (float) m_RenderImage.width);
-	GLUtils::setFloat(m_FboProgramObj, "u_Offset", texelOffset);
-	GO_CHECK_GL_ERROR();
-	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (const void *)0);
-	GO_CHECK_GL_ERROR();
-	glBindVertexArray(0);
-	glBindTexture(GL_TEXTURE_2D, 0);
-
-	//YUYV buffer = width * height * 2;
-	uint8_t *pBuffer = new uint8_t[m_RenderImage.width * m_RenderImage.height * 2];
-
-	NativeImage nativeImage = m_RenderImage;
-	nativeImage.format = IMAGE_FORMAT_YUYV;
-	nativeImage.ppPlane[0] = pBuffer;
-	FUN_BEGIN_TIME("FBO glReadPixels")
-		glReadPixels(0, 0, m_RenderImage.width / 2, nativeImage.height, GL_RGBA, GL_UNSIGNED_BYTE, pBuffer);
-	FUN_END_TIME("FBO cost glReadPixels")
-
-	std::string path(DEFAULT_OGL_ASSETS_DIR);
-	NativeImageUtil::DumpNativeImage(&nativeImage, path.c_str(), "RGB2YUV");
-	delete []pBuffer;
-
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	if (m_Backend == YUV_BACKEND_COMPUTE)
+	{
+		// 计算着色器直接输出平面 YUV，回读同样异步完成
+		PROFILE_SCOPE("RGB2YUYV ComputeConvert");
+		m_ComputeConverter.Submit(m_ImageTextureId, m_RenderImage.width, m_RenderImage.height);
+		m_ComputeConverter.Poll();
+	}
+	else
+	{
+		// 离屏渲染
+		glPixelStorei(GL_UNPACK_ALIGNMENT,1);
+		// Do FBO off screen rendering
+		glBindFramebuffer(GL_FRAMEBUFFER, m_FboId);
+		// 渲染成 yuyv 宽度像素减半,glviewport 宽度减半
+		glViewport(0, 0, m_RenderImage.width / 2, m_RenderImage.height);
+		glUseProgram(m_FboProgramObj);
+		glBindVertexArray(m_VaoIds[1]);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, m_ImageTextureId);
+		glUniform1i(m_FboSamplerLoc, 0);
+		float texelOffset = (float) (1.f / (float) m_RenderImage.width);
+		GLUtils::setFloat(m_FboProgramObj, "u_Offset", texelOffset);
+		GO_CHECK_GL_ERROR();
+		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (const void *)0);
+		GO_CHECK_GL_ERROR();
+		glBindVertexArray(0);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		// 异步回读，结果在之后的帧通过 OnReadbackDone 回调，不阻塞当前帧
+		{ PROFILE_SCOPE("RGB2YUYV AsyncReadback");
+			m_Readback.Submit(IMAGE_FORMAT_YUYV, m_RenderImage.width, m_RenderImage.height);
+			m_Readback.Poll();
+		}
+
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	}
 
 	// 普通渲染
 	// Do normal rendering
@@ -284,8 +305,38 @@ void RGB2YUYVSample::Draw(int screenW, int screenH)
 
 }
 
+void RGB2YUYVSample::OnReadbackDone(void *pContext, const NativeImage *pImage, int64_t frameId)
+{
+	RGB2YUYVSample *pSample = static_cast<RGB2YUYVSample *>(pContext);
+	NativeImage *pYuvImage = &pSample->m_YuvImage;
+	if (pYuvImage->ppPlane[0] == nullptr)
+	{
+		pYuvImage->width = pImage->width;
+		pYuvImage->height = pImage->height;
+		pYuvImage->format = pImage->format;
+	}
+	NativeImageUtil::CopyNativeImage(const_cast<NativeImage *>(pImage), pYuvImage);
+
+#ifdef RGB2YUYV_DUMP_IMAGE
+	std::string path(DEFAULT_OGL_ASSETS_DIR);
+	NativeImageUtil::DumpNativeImage(pYuvImage, path.c_str(), "RGB2YUV");
+#endif
+}
+
+bool RGB2YUYVSample::GetOutputImage(NativeImage *pImage)
+{
+	m_Readback.Flush();
+	m_ComputeConverter.Flush();
+	if (m_YuvImage.ppPlane[0] == nullptr) return false;
+	*pImage = m_YuvImage;
+	return true;
+}
+
 void RGB2YUYVSample::Destroy()
 {
+	m_Readback.Destroy();
+	m_ComputeConverter.Destroy();
+
 	if (m_ProgramObj)
 	{
 		glDeleteProgram(m_ProgramObj);
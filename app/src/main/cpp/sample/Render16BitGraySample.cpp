@@ -14,6 +14,16 @@
 void Render16BitGraySample::LoadImage(NativeImage *pImage)
 {
 	NativeImageUtil::FreeNativeImage(&m_RenderImage);
+	// 传入的图像格式匹配时直接使用，否则读取 sdcard 上的测试图
+	if (pImage && pImage->format == IMAGE_FORMAT_GRAY10)
+	{
+		m_RenderImage.width = pImage->width;
+		m_RenderImage.height = pImage->height;
+		m_RenderImage.format = pImage->format;
+		NativeImageUtil::CopyNativeImage(pImage, &m_RenderImage);
+		m_bImageDirty = true;
+		return;
+	}
 	if(m_RenderImage.ppPlane[0] == nullptr) {
 		m_RenderImage.width = 4406;
 		m_RenderImage.height = 3108;
@@ -21,11 +31,14 @@ void Render16BitGraySample::LoadImage(NativeImage *pImage)
 		NativeImageUtil::AllocNativeImage(&m_RenderImage);
 	}
 	NativeImageUtil::LoadNativeImage(&m_RenderImage, IMAGE_PATH);
+	m_bImageDirty = true;
 	//YUVP010Example::YUVP010Test();
 }
 
 void Render16BitGraySample::Init()
 {
+	if (m_ProgramObj) return;
+
 	char vShaderStr[] =R"(
 			#version 300 es
 			layout(location = 0) in vec4 a_position;
@@ -37,51 +50,44 @@ void Render16BitGraySample::Init()
 			   v_texCoord = a_texCoord;
 			})";
 
+	// #version and Sample16() come from Texture16Support
 	char fShaderStr[] =R"(
-			#version 300 es
-			precision highp float;
 			in vec2 v_texCoord;
-			uniform sampler2D y_texture;
+			uniform SAMPLER16 y_texture;
 			out vec4 outColor;
 			void main() {
-				vec4 col = texture(y_texture, v_texCoord);
-				float val = 255.0 * col.r + col.a * 255.0 * pow(2.0, 8.0);
-				outColor = vec4(vec3(val / 65535.0), 1.0);
+				outColor = vec4(vec3(Sample16(y_texture, v_texCoord).r), 1.0);
 			})";
 
 	// Load the shaders and get a linked program object
-	m_ProgramObj= GLUtils::CreateProgram(vShaderStr, fShaderStr, m_VertexShader, m_FragmentShader);
+	m_Texture16Path = Texture16Support::ProbePath();
+	std::string fShader = std::string(Texture16Support::GetShaderPrefix(m_Texture16Path)) + fShaderStr;
+	m_ProgramObj= GLUtils::CreateProgram(vShaderStr, fShader.c_str(), m_VertexShader, m_FragmentShader);
 
 	// Get the sampler location
 	m_ySamplerLoc = glGetUniformLocation (m_ProgramObj, "y_texture" );
 
-	//create textures
-	GLuint textureIds[1] = {0};
-	glGenTextures(1, textureIds);
-
-	m_yTextureId = textureIds[0];
-
-	LoadImage(nullptr);
-
-	//upload Y plane data
-	glBindTexture(GL_TEXTURE_2D, m_yTextureId);
-	//GL_R16F, GL_RED, GL_HALF_FLOAT
-	glTexImage2D ( GL_TEXTURE_2D, 0, GL_LUMINANCE_ALPHA, m_RenderImage.width, m_RenderImage.height, 0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, m_RenderImage.ppPlane[0]);
-    //glTexImage2D ( GL_TEXTURE_2D, 0, GL_R16UI, m_RenderImage.width,m_RenderImage.height, 0, GL_RED_INTEGER, GL_UNSIGNED_SHORT, m_RenderImage.ppPlane[0]);
-
-	//glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, m_RenderImage.width, m_RenderImage.height, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, m_RenderImage.ppPlane[0]);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glBindTexture(GL_TEXTURE_2D, GL_NONE);
+	if (m_RenderImage.ppPlane[0] == nullptr) LoadImage(nullptr);
+	// 上传路径可能变化，重新按新的纹理格式上传
+	m_bImageDirty = true;
 }
 
 void Render16BitGraySample::Draw(int screenW, int screenH)
 {
-	LOGCATE("Render16BitGraySample::Draw()");
+	LOGCATV("Render16BitGraySample::Draw()");
+
+	if(m_ProgramObj == GL_NONE) return;
 
-	if(m_ProgramObj == GL_NONE || m_yTextureId == GL_NONE) return;
+	// upload the 16bit gray plane (width x height) when the image changed
+	if (m_bImageDirty)
+	{
+		m_bImageDirty = false;
+		StreamingPlaneDesc plane;
+		Texture16Support::GetPlaneDesc(m_Texture16Path, 1, m_RenderImage.width, m_RenderImage.height, 0, plane);
+		m_Uploader.Upload(&m_RenderImage, &plane, 1);
+	}
+	GLuint textureId = m_Uploader.GetTextureId(0);
+	if(textureId == GL_NONE) return;
 
 	GLfloat verticesCoords[] = {
 			-1.0f,  1.0f, 0.0f,  // Position 0
@@ -114,7 +120,7 @@ void Render16BitGraySample::Draw(int screenW, int screenH)
 
 	// Bind the Y plane map
 	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, m_yTextureId);
+	glBindTexture(GL_TEXTURE_2D, textureId);
 
 	// Set the Y plane sampler to texture unit to 0
 	glUniform1i(m_ySamplerLoc, 0);
@@ -127,7 +133,8 @@ void Render16BitGraySample::Destroy()
 	if (m_ProgramObj)
 	{
 		glDeleteProgram(m_ProgramObj);
-		glDeleteTextures(1, &m_yTextureId);
+		m_Uploader.Destroy();
 		m_ProgramObj = GL_NONE;
+		m_bImageDirty = true;
 	}
 }
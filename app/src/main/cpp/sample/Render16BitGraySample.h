@@ -12,15 +12,17 @@
 
 #include "GLSampleBase.h"
 #include "../util/ImageDef.h"
+#include "../util/StreamingTextureUploader.h"
+#include "../util/Texture16Support.h"
 
 class Render16BitGraySample: public GLSampleBase
 {
 public:
 	Render16BitGraySample()
 	{
-		m_yTextureId = GL_NONE;
-
 		m_ySamplerLoc = GL_NONE;
+		m_bImageDirty = false;
+		m_Texture16Path = TEXTURE16_PATH_PACKED;
 
 	}
 
@@ -38,11 +40,12 @@ public:
 	virtual void Destroy();
 
 private:
-	GLuint m_yTextureId;
-
 	GLint m_ySamplerLoc;
 
 	NativeImage m_RenderImage;
+	volatile bool m_bImageDirty;   // LoadImage 后置位，Draw 中上传
+	StreamingTextureUploader m_Uploader;
+	int m_Texture16Path;           // TEXTURE16_PATH_*，Init 时探测
 
 };
 
@@ -36,6 +36,7 @@ void RenderI420Sample::LoadImage(NativeImage *pImage)
 		m_RenderImage.height = pImage->height;
 		m_RenderImage.format = pImage->format;
 		NativeImageUtil::CopyNativeImage(pImage, &m_RenderImage);
+		m_bImageDirty = true;
 	}
 }
 
@@ -45,6 +46,8 @@ void RenderI420Sample::LoadImage(NativeImage *pImage)
  */
 void RenderI420Sample::Init()
 {
+	if (m_ProgramObj) return;
+
 	// 顶点着色器: 传递顶点位置和纹理坐标
 	char vShaderStr[] =R"(
 			#version 300 es
@@ -97,8 +100,8 @@ void RenderI420Sample::Init()
 				// 计算 U 采样位置 (像素坐标)
 				vec2 pixelUV = v_texCoord * inputSize;
 				// I420 U 平面布局: 奇数行在右半部分, 偶数行在左半部分
-				// mod(pixelUV.y/2.0, 2.0) > 0.001: 判断是否为奇数行
-				pixelUV.x = mod(pixelUV.y/2.0, 2.0) > 0.001 ? pixelUV.x / 2.0 + inputSize.x / 2.0 : pixelUV.x / 2.0;
+				// pixelUV.y 是像素中心坐标, 取整后再判断对应的 U 行是否为奇数行
+				pixelUV.x = mod(floor(pixelUV.y/2.0), 2.0) > 0.5 ? pixelUV.x / 2.0 + inputSize.x / 2.0 : pixelUV.x / 2.0;
 				// Y 坐标: 每 4 行 Y 对应 1 行 U
 				pixelUV.y = floor(pixelUV.y / 4.0);
 				// 偏移到 U 平面区域 (加上 Y 平面高度)
@@ -108,7 +111,7 @@ void RenderI420Sample::Init()
 
 				// 计算 V 采样位置 (类似 U 采样)
 				pixelUV = v_texCoord * inputSize;
-				pixelUV.x = mod(pixelUV.y/2.0, 2.0) > 0.001 ? pixelUV.x / 2.0 + inputSize.x / 2.0 : pixelUV.x / 2.0;
+				pixelUV.x = mod(floor(pixelUV.y/2.0), 2.0) > 0.5 ? pixelUV.x / 2.0 + inputSize.x / 2.0 : pixelUV.x / 2.0;
 				pixelUV.y = floor(pixelUV.y / 4.0);
 				// 偏移到 V 平面区域 (Y 平面 + U 平面高度)
 				pixelUV.y += inputSize.y * 5.0 / 4.0;
@@ -129,29 +132,6 @@ void RenderI420Sample::Init()
 
 	// 获取纹理采样器的 uniform 位置
 	m_TextureLoc = glGetUniformLocation (m_ProgramObj, "y_texture" );
-
-	// 创建单个纹理对象 (存储 Y + U + V 数据)
-	GLuint textureIds[1] = {0};
-	glGenTextures(1, textureIds);
-
-	m_TextureId = textureIds[0];
-
-	/**
-	 * 上传 I420 数据到纹理
-	 * - 格式: GL_LUMINANCE (单通道)
-	 * - 尺寸: width × (height × 1.5)
-	 * - 数据布局:
-	 *   [0, width*height): Y 平面数据
-	 *   [width*height, width*height*1.25): U 平面数据
-	 *   [width*height*1.25, width*height*1.5): V 平面数据
-	 */
-	glBindTexture(GL_TEXTURE_2D, m_TextureId);
-	glTexImage2D ( GL_TEXTURE_2D, 0, GL_LUMINANCE, m_RenderImage.width, m_RenderImage.height * 3 / 2, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, m_RenderImage.ppPlane[0]);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glBindTexture(GL_TEXTURE_2D, GL_NONE);
 }
 
 /**
@@ -161,10 +141,28 @@ void RenderI420Sample::Init()
  */
 void RenderI420Sample::Draw(int screenW, int screenH)
 {
-	LOGCATE("RenderI420Sample::Draw()");
-	// 设置像素对齐方式为 1 字节 (处理非 4 字节对齐的数据)
-	glPixelStorei(GL_UNPACK_ALIGNMENT,1);
-	if(m_ProgramObj == GL_NONE || m_TextureId == GL_NONE) return;
+	LOGCATV("RenderI420Sample::Draw()");
+	if(m_ProgramObj == GL_NONE) return;
+
+	/**
+	 * 图像更新后才上传 I420 数据
+	 * - 格式: GL_R8 (单通道)
+	 * - 尺寸: width × (height × 1.5), 存储只在尺寸变化时分配
+	 * - 数据布局:
+	 *   [0, width*height): Y 平面数据
+	 *   [width*height, width*height*1.25): U 平面数据
+	 *   [width*height*1.25, width*height*1.5): V 平面数据
+	 */
+	if (m_bImageDirty)
+	{
+		m_bImageDirty = false;
+		StreamingPlaneDesc plane;
+		plane.width = m_RenderImage.width;
+		plane.height = m_RenderImage.height * 3 / 2;
+		m_Uploader.Upload(&m_RenderImage, &plane, 1);
+	}
+	GLuint textureId = m_Uploader.GetTextureId(0);
+	if(textureId == GL_NONE) return;
 
 	// 顶点坐标 (NDC 归一化设备坐标, 全屏矩形)
 	GLfloat verticesCoords[] = {
@@ -200,7 +198,7 @@ void RenderI420Sample::Draw(int screenW, int screenH)
 
 	// 绑定纹理到纹理单元 0
 	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, m_TextureId);
+	glBindTexture(GL_TEXTURE_2D, textureId);
 
 	// 设置采样器对应纹理单元 0
 	glUniform1i(m_TextureLoc, 0);
@@ -221,7 +219,8 @@ void RenderI420Sample::Destroy()
 	if (m_ProgramObj)
 	{
 		glDeleteProgram(m_ProgramObj);
-		glDeleteTextures(1, &m_TextureId);
+		m_Uploader.Destroy();
 		m_ProgramObj = GL_NONE;
+		m_bImageDirty = true;
 	}
 }
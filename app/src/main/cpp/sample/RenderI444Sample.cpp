@@ -86,7 +86,7 @@ void RenderI444Sample::Init()
 
 void RenderI444Sample::Draw(int screenW, int screenH)
 {
-	LOGCATE("RenderI444Sample::Draw()");
+	LOGCATV("RenderI444Sample::Draw()");
 	glPixelStorei(GL_UNPACK_ALIGNMENT,1);
 	if(m_ProgramObj == GL_NONE || m_TextureId == GL_NONE) return;
 
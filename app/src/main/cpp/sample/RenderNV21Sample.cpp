@@ -30,6 +30,7 @@ void RenderNV21Sample::LoadImage(NativeImage *pImage)
 		m_RenderImage.height = pImage->height;
 		m_RenderImage.format = pImage->format;
 		NativeImageUtil::CopyNativeImage(pImage, &m_RenderImage);
+		m_bImageDirty = true;
 	}
 }
 
@@ -39,6 +40,8 @@ void RenderNV21Sample::LoadImage(NativeImage *pImage)
  */
 void RenderNV21Sample::Init()
 {
+	if (m_ProgramObj) return;
+
 	// 顶点着色器: 传递顶点位置和纹理坐标
 	char vShaderStr[] =R"(
 			#version 300 es
@@ -73,7 +76,6 @@ void RenderNV21Sample::Init()
 	 */
 	char fShaderStr[] =R"(
 		#version 300 es
-		#extension GL_EXT_YUV_target: require
 		precision highp float;
 		in vec2 v_texCoord;
 		uniform sampler2D y_texture;
@@ -114,29 +116,6 @@ void RenderNV21Sample::Init()
 
 	// 获取纹理采样器的 uniform 位置
 	m_TextureLoc = glGetUniformLocation (m_ProgramObj, "y_texture" );
-
-	// 创建单个纹理对象 (存储 Y + VU 数据)
-	GLuint textureIds[1] = {0};
-	glGenTextures(1, textureIds);
-
-	m_TextureId = textureIds[0];
-
-	/**
-	 * 上传 NV21 数据到纹理
-	 * - 格式: GL_LUMINANCE (单通道)
-	 * - 尺寸: width × (height × 1.5)
-	 * - 数据布局:
-	 *   [0, width*height): Y 平面数据
-	 *   [width*height, width*height*1.5): VU 交错数据
-	 */
-	glBindTexture(GL_TEXTURE_2D, m_TextureId);
-	glTexImage2D ( GL_TEXTURE_2D, 0, GL_LUMINANCE, m_RenderImage.width, m_RenderImage.height * 3 / 2, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, m_RenderImage.ppPlane[0]);
-
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glBindTexture(GL_TEXTURE_2D, GL_NONE);
 }
 
 /**
@@ -146,10 +125,27 @@ void RenderNV21Sample::Init()
  */
 void RenderNV21Sample::Draw(int screenW, int screenH)
 {
-	LOGCATE("RenderNV21Sample::Draw()");
-	// 设置像素对齐方式为 1 字节 (处理非 4 字节对齐的数据)
-	glPixelStorei(GL_UNPACK_ALIGNMENT,1);
-	if(m_ProgramObj == GL_NONE || m_TextureId == GL_NONE) return;
+	LOGCATV("RenderNV21Sample::Draw()");
+	if(m_ProgramObj == GL_NONE) return;
+
+	/**
+	 * 图像更新后才上传 NV21 数据
+	 * - 格式: GL_R8 (单通道)
+	 * - 尺寸: width × (height × 1.5), 存储只在尺寸变化时分配
+	 * - 数据布局:
+	 *   [0, width*height): Y 平面数据
+	 *   [width*height, width*height*1.5): VU 交错数据
+	 */
+	if (m_bImageDirty)
+	{
+		m_bImageDirty = false;
+		StreamingPlaneDesc plane;
+		plane.width = m_RenderImage.width;
+		plane.height = m_RenderImage.height * 3 / 2;
+		m_Uploader.Upload(&m_RenderImage, &plane, 1);
+	}
+	GLuint textureId = m_Uploader.GetTextureId(0);
+	if(textureId == GL_NONE) return;
 
 	// 顶点坐标 (NDC 归一化设备坐标, 全屏矩形)
 	GLfloat verticesCoords[] = {
@@ -185,7 +181,7 @@ void RenderNV21Sample::Draw(int screenW, int screenH)
 
 	// 绑定纹理到纹理单元 0
 	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, m_TextureId);
+	glBindTexture(GL_TEXTURE_2D, textureId);
 
 	// 设置采样器对应纹理单元 0
 	glUniform1i(m_TextureLoc, 0);
@@ -206,7 +202,8 @@ void RenderNV21Sample::Destroy()
 	if (m_ProgramObj)
 	{
 		glDeleteProgram(m_ProgramObj);
-		glDeleteTextures(1, &m_TextureId);
+		m_Uploader.Destroy();
 		m_ProgramObj = GL_NONE;
+		m_bImageDirty = true;
 	}
 }
@@ -14,6 +14,16 @@
 void RenderP010Sample::LoadImage(NativeImage *pImage)
 {
 	NativeImageUtil::FreeNativeImage(&m_RenderImage);
+	// 传入的图像格式匹配时直接使用，否则读取 sdcard 上的测试图
+	if (pImage && pImage->format == IMAGE_FORMAT_P010)
+	{
+		m_RenderImage.width = pImage->width;
+		m_RenderImage.height = pImage->height;
+		m_RenderImage.format = pImage->format;
+		NativeImageUtil::CopyNativeImage(pImage, &m_RenderImage);
+		m_bImageDirty = true;
+		return;
+	}
 	if(m_RenderImage.ppPlane[0] == nullptr) {
 		m_RenderImage.width = 4406;
 		m_RenderImage.height = 3108;
@@ -21,12 +31,15 @@ void RenderP010Sample::LoadImage(NativeImage *pImage)
 		NativeImageUtil::AllocNativeImage(&m_RenderImage);
 	}
 	NativeImageUtil::LoadNativeImage(&m_RenderImage, IMAGE_PATH);
+	m_bImageDirty = true;
 
 	//YUVP010Example::YUVP010Test();
 }
 
 void RenderP010Sample::Init()
 {
+	if (m_ProgramObj) return;
+
 	char vShaderStr[] =R"(
 			#version 300 es
 			layout(location = 0) in vec4 a_position;
@@ -38,25 +51,17 @@ void RenderP010Sample::Init()
 			   v_texCoord = a_texCoord;
 			})";
 
+	// #version and Sample16() come from Texture16Support, the UV plane stores V before U
 	char fShaderStr[] =R"(
-				#version 300 es
-				precision highp float;
 				in vec2 v_texCoord;
-				uniform sampler2D y_texture;
-				uniform sampler2D uv_texture;
+				uniform SAMPLER16 y_texture;
+				uniform SAMPLER16 uv_texture;
 				out vec4 outColor;
 				void main() {
-					vec4 yCol = texture(y_texture, v_texCoord);
-					vec4 uvCol = texture(uv_texture, v_texCoord);
-
-					float val = 255.0 * yCol.r + yCol.a * 255.0 * pow(2.0, 8.0);
-					float yVal = val / 65535.0 - 0.063;
-
-					val = 255.0 * uvCol.r + uvCol.g * 255.0 * pow(2.0, 8.0);
-					float vVal = val / 65535.0 - 0.502;
-
-					val = 255.0 * uvCol.b + uvCol.a * 255.0 * pow(2.0, 8.0);
-					float uVal = val / 65535.0 - 0.502;
+					float yVal = Sample16(y_texture, v_texCoord).r - 0.063;
+					vec2 vu = Sample16(uv_texture, v_texCoord).rg;
+					float vVal = vu.x - 0.502;
+					float uVal = vu.y - 0.502;
 
 					highp vec3 rgb = mat3(1.164, 1.164, 1.164,
 											  0, -0.392, 2.017,
@@ -66,49 +71,36 @@ void RenderP010Sample::Init()
 )";
 
 	// Load the shaders and get a linked program object
-	m_ProgramObj= GLUtils::CreateProgram(vShaderStr, fShaderStr, m_VertexShader, m_FragmentShader);
+	m_Texture16Path = Texture16Support::ProbePath();
+	std::string fShader = std::string(Texture16Support::GetShaderPrefix(m_Texture16Path)) + fShaderStr;
+	m_ProgramObj= GLUtils::CreateProgram(vShaderStr, fShader.c_str(), m_VertexShader, m_FragmentShader);
 
 	// Get the sampler location
 	m_ySamplerLoc = glGetUniformLocation (m_ProgramObj, "y_texture" );
 	m_uvSamplerLoc = glGetUniformLocation(m_ProgramObj, "uv_texture");
 
-
-	//create textures
-	GLuint textureIds[2] = {0};
-	glGenTextures(2, textureIds);
-
-	m_yTextureId = textureIds[0];
-	m_uvTextureId = textureIds[1];
-
-	LoadImage(nullptr);
-
-	//upload Y plane data
-	glBindTexture(GL_TEXTURE_2D, m_yTextureId);
-	//GL_R16F, GL_RED, GL_HALF_FLOAT
-	glTexImage2D ( GL_TEXTURE_2D, 0, GL_LUMINANCE_ALPHA, m_RenderImage.width, m_RenderImage.height, 0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, m_RenderImage.ppPlane[0]);
-
-	//glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, m_RenderImage.width, m_RenderImage.height, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, m_RenderImage.ppPlane[0]);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glBindTexture(GL_TEXTURE_2D, GL_NONE);
-
-	//update UV plane data
-	glBindTexture(GL_TEXTURE_2D, m_uvTextureId);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_RenderImage.width >> 1, m_RenderImage.height >> 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, m_RenderImage.ppPlane[1]);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glBindTexture(GL_TEXTURE_2D, GL_NONE);
+	if (m_RenderImage.ppPlane[0] == nullptr) LoadImage(nullptr);
+	// 上传路径可能变化，重新按新的纹理格式上传
+	m_bImageDirty = true;
 }
 
 void RenderP010Sample::Draw(int screenW, int screenH)
 {
-	LOGCATE("RenderP010Sample::Draw()");
+	LOGCATV("RenderP010Sample::Draw()");
 
-	if(m_ProgramObj == GL_NONE || m_yTextureId == GL_NONE) return;
+	if(m_ProgramObj == GL_NONE) return;
+
+	// upload Y plane (1 x 16bit, width x height) and UV plane (2 x 16bit, width/2 x height/2)
+	if (m_bImageDirty)
+	{
+		m_bImageDirty = false;
+		StreamingPlaneDesc planes[2];
+		Texture16Support::GetPlaneDesc(m_Texture16Path, 1, m_RenderImage.width, m_RenderImage.height, 0, planes[0]);
+		Texture16Support::GetPlaneDesc(m_Texture16Path, 2, m_RenderImage.width >> 1, m_RenderImage.height >> 1,
+									   (size_t) m_RenderImage.width * m_RenderImage.height * 2, planes[1]);
+		m_Uploader.Upload(&m_RenderImage, planes, 2);
+	}
+	if(m_Uploader.GetPlaneCount() != 2) return;
 
 	GLfloat verticesCoords[] = {
 			-1.0f,  1.0f, 0.0f,  // Position 0
@@ -141,14 +133,14 @@ void RenderP010Sample::Draw(int screenW, int screenH)
 
 	// Bind the Y plane map
 	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, m_yTextureId);
+	glBindTexture(GL_TEXTURE_2D, m_Uploader.GetTextureId(0));
 
 	// Set the Y plane sampler to texture unit to 0
 	glUniform1i(m_ySamplerLoc, 0);
 
 	// Bind the UV plane map
 	glActiveTexture(GL_TEXTURE1);
-	glBindTexture(GL_TEXTURE_2D, m_uvTextureId);
+	glBindTexture(GL_TEXTURE_2D, m_Uploader.GetTextureId(1));
 
 	// Set the UV plane sampler to texture unit to 1
 	glUniform1i(m_uvSamplerLoc, 1);
@@ -161,8 +153,8 @@ void RenderP010Sample::Destroy()
 	if (m_ProgramObj)
 	{
 		glDeleteProgram(m_ProgramObj);
-		glDeleteTextures(1, &m_yTextureId);
-		glDeleteTextures(1, &m_uvTextureId);
+		m_Uploader.Destroy();
 		m_ProgramObj = GL_NONE;
+		m_bImageDirty = true;
 	}
 }
@@ -12,17 +12,18 @@
 
 #include "GLSampleBase.h"
 #include "../util/ImageDef.h"
+#include "../util/StreamingTextureUploader.h"
+#include "../util/Texture16Support.h"
 
 class RenderP010Sample: public GLSampleBase
 {
 public:
 	RenderP010Sample()
 	{
-		m_yTextureId = GL_NONE;
-		m_uvTextureId = GL_NONE;
-
 		m_ySamplerLoc = GL_NONE;
 		m_uvSamplerLoc = GL_NONE;
+		m_bImageDirty = false;
+		m_Texture16Path = TEXTURE16_PATH_PACKED;
 	}
 
 	virtual ~RenderP010Sample()
@@ -39,13 +40,13 @@ public:
 	virtual void Destroy();
 
 private:
-	GLuint m_yTextureId;
-	GLuint m_uvTextureId;
-
 	GLint m_ySamplerLoc;
 	GLint m_uvSamplerLoc;
 
 	NativeImage m_RenderImage;
+	volatile bool m_bImageDirty;   // LoadImage 后置位，Draw 中上传
+	StreamingTextureUploader m_Uploader;
+	int m_Texture16Path;           // TEXTURE16_PATH_*，Init 时探测
 
 };
 
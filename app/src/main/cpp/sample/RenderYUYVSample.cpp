@@ -18,11 +18,14 @@ void RenderYUYVSample::LoadImage(NativeImage *pImage)
 		m_RenderImage.height = pImage->height;
 		m_RenderImage.format = pImage->format;
 		NativeImageUtil::CopyNativeImage(pImage, &m_RenderImage);
+		m_bImageDirty = true;
 	}
 }
 
 void RenderYUYVSample::Init()
 {
+	if (m_ProgramObj) return;
+
 	char vShaderStr[] =R"(
 			#version 300 es
 			layout(location = 0) in vec4 a_position;
@@ -50,13 +53,13 @@ void RenderYUYVSample::Init()
 				float y = col.r - 0.063;
 				float u,v;
 				if(mod(pixelUV.x, 2.0) > 0.01) {
-					v = col.a - 0.502;
+					v = col.g - 0.502;
 					pixelUV.x -= 1.0;
-					u = texelFetch(y_texture, ivec2(int(pixelUV.x), int(pixelUV.y)), 0).a - 0.502;
+					u = texelFetch(y_texture, ivec2(int(pixelUV.x), int(pixelUV.y)), 0).g - 0.502;
 				} else {
-					u = col.a - 0.502;
+					u = col.g - 0.502;
 					pixelUV.x += 1.0;
-					v = texelFetch(y_texture, ivec2(int(pixelUV.x), int(pixelUV.y)), 0).a - 0.502;
+					v = texelFetch(y_texture, ivec2(int(pixelUV.x), int(pixelUV.y)), 0).g - 0.502;
 				}
 				vec3 yuv = vec3(y,u,v);
 				vec3 rgb = mat3(1.164, 1.164, 1.164,
@@ -71,40 +74,26 @@ void RenderYUYVSample::Init()
 
 	// Get the sampler location
 	m_TextureLoc = glGetUniformLocation (m_ProgramObj, "y_texture" );
-
-	//create textures
-	GLuint textureIds[1] = {0};
-	glGenTextures(1, textureIds);
-
-	m_TextureId = textureIds[0];
-
-//	glActiveTexture(GL_TEXTURE0);
-//	glBindTexture(GL_TEXTURE_2D, m_TextureIds[0]);
-//	glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE_ALPHA, nWidth, nHeight, 0,
-//				 GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, ppPlane[0]);
-//
-//	glActiveTexture(GL_TEXTURE1);
-//	glBindTexture(GL_TEXTURE_2D, m_TextureIds[1]);
-//	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, nWidth >> 1, nHeight, 0, GL_RGBA,
-//				 GL_UNSIGNED_BYTE, ppPlane[0]);
-
-	//upload Y plane data
-	glBindTexture(GL_TEXTURE_2D, m_TextureId);
-	glTexImage2D ( GL_TEXTURE_2D, 0, GL_LUMINANCE_ALPHA, m_RenderImage.width, m_RenderImage.height, 0,
-				   GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, m_RenderImage.ppPlane[0]);
-
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glBindTexture(GL_TEXTURE_2D, GL_NONE);
 }
 
 void RenderYUYVSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("RenderYUYVSample::Draw()");
-	glPixelStorei(GL_UNPACK_ALIGNMENT,1);
-	if(m_ProgramObj == GL_NONE || m_TextureId == GL_NONE) return;
+	LOGCATV("RenderYUYVSample::Draw()");
+	if(m_ProgramObj == GL_NONE) return;
+
+	// upload YUYV data as GL_RG8 (width x height) when the image changed
+	if (m_bImageDirty)
+	{
+		m_bImageDirty = false;
+		StreamingPlaneDesc plane;
+		plane.internalFormat = GL_RG8;
+		plane.format = GL_RG;
+		plane.width = m_RenderImage.width;
+		plane.height = m_RenderImage.height;
+		m_Uploader.Upload(&m_RenderImage, &plane, 1);
+	}
+	GLuint textureId = m_Uploader.GetTextureId(0);
+	if(textureId == GL_NONE) return;
 
 	GLfloat verticesCoords[] = {
 			-1.0f,  1.0f, 0.0f,  // Position 0
@@ -137,7 +126,7 @@ void RenderYUYVSample::Draw(int screenW, int screenH)
 
 	// Bind the Y plane map
 	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, m_TextureId);
+	glBindTexture(GL_TEXTURE_2D, textureId);
 
 	// Set the Y plane sampler to texture unit to 0
 	glUniform1i(m_TextureLoc, 0);
@@ -152,7 +141,8 @@ void RenderYUYVSample::Destroy()
 	if (m_ProgramObj)
 	{
 		glDeleteProgram(m_ProgramObj);
-		glDeleteTextures(1, &m_TextureId);
+		m_Uploader.Destroy();
 		m_ProgramObj = GL_NONE;
+		m_bImageDirty = true;
 	}
 }
@@ -12,15 +12,15 @@
 
 #include "GLSampleBase.h"
 #include "../util/ImageDef.h"
+#include "../util/StreamingTextureUploader.h"
 
 class RenderYUYVSample: public GLSampleBase
 {
 public:
 	RenderYUYVSample()
 	{
-		m_TextureId = GL_NONE;
-
 		m_TextureLoc = GL_NONE;
+		m_bImageDirty = false;
 
 	}
 
@@ -38,11 +38,11 @@ public:
 	virtual void Destroy();
 
 private:
-	GLuint m_TextureId;
-
 	GLuint m_TextureLoc;
 
 	NativeImage m_RenderImage;
+	volatile bool m_bImageDirty;   // LoadImage 后置位，Draw 中上传
+	StreamingTextureUploader m_Uploader;
 
 };
 
@@ -144,7 +144,7 @@ void RotaryHeadSample::LoadImage(NativeImage *pImage)
 
 void RotaryHeadSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("RotaryHeadSample::Draw() [w,h]=[%d,%d]", screenW, screenH);
+	LOGCATV("RotaryHeadSample::Draw() [w,h]=[%d,%d]", screenW, screenH);
 
 	if(m_ProgramObj == GL_NONE) return;
 
@@ -213,7 +213,7 @@ void RotaryHeadSample::Destroy()
  * */
 void RotaryHeadSample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("RotaryHeadSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("RotaryHeadSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
 
@@ -265,7 +265,7 @@ void RotaryHeadSample::CalculateMesh(float rotaryAngle) {
 		//inputPoint = RotaryKeyPoint(inputPoint, rotaryAngle);
 		m_KeyPoints[i] = RotaryKeyPoint(inputPoint, rotaryAngle);;
 		m_KeyPointsInts[i] = CalculateIntersection(inputPoint, centerPoint);
-		LOGCATE("RotaryHeadSample::CalculateMesh index=%d, input[x,y]=[%f, %f], interscet[x, y]=[%f, %f]", i,
+		LOGCATV("RotaryHeadSample::CalculateMesh index=%d, input[x,y]=[%f, %f], interscet[x, y]=[%f, %f]", i,
 				m_KeyPoints[i].x, m_KeyPoints[i].y, m_KeyPointsInts[i].x, m_KeyPointsInts[i].y);
 	}
 
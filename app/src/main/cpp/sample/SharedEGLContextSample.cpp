@@ -8,6 +8,7 @@
 
 #include <GLUtils.h>
 #include <EGL/egl.h>
+#include <string.h>
 #include "SharedEGLContextSample.h"
 
 #define VERTEX_POS_INDX  0
@@ -20,6 +21,7 @@ SharedEGLContextSample::SharedEGLContextSample()
 	m_ImageTextureId = GL_NONE;
 	m_FboTextureId = GL_NONE;
 	m_FboProgramObj = GL_NONE;
+	memset(&m_GLEnv, 0, sizeof(m_GLEnv));
 }
 
 SharedEGLContextSample::~SharedEGLContextSample()
@@ -182,6 +184,7 @@ void SharedEGLContextSample::Init()
 	m_GLEnv.imgSize       = imgSize;
 	m_GLEnv.renderDone    = OnAsyncRenderDone;
 	m_GLEnv.callbackCtx   = this;
+	m_GLEnv.inFlightFrames = SHARED_CTX_IN_FLIGHT_FRAMES;
     LOGCATE("SharedEGLContextSample::Init sharedCtx=%p", m_GLEnv.sharedCtx);
 
     GLRenderLooper::GetInstance()->postMessage(MSG_SurfaceCreated, &m_GLEnv);
@@ -191,11 +194,21 @@ void SharedEGLContextSample::Init()
 
 void SharedEGLContextSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("SharedEGLContextSample::Draw");
+	LOGCATV("SharedEGLContextSample::Draw");
+	GLuint fboTextureId = GL_NONE;
+	int frameIndex = -1;
+	if (m_GLEnv.inFlightFrames > 1)
+	{
+		// 流水线模式：请求下一帧后立即取最近完成的帧，两个线程并行工作
+		GLRenderLooper::GetInstance()->postMessage(MSG_DrawFrame);
+		if (!GLRenderLooper::GetInstance()->AcquireFrame(fboTextureId, frameIndex)) return;
+	}
+	else
 	{
 		unique_lock<mutex> lock(m_Mutex);
 		GLRenderLooper::GetInstance()->postMessage(MSG_DrawFrame);
 		m_Cond.wait(lock);
+		fboTextureId = m_FboTextureId;
 	}
 
 	glViewport(0, 0, screenW, screenH);
@@ -203,7 +216,7 @@ void SharedEGLContextSample::Draw(int screenW, int screenH)
 	GO_CHECK_GL_ERROR();
 	glBindVertexArray(m_VaoId);
 	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, m_FboTextureId);
+	glBindTexture(GL_TEXTURE_2D, fboTextureId);
 	GLUtils::setInt(m_ProgramObj, "s_TextureMap", 0);
 	GO_CHECK_GL_ERROR();
 	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (const void *)0);
@@ -211,6 +224,11 @@ void SharedEGLContextSample::Draw(int screenW, int screenH)
 	glBindTexture(GL_TEXTURE_2D, GL_NONE);
 	glBindVertexArray(GL_NONE);
 
+	if (frameIndex >= 0)
+	{
+		GLRenderLooper::GetInstance()->ReleaseFrame(frameIndex);
+	}
+
 }
 
 void SharedEGLContextSample::OnAsyncRenderDone(void *callback, int fboTexId) {
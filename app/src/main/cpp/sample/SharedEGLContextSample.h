@@ -16,6 +16,9 @@
 
 using namespace std;
 
+// 同时在途的离屏帧数，<= 1 时退化为串行等待模式
+#define SHARED_CTX_IN_FLIGHT_FRAMES 3
+
 class SharedEGLContextSample : public GLSampleBase
 {
 public:
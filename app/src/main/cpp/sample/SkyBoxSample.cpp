@@ -44,8 +44,7 @@ m_CubeProgramObj(GL_NONE)  // 立方体着色器程序
 
 	m_ModelMatrix = glm::mat4(0.0f);  // 模型矩阵
 
-	// 初始化 6 张天空盒纹理图像数组
-	memset(m_pSkyBoxRenderImg, 0, sizeof(NativeImage) * 6);
+	// 6 张天空盒纹理图像由 NativeImage 的构造函数置零
 }
 
 /**
@@ -57,7 +56,7 @@ SkyBoxSample::~SkyBoxSample()
 	NativeImageUtil::FreeNativeImage(&m_RenderImage);
 
 	// 释放 6 张天空盒纹理图像
-	for(NativeImage nativeImage : m_pSkyBoxRenderImg)
+	for(NativeImage &nativeImage : m_pSkyBoxRenderImg)
 	{
 		NativeImageUtil::FreeNativeImage(&nativeImage);
 	}
@@ -341,7 +340,7 @@ void SkyBoxSample::LoadMultiImageWithIndex(int index, NativeImage *pImage)
  */
 void SkyBoxSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("SkyBoxSample::Draw()");
+	LOGCATV("SkyBoxSample::Draw()");
 
 	if (m_ProgramObj == GL_NONE) return;
 	glEnable(GL_DEPTH_TEST);  // 启用深度测试
@@ -432,7 +431,7 @@ void SkyBoxSample::Destroy()
  * */
 void SkyBoxSample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float scale, float ratio)
 {
-	LOGCATE("SkyBoxSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX,
+	LOGCATV("SkyBoxSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX,
 			angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
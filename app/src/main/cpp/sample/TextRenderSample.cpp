@@ -175,7 +175,7 @@ void TextRenderSample::Draw(int screenW, int screenH)
 {
 	m_SurfaceWidth = screenW;
 	m_SurfaceHeight = screenH;
-	LOGCATE("TextRenderSample::Draw()");
+	LOGCATV("TextRenderSample::Draw()");
 	if(m_ProgramObj == GL_NONE) return;
 
 	// 设置清屏颜色为白色
@@ -258,7 +258,7 @@ void TextRenderSample::RenderText(std::string text, GLfloat x, GLfloat y, GLfloa
 		w /= viewport.x;
 		h /= viewport.y;
 
-		LOGCATE("TextRenderSample::RenderText [xpos,ypos,w,h]=[%f, %f, %f, %f], ch.advance >> 6 = %d", xpos, ypos, w, h, ch.advance >> 6);
+		LOGCATV("TextRenderSample::RenderText [xpos,ypos,w,h]=[%f, %f, %f, %f], ch.advance >> 6 = %d", xpos, ypos, w, h, ch.advance >> 6);
 
 		// 构建当前字符的顶点数据（2个三角形组成矩形）
 		// 每个顶点包含：位置坐标(x,y) + 纹理坐标(s,t)
@@ -488,7 +488,7 @@ void TextRenderSample::Destroy()
  * */
 void TextRenderSample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("TextRenderSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("TextRenderSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
 
@@ -565,7 +565,7 @@ void TextRenderSample::RenderText(const wchar_t *text, int textLen, GLfloat x, G
 		w /= viewport.x;
 		h /= viewport.y;
 
-		LOGCATE("TextRenderSample::RenderText [xpos,ypos,w,h]=[%f, %f, %f, %f]", xpos, ypos, w, h);
+		LOGCATV("TextRenderSample::RenderText [xpos,ypos,w,h]=[%f, %f, %f, %f]", xpos, ypos, w, h);
 
 		// 构建当前字符的顶点数据
 		GLfloat vertices[6][4] = {
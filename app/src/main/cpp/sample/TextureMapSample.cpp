@@ -31,6 +31,9 @@
 TextureMapSample::TextureMapSample()
 {
 	m_TextureId = 0;  // 初始化纹理 ID 为 0
+	m_SamplerLoc = 0;
+	m_BuildHandle = INVALID_PROGRAM_BUILD_HANDLE;
+	m_BuildFailed = false;
 
 }
 
@@ -49,8 +52,12 @@ TextureMapSample::~TextureMapSample()
  */
 void TextureMapSample::Init()
 {
+	// 避免重复初始化（Init 每帧都会被调用，program 异步构建期间或构建失败后同样跳过）
+	if(m_ProgramObj != GL_NONE || m_BuildHandle != INVALID_PROGRAM_BUILD_HANDLE || m_BuildFailed)
+		return;
+
 	// ==================== 创建并配置纹理 ====================
-	glGenTextures(1, &m_TextureId);              // 生成一个纹理对象
+	if (m_TextureId == GL_NONE) glGenTextures(1, &m_TextureId);  // 生成一个纹理对象，只创建一次
 	glBindTexture(GL_TEXTURE_2D, m_TextureId);   // 绑定为 2D 纹理
 
 	// 设置纹理环绕方式（超出 [0,1] 范围时的处理）
@@ -87,17 +94,8 @@ void TextureMapSample::Init()
 			"  outColor = texture(s_TextureMap, v_texCoord);     \n"  // 使用纹理坐标采样纹理
 			"}                                                   \n";
 
-	// 创建着色器程序
-	m_ProgramObj = GLUtils::CreateProgram(vShaderStr, fShaderStr, m_VertexShader, m_FragmentShader);
-	if (m_ProgramObj)
-	{
-		// 获取采样器 uniform 变量的位置
-		m_SamplerLoc = glGetUniformLocation(m_ProgramObj, "s_TextureMap");
-	}
-	else
-	{
-		LOGCATE("TextureMapSample::Init create program fail");
-	}
+	// 异步创建着色器程序，构建完成前 Draw() 只绘制占位背景，不阻塞渲染线程
+	m_BuildHandle = AsyncProgramBuilder::GetInstance()->CreateProgramAsync(vShaderStr, fShaderStr);
 
 }
 
@@ -108,15 +106,34 @@ void TextureMapSample::Init()
  */
 void TextureMapSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("TextureMapSample::Draw()");
-
-	// 确保程序和纹理已创建
-	if(m_ProgramObj == GL_NONE || m_TextureId == GL_NONE) return;
+	LOGCATV("TextureMapSample::Draw()");
 
 	// ==================== 清空缓冲区 ====================
 	glClearColor(1.0, 1.0, 1.0, 1.0);  // 设置清空颜色为白色
 	glClear(GL_STENCIL_BUFFER_BIT | GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+	// ==================== 查询异步构建结果 ====================
+	if (m_BuildHandle != INVALID_PROGRAM_BUILD_HANDLE)
+	{
+		ProgramBuildState state = AsyncProgramBuilder::GetInstance()->Poll(m_BuildHandle, m_ProgramObj);
+		if (state == PROGRAM_BUILD_PENDING) return;  // 仍在编译，本帧只显示占位背景
+
+		m_BuildHandle = INVALID_PROGRAM_BUILD_HANDLE;
+		if (m_ProgramObj)
+		{
+			// 获取采样器 uniform 变量的位置
+			m_SamplerLoc = glGetUniformLocation(m_ProgramObj, "s_TextureMap");
+		}
+		else
+		{
+			m_BuildFailed = true;
+			LOGCATE("TextureMapSample::Draw create program fail");
+		}
+	}
+
+	// 确保程序和纹理已创建
+	if(m_ProgramObj == GL_NONE || m_TextureId == GL_NONE) return;
+
 	// ==================== 顶点坐标（定义一个矩形）====================
 	GLfloat verticesCoords[] = {
 			-1.0f,  0.5f, 0.0f,  // 顶点 0：左上
@@ -220,11 +237,23 @@ void TextureMapSample::LoadImage(NativeImage *pImage)
  */
 void TextureMapSample::Destroy()
 {
+	if (m_BuildHandle != INVALID_PROGRAM_BUILD_HANDLE)
+	{
+		AsyncProgramBuilder::GetInstance()->Cancel(m_BuildHandle);
+		m_BuildHandle = INVALID_PROGRAM_BUILD_HANDLE;
+	}
+
 	if (m_ProgramObj)
 	{
 		glDeleteProgram(m_ProgramObj);          // 删除着色器程序
-		glDeleteTextures(1, &m_TextureId);      // 删除纹理对象
 		m_ProgramObj = GL_NONE;
 	}
 
+	// 构建失败时 program 为空，纹理仍需单独释放
+	if (m_TextureId)
+	{
+		glDeleteTextures(1, &m_TextureId);      // 删除纹理对象
+		m_TextureId = GL_NONE;
+	}
+
 }
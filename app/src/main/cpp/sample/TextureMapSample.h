@@ -25,6 +25,7 @@
 
 #include "GLSampleBase.h"
 #include "../util/ImageDef.h"
+#include "../util/AsyncProgramBuilder.h"
 
 /**
  * @class TextureMapSample
@@ -80,6 +81,8 @@ private:
 	GLuint m_TextureId;          // 纹理对象 ID
 	GLint m_SamplerLoc;          // 采样器 uniform 变量在着色器中的位置
 	NativeImage m_RenderImage;   // 存储图像数据的结构
+	ProgramBuildHandle m_BuildHandle; // 异步构建 program 的句柄，构建完成前绘制占位背景
+	bool m_BuildFailed;          // 异步构建失败后不再重试，避免每帧重新提交编译
 };
 
 
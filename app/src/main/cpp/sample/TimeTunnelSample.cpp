@@ -475,7 +475,7 @@ bool TimeTunnelSample::CreateFrameBufferObj()
  */
 void TimeTunnelSample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-    LOGCATE("TimeTunnelSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+    LOGCATV("TimeTunnelSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
     // 将角度限制在 0-360 度范围内
     angleX = angleX % 360;
     angleY = angleY % 360;
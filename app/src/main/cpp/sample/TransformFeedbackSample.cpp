@@ -181,7 +181,7 @@ void TransformFeedbackSample::Draw(int screenW, int screenH)
 	float *p = (float*)rawData;
 	for(int i= 0; i< 6; i++)
 	{
-		LOGCATE("TransformFeedbackSample::Draw() read feedback buffer outPos[%d] = [%f, %f, %f], outTex[%d] = [%f, %f]", i, p[i * 5], p[i * 5 + 1], p[i * 5 + 2], i, p[i * 5 + 3], p[i * 5 + 4]);
+		LOGCATV("TransformFeedbackSample::Draw() read feedback buffer outPos[%d] = [%f, %f, %f], outTex[%d] = [%f, %f]", i, p[i * 5], p[i * 5 + 1], p[i * 5 + 2], i, p[i * 5 + 3], p[i * 5 + 4]);
 	}
 
 	glUnmapBuffer(GL_TRANSFORM_FEEDBACK_BUFFER);
@@ -161,7 +161,7 @@ void UniformBufferSample::LoadImage(NativeImage *pImage)
 
 void UniformBufferSample::Draw(int screenW, int screenH)
 {
-	LOGCATE("UniformBufferSample::Draw()");
+	LOGCATV("UniformBufferSample::Draw()");
 
 	if(m_ProgramObj == GL_NONE || m_TextureId == GL_NONE) return;
 
@@ -206,7 +206,7 @@ void UniformBufferSample::Destroy()
  * */
 void UniformBufferSample::UpdateMVPMatrix(glm::mat4 &mvpMatrix, int angleX, int angleY, float ratio)
 {
-	LOGCATE("UniformBufferSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
+	LOGCATV("UniformBufferSample::UpdateMVPMatrix angleX = %d, angleY = %d, ratio = %f", angleX, angleY, ratio);
 	angleX = angleX % 360;
 	angleY = angleY % 360;
 
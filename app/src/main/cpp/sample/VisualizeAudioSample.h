@@ -15,6 +15,7 @@
 #include <detail/type_mat.hpp>
 #include <detail/type_mat4x4.hpp>
 #include <mutex>
+#include <condition_variable>
 #include "GLSampleBase.h"
 
 using namespace glm;
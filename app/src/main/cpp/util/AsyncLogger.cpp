@@ -0,0 +1,239 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "AsyncLogger.h"
+#include <stdio.h>
+#include <chrono>
+#include "LogUtil.h"
+
+static std::atomic<int> s_Level(ANDROID_LOG_VERBOSE);
+static std::atomic<bool> s_Async(true);
+
+std::atomic<AsyncLogger *> AsyncLogger::s_Instance(nullptr);
+std::mutex AsyncLogger::s_InstanceMutex;
+
+// DestroyInstance 开始后置位，Print 不再使用或创建实例
+static std::atomic<bool> s_ShuttingDown(false);
+// 正在使用实例的线程数，DestroyInstance 等它归零后才释放
+static std::atomic<int> s_Writers(0);
+
+void ByteFlowLogPrint(int prio, const char *tag, const char *fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	AsyncLogger::Print(prio, tag, fmt, args);
+	va_end(args);
+}
+
+AsyncLogger *AsyncLogger::GetInstance()
+{
+	std::unique_lock<std::mutex> lock(s_InstanceMutex);
+	AsyncLogger *pInstance = s_Instance.load();
+	if (pInstance == nullptr)
+	{
+		pInstance = new AsyncLogger();
+		s_Instance.store(pInstance);
+	}
+	s_ShuttingDown.store(false);
+	return pInstance;
+}
+
+void AsyncLogger::DestroyInstance()
+{
+	AsyncLogger *pInstance;
+	{
+		std::unique_lock<std::mutex> lock(s_InstanceMutex);
+		s_ShuttingDown.store(true);
+		pInstance = s_Instance.exchange(nullptr);
+	}
+	if (pInstance == nullptr) return;
+
+	// 写入者先登记再检查 s_ShuttingDown，两者都是顺序一致的原子操作，
+	// 这里看到计数归零后不会再有线程拿到 pInstance
+	while (s_Writers.load() != 0)
+	{
+		std::this_thread::yield();
+	}
+	delete pInstance;
+}
+
+AsyncLogger *AsyncLogger::AcquireInstance(bool create)
+{
+	// 先检查再登记：shutdown 开始后新来的线程不再计数，DestroyInstance 的等待不会被持续写日志的线程拖住
+	if (s_ShuttingDown.load()) return nullptr;
+	s_Writers.fetch_add(1);
+	AsyncLogger *pInstance = s_ShuttingDown.load() ? nullptr : s_Instance.load();
+	if (pInstance == nullptr && create && !s_ShuttingDown.load())
+	{
+		std::unique_lock<std::mutex> lock(s_InstanceMutex);
+		pInstance = s_Instance.load();
+		if (pInstance == nullptr && !s_ShuttingDown.load())
+		{
+			pInstance = new AsyncLogger();
+			s_Instance.store(pInstance);
+		}
+	}
+	if (pInstance == nullptr) s_Writers.fetch_sub(1);
+	return pInstance;
+}
+
+void AsyncLogger::ReleaseInstance()
+{
+	s_Writers.fetch_sub(1);
+}
+
+void AsyncLogger::SetLevel(int prio)
+{
+	s_Level = prio;
+}
+
+int AsyncLogger::GetLevel()
+{
+	return s_Level;
+}
+
+void AsyncLogger::SetAsync(bool async)
+{
+	if (!async)
+	{
+		AsyncLogger *pInstance = AcquireInstance(false);
+		if (pInstance)
+		{
+			pInstance->Flush();
+			ReleaseInstance();
+		}
+	}
+	s_Async = async;
+}
+
+bool AsyncLogger::IsAsync()
+{
+	return s_Async;
+}
+
+void AsyncLogger::Print(int prio, const char *tag, const char *fmt, va_list args)
+{
+	if (prio < s_Level) return;
+	bool sync = !s_Async || prio >= ANDROID_LOG_FATAL;
+	AsyncLogger *pInstance = AcquireInstance(!sync);
+	if (sync || pInstance == nullptr)
+	{
+		// FATAL 之后进程通常会退出，先输出缓冲中更早的日志保证顺序；shutdown 开始后同样直接输出
+		if (prio >= ANDROID_LOG_FATAL && pInstance) pInstance->Flush();
+		__android_log_vprint(prio, tag, fmt, args);
+	}
+	else
+	{
+		pInstance->Push(prio, tag, fmt, args);
+	}
+	if (pInstance) ReleaseInstance();
+}
+
+AsyncLogger::AsyncLogger()
+{
+	for (uint32_t i = 0; i < ASYNC_LOG_CAPACITY; ++i)
+	{
+		m_Entries[i].sequence = i;
+	}
+	m_Tail = 0;
+	m_Head = 0;
+	m_DroppedCount = 0;
+	m_ReportedDropped = 0;
+	m_Quit = false;
+	m_Worker = std::thread(&AsyncLogger::WorkerLoop, this);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_Quit = true;
+	}
+	m_Cond.notify_all();
+	m_Worker.join();
+}
+
+bool AsyncLogger::Push(int prio, const char *tag, const char *fmt, va_list args)
+{
+	// 有界 MPMC 队列：条目的 sequence 等于写入位置时可写，等于写入位置 + 1 时可读
+	uint32_t pos = m_Tail.load(std::memory_order_relaxed);
+	AsyncLogEntry *pEntry = nullptr;
+	while (true)
+	{
+		pEntry = &m_Entries[pos & (ASYNC_LOG_CAPACITY - 1)];
+		uint32_t sequence = pEntry->sequence.load(std::memory_order_acquire);
+		int32_t diff = (int32_t) (sequence - pos);
+		if (diff == 0)
+		{
+			if (m_Tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+		}
+		else if (diff < 0)
+		{
+			m_DroppedCount++;
+			return false;
+		}
+		else
+		{
+			pos = m_Tail.load(std::memory_order_relaxed);
+		}
+	}
+
+	pEntry->prio = prio;
+	pEntry->tag = tag;
+	vsnprintf(pEntry->message, ASYNC_LOG_MESSAGE_SIZE, fmt, args);
+	pEntry->sequence.store(pos + 1, std::memory_order_release);
+
+	// 缓冲过半才唤醒后台线程，其余情况由它按间隔自行取走
+	if (pos - m_Head.load(std::memory_order_relaxed) >= ASYNC_LOG_CAPACITY / 2) m_Cond.notify_one();
+	return true;
+}
+
+int AsyncLogger::Drain()
+{
+	int count = 0;
+	uint32_t pos = m_Head.load(std::memory_order_relaxed);
+	while (true)
+	{
+		AsyncLogEntry &entry = m_Entries[pos & (ASYNC_LOG_CAPACITY - 1)];
+		if (entry.sequence.load(std::memory_order_acquire) != pos + 1) break;
+		__android_log_write(entry.prio, entry.tag, entry.message);
+		entry.sequence.store(pos + ASYNC_LOG_CAPACITY, std::memory_order_release);
+		m_Head.store(++pos, std::memory_order_release);
+		count++;
+	}
+
+	uint64_t dropped = m_DroppedCount;
+	if (dropped != m_ReportedDropped)
+	{
+		__android_log_print(ANDROID_LOG_WARN, LOG_TAG, "AsyncLogger dropped %llu log(s), buffer full",
+							(unsigned long long) (dropped - m_ReportedDropped));
+		m_ReportedDropped = dropped;
+	}
+	return count;
+}
+
+void AsyncLogger::WorkerLoop()
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	while (true)
+	{
+		bool quit = m_Quit;
+		lock.unlock();
+		Drain();
+		lock.lock();
+		m_FlushCond.notify_all();
+		if (quit) return;
+		m_Cond.wait_for(lock, std::chrono::milliseconds(ASYNC_LOG_DRAIN_INTERVAL_MS));
+	}
+}
+
+void AsyncLogger::Flush()
+{
+	uint32_t target = m_Tail.load(std::memory_order_acquire);
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	m_Cond.notify_one();
+	m_FlushCond.wait(lock, [&] {
+		return (int32_t) (m_Head.load(std::memory_order_acquire) - target) >= 0;
+	});
+}
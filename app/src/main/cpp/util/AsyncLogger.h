@@ -0,0 +1,98 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_ASYNCLOGGER_H
+#define NDK_OPENGLES_3_0_ASYNCLOGGER_H
+
+#include <stdarg.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "stdint.h"
+
+// 环形缓冲的条目数，需为 2 的幂；写满时丢弃新日志而不阻塞调用线程
+#define ASYNC_LOG_CAPACITY 1024
+
+// 单条日志的最大长度（含结尾 0），超出部分截断
+#define ASYNC_LOG_MESSAGE_SIZE 256
+
+// 后台线程的最长等待间隔，缓冲区未过半时调用线程不唤醒它，避免每条日志一次系统调用
+#define ASYNC_LOG_DRAIN_INTERVAL_MS 20
+
+struct AsyncLogEntry
+{
+	std::atomic<uint32_t> sequence;
+	int prio;
+	const char *tag;
+	char message[ASYNC_LOG_MESSAGE_SIZE];
+};
+
+/**
+ * 异步日志：调用线程只把格式化后的日志写进无锁环形缓冲（多生产者、单消费者），
+ * 由后台线程批量调用 __android_log_write，渲染线程上不再有逐条的系统调用。
+ * FATAL 级别和同步模式下直接输出；进程退出前调用 DestroyInstance 输出缓冲中剩余的日志。
+ * DestroyInstance 之后其他线程的日志改为同步输出，不会写入已释放的实例，也不会重新创建；
+ * 显式调用 GetInstance 会重新开启异步输出。
+ * 通过 LogUtil.h 的 LOGCAT* 宏使用，一般不直接调用。
+ */
+class AsyncLogger
+{
+public:
+	// 创建实例并在 DestroyInstance 之后重新开启异步输出
+	static AsyncLogger *GetInstance();
+
+	// 等待正在写入的线程离开后释放实例，释放前输出缓冲中剩余的日志，可重复调用
+	static void DestroyInstance();
+
+	static void Print(int prio, const char *tag, const char *fmt, va_list args);
+
+	// 运行期级别，低于该级别的日志在格式化前丢弃；编译期级别见 BYTEFLOW_LOG_LEVEL
+	static void SetLevel(int prio);
+
+	static int GetLevel();
+
+	// false 时每条日志在调用线程同步输出，与改造前的 LOGCATE 行为一致
+	static void SetAsync(bool async);
+
+	static bool IsAsync();
+
+	// 阻塞直到此前写入的日志都已输出
+	void Flush();
+
+	uint64_t GetDroppedCount() const { return m_DroppedCount; }
+
+private:
+	AsyncLogger();
+
+	~AsyncLogger();
+
+	bool Push(int prio, const char *tag, const char *fmt, va_list args);
+
+	int Drain();
+
+	void WorkerLoop();
+
+	// 登记为写入者并返回实例，返回非空时须调用 ReleaseInstance；shutdown 后或 create 为 false 且实例不存在时返回 nullptr
+	static AsyncLogger *AcquireInstance(bool create);
+
+	static void ReleaseInstance();
+
+	static std::atomic<AsyncLogger *> s_Instance;
+	static std::mutex s_InstanceMutex;
+
+	AsyncLogEntry m_Entries[ASYNC_LOG_CAPACITY];
+	std::atomic<uint32_t> m_Tail;     // 下一个写入位置，生产者竞争
+	std::atomic<uint32_t> m_Head;     // 下一个读取位置，只由后台线程推进
+	std::atomic<uint64_t> m_DroppedCount;
+	uint64_t m_ReportedDropped;
+
+	std::mutex m_Mutex;
+	std::condition_variable m_Cond;
+	std::condition_variable m_FlushCond;
+	bool m_Quit;
+	std::thread m_Worker;
+};
+
+#endif //NDK_OPENGLES_3_0_ASYNCLOGGER_H
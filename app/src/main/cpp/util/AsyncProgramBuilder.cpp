@@ -0,0 +1,461 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "AsyncProgramBuilder.h"
+#include <atomic>
+#include <condition_variable>
+#include <string.h>
+#include <GLES2/gl2ext.h>
+#include <Looper.h>
+#include <EglCore.h>
+#include <OffscreenSurface.h>
+#include "GLUtils.h"
+#include "LogUtil.h"
+#include "ProgramBinaryCache.h"
+#include "UniformLocationCache.h"
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+typedef void (GL_APIENTRYP PFN_GL_MAX_SHADER_COMPILER_THREADS_KHR)(GLuint count);
+
+enum
+{
+	WORKER_PENDING,
+	WORKER_DONE,
+	WORKER_UNAVAILABLE,
+};
+
+struct ProgramBuildTask
+{
+	std::string vertexSource;
+	std::string fragSource;
+	uint64_t cacheKey = 0;
+	bool parallel = false;
+	ProgramBuildState state = PROGRAM_BUILD_PENDING;
+	GLuint program = GL_NONE;
+	GLuint vertexShader = GL_NONE;
+	GLuint fragShader = GL_NONE;
+
+	// 以下字段由工作线程写入
+	std::mutex mutex;
+	std::condition_variable cond;
+	int workerState = WORKER_PENDING;
+	bool cancelled = false;
+	GLsync sync = nullptr;
+};
+
+enum
+{
+	MSG_InitContext,
+	MSG_CompileProgram,
+	MSG_ReleaseContext,
+};
+
+/**
+ * 持有共享 EGLContext 的编译线程，program 对象在共享组内可见
+ */
+class ShaderCompileLooper : public Looper
+{
+public:
+	ShaderCompileLooper(EGLContext sharedCtx)
+	{
+		postMessage(MSG_InitContext, sharedCtx);
+	}
+
+	virtual ~ShaderCompileLooper()
+	{
+		postMessage(MSG_ReleaseContext);
+		quit();
+	}
+
+	void Submit(std::shared_ptr<ProgramBuildTask> &task)
+	{
+		postMessage(MSG_CompileProgram, new std::shared_ptr<ProgramBuildTask>(task));
+	}
+
+private:
+	virtual void handleMessage(LooperMessage *msg)
+	{
+		switch (msg->what)
+		{
+			case MSG_InitContext:
+				OnInitContext((EGLContext) msg->obj);
+				break;
+			case MSG_CompileProgram:
+			{
+				std::shared_ptr<ProgramBuildTask> *pTask = (std::shared_ptr<ProgramBuildTask> *) msg->obj;
+				OnCompileProgram(*pTask);
+				delete pTask;
+			}
+				break;
+			case MSG_ReleaseContext:
+				OnReleaseContext();
+				break;
+			default:
+				break;
+		}
+	}
+
+	void OnInitContext(EGLContext sharedCtx)
+	{
+		m_EglCore = new EglCore(sharedCtx, FLAG_TRY_GLES3);
+		if (m_EglCore->getEGLContext() == EGL_NO_CONTEXT)
+		{
+			LOGCATE("ShaderCompileLooper::OnInitContext create shared context fail");
+			return;
+		}
+		m_OffscreenSurface = new OffscreenSurface(m_EglCore, 1, 1);
+		m_OffscreenSurface->makeCurrent();
+		m_Ready = true;
+	}
+
+	void OnCompileProgram(std::shared_ptr<ProgramBuildTask> &task)
+	{
+		GLuint program = GL_NONE;
+		GLsync sync = nullptr;
+		int workerState = WORKER_UNAVAILABLE;
+		if (m_Ready)
+		{
+			program = GLUtils::CreateProgram(task->vertexSource.c_str(), task->fragSource.c_str());
+			// 渲染线程 glWaitSync 后才能保证看到完整的 program 状态
+			sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			glFlush();
+			workerState = WORKER_DONE;
+		}
+
+		std::unique_lock<std::mutex> lock(task->mutex);
+		if (task->cancelled)
+		{
+			if (sync) glDeleteSync(sync);
+			if (program) glDeleteProgram(program);
+			return;
+		}
+		task->program = program;
+		task->sync = sync;
+		task->workerState = workerState;
+		task->cond.notify_all();
+	}
+
+	void OnReleaseContext()
+	{
+		if (m_EglCore) UniformLocationCache::InvalidateContext(m_EglCore->getEGLContext());
+		if (m_OffscreenSurface)
+		{
+			m_OffscreenSurface->release();
+			delete m_OffscreenSurface;
+			m_OffscreenSurface = nullptr;
+		}
+
+		if (m_EglCore)
+		{
+			m_EglCore->release();
+			delete m_EglCore;
+			m_EglCore = nullptr;
+		}
+		m_Ready = false;
+	}
+
+	EglCore *m_EglCore = nullptr;
+	OffscreenSurface *m_OffscreenSurface = nullptr;
+	bool m_Ready = false;
+};
+
+AsyncProgramBuilder *AsyncProgramBuilder::s_Instance = nullptr;
+std::mutex AsyncProgramBuilder::s_InstanceMutex;
+
+AsyncProgramBuilder *AsyncProgramBuilder::GetInstance()
+{
+	if (s_Instance == nullptr)
+	{
+		std::unique_lock<std::mutex> lock(s_InstanceMutex);
+		if (s_Instance == nullptr)
+		{
+			s_Instance = new AsyncProgramBuilder();
+		}
+	}
+	return s_Instance;
+}
+
+void AsyncProgramBuilder::DestroyInstance()
+{
+	std::unique_lock<std::mutex> lock(s_InstanceMutex);
+	if (s_Instance)
+	{
+		delete s_Instance;
+		s_Instance = nullptr;
+	}
+}
+
+AsyncProgramBuilder::AsyncProgramBuilder()
+{
+	m_NextHandle = INVALID_PROGRAM_BUILD_HANDLE + 1;
+	m_Probed = false;
+	m_ParallelCompile = false;
+	m_Worker = nullptr;
+	m_WorkerSharedCtx = EGL_NO_CONTEXT;
+}
+
+AsyncProgramBuilder::~AsyncProgramBuilder()
+{
+	// 未取走的 program 交由 GL 上下文销毁时一并回收，这里只通知工作线程放弃
+	for (auto &pair : m_Tasks)
+	{
+		std::unique_lock<std::mutex> lock(pair.second->mutex);
+		pair.second->cancelled = true;
+	}
+	m_Tasks.clear();
+
+	if (m_Worker)
+	{
+		delete m_Worker;
+		m_Worker = nullptr;
+	}
+}
+
+void AsyncProgramBuilder::ProbeCapabilities()
+{
+	if (m_Probed) return;
+	m_Probed = true;
+
+	const char *pExtensions = (const char *) glGetString(GL_EXTENSIONS);
+	if (pExtensions != nullptr && strstr(pExtensions, "GL_KHR_parallel_shader_compile") != nullptr)
+	{
+		PFN_GL_MAX_SHADER_COMPILER_THREADS_KHR glMaxShaderCompilerThreadsKHR =
+				(PFN_GL_MAX_SHADER_COMPILER_THREADS_KHR) eglGetProcAddress("glMaxShaderCompilerThreadsKHR");
+		if (glMaxShaderCompilerThreadsKHR)
+		{
+			// 0xFFFFFFFF 表示由驱动决定线程数
+			glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+		}
+		m_ParallelCompile = true;
+	}
+	LOGCATE("AsyncProgramBuilder::ProbeCapabilities parallel_shader_compile=%d", m_ParallelCompile);
+}
+
+bool AsyncProgramBuilder::IsParallelCompileSupported()
+{
+	ProbeCapabilities();
+	return m_ParallelCompile;
+}
+
+ProgramBuildHandle AsyncProgramBuilder::CreateProgramAsync(const char *pVertexShaderSource, const char *pFragShaderSource)
+{
+	ProbeCapabilities();
+
+	std::shared_ptr<ProgramBuildTask> task = std::make_shared<ProgramBuildTask>();
+	task->vertexSource = pVertexShaderSource;
+	task->fragSource = pFragShaderSource;
+
+	const char *sources[] = {pVertexShaderSource, pFragShaderSource};
+	task->cacheKey = ProgramBinaryCache::MakeKey(sources, 2);
+	task->program = ProgramBinaryCache::Load(task->cacheKey);
+	if (task->program)
+	{
+		task->state = PROGRAM_BUILD_READY;
+	}
+	else if (m_ParallelCompile)
+	{
+		SubmitParallel(task);
+	}
+	else if (!SubmitToWorker(task))
+	{
+		task->program = GLUtils::CreateProgram(pVertexShaderSource, pFragShaderSource);
+		task->state = task->program ? PROGRAM_BUILD_READY : PROGRAM_BUILD_FAILED;
+	}
+
+	ProgramBuildHandle handle = m_NextHandle++;
+	if (m_NextHandle == INVALID_PROGRAM_BUILD_HANDLE) m_NextHandle++;
+	m_Tasks[handle] = task;
+	LOGCATE("AsyncProgramBuilder::CreateProgramAsync handle=%d, state=%d, parallel=%d", handle, task->state, task->parallel);
+	return handle;
+}
+
+void AsyncProgramBuilder::SubmitParallel(std::shared_ptr<ProgramBuildTask> &task)
+{
+	// 只提交编译链接，不查询状态，驱动在后台线程完成
+	const char *pVertexSource = task->vertexSource.c_str();
+	const char *pFragSource = task->fragSource.c_str();
+	task->parallel = true;
+	task->vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	glShaderSource(task->vertexShader, 1, &pVertexSource, NULL);
+	glCompileShader(task->vertexShader);
+	task->fragShader = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(task->fragShader, 1, &pFragSource, NULL);
+	glCompileShader(task->fragShader);
+
+	task->program = glCreateProgram();
+	ProgramBinaryCache::PrepareForLink(task->program);
+	glAttachShader(task->program, task->vertexShader);
+	glAttachShader(task->program, task->fragShader);
+	glLinkProgram(task->program);
+}
+
+bool AsyncProgramBuilder::SubmitToWorker(std::shared_ptr<ProgramBuildTask> &task)
+{
+	EGLContext currentCtx = eglGetCurrentContext();
+	if (currentCtx == EGL_NO_CONTEXT) return false;
+
+	if (m_Worker != nullptr && m_WorkerSharedCtx != currentCtx)
+	{
+		// 渲染上下文已重建，旧的共享组不再可用
+		delete m_Worker;
+		m_Worker = nullptr;
+	}
+
+	if (m_Worker == nullptr)
+	{
+		m_Worker = new ShaderCompileLooper(currentCtx);
+		m_WorkerSharedCtx = currentCtx;
+	}
+	m_Worker->Submit(task);
+	return true;
+}
+
+ProgramBuildState AsyncProgramBuilder::CheckTask(std::shared_ptr<ProgramBuildTask> &task, bool wait)
+{
+	if (task->state != PROGRAM_BUILD_PENDING) return task->state;
+
+	if (task->parallel)
+	{
+		if (!wait)
+		{
+			GLint completed = GL_FALSE;
+			glGetProgramiv(task->program, GL_COMPLETION_STATUS_KHR, &completed);
+			if (completed != GL_TRUE) return PROGRAM_BUILD_PENDING;
+		}
+
+		GLint linkStatus = GL_FALSE;
+		glGetProgramiv(task->program, GL_LINK_STATUS, &linkStatus);
+		if (linkStatus != GL_TRUE)
+		{
+			GLchar infoLog[512];
+			GLint compiled = GL_FALSE;
+			glGetShaderiv(task->vertexShader, GL_COMPILE_STATUS, &compiled);
+			if (!compiled)
+			{
+				glGetShaderInfoLog(task->vertexShader, sizeof(infoLog), NULL, infoLog);
+				LOGCATE("AsyncProgramBuilder::CheckTask Could not compile vertex shader:\n%s\n", infoLog);
+			}
+			glGetShaderiv(task->fragShader, GL_COMPILE_STATUS, &compiled);
+			if (!compiled)
+			{
+				glGetShaderInfoLog(task->fragShader, sizeof(infoLog), NULL, infoLog);
+				LOGCATE("AsyncProgramBuilder::CheckTask Could not compile fragment shader:\n%s\n", infoLog);
+			}
+			glGetProgramInfoLog(task->program, sizeof(infoLog), NULL, infoLog);
+			LOGCATE("AsyncProgramBuilder::CheckTask Could not link program:\n%s\n", infoLog);
+		}
+
+		glDetachShader(task->program, task->vertexShader);
+		glDeleteShader(task->vertexShader);
+		task->vertexShader = GL_NONE;
+		glDetachShader(task->program, task->fragShader);
+		glDeleteShader(task->fragShader);
+		task->fragShader = GL_NONE;
+
+		if (linkStatus == GL_TRUE)
+		{
+			ProgramBinaryCache::Store(task->cacheKey, task->program);
+			UniformLocationCache::Build(task->program);
+			task->state = PROGRAM_BUILD_READY;
+		}
+		else
+		{
+			glDeleteProgram(task->program);
+			task->program = GL_NONE;
+			task->state = PROGRAM_BUILD_FAILED;
+		}
+		return task->state;
+	}
+
+	int workerState;
+	GLsync sync;
+	{
+		std::unique_lock<std::mutex> lock(task->mutex);
+		if (wait)
+		{
+			task->cond.wait(lock, [&task] { return task->workerState != WORKER_PENDING; });
+		}
+		workerState = task->workerState;
+		sync = task->sync;
+		task->sync = nullptr;
+	}
+
+	if (workerState == WORKER_PENDING) return PROGRAM_BUILD_PENDING;
+
+	if (workerState == WORKER_UNAVAILABLE)
+	{
+		// 工作线程创建共享上下文失败，在当前线程同步编译
+		task->program = GLUtils::CreateProgram(task->vertexSource.c_str(), task->fragSource.c_str());
+	}
+	else if (sync)
+	{
+		glWaitSync(sync, 0, GL_TIMEOUT_IGNORED);
+		glDeleteSync(sync);
+		// 工作线程登记的 location 属于它的共享上下文，在渲染上下文下重新登记
+		if (task->program) UniformLocationCache::Build(task->program);
+	}
+	task->state = task->program ? PROGRAM_BUILD_READY : PROGRAM_BUILD_FAILED;
+	return task->state;
+}
+
+ProgramBuildState AsyncProgramBuilder::Poll(ProgramBuildHandle handle, GLuint &program)
+{
+	auto iter = m_Tasks.find(handle);
+	if (iter == m_Tasks.end()) return PROGRAM_BUILD_INVALID;
+
+	ProgramBuildState state = CheckTask(iter->second, false);
+	if (state != PROGRAM_BUILD_PENDING)
+	{
+		program = iter->second->program;
+		m_Tasks.erase(iter);
+	}
+	return state;
+}
+
+GLuint AsyncProgramBuilder::Wait(ProgramBuildHandle handle)
+{
+	auto iter = m_Tasks.find(handle);
+	if (iter == m_Tasks.end()) return GL_NONE;
+
+	CheckTask(iter->second, true);
+	GLuint program = iter->second->program;
+	m_Tasks.erase(iter);
+	return program;
+}
+
+void AsyncProgramBuilder::Cancel(ProgramBuildHandle handle)
+{
+	auto iter = m_Tasks.find(handle);
+	if (iter == m_Tasks.end()) return;
+
+	std::shared_ptr<ProgramBuildTask> task = iter->second;
+	m_Tasks.erase(iter);
+	ReleaseTask(task);
+}
+
+void AsyncProgramBuilder::ReleaseTask(std::shared_ptr<ProgramBuildTask> &task)
+{
+	if (task->parallel || task->state != PROGRAM_BUILD_PENDING)
+	{
+		if (task->vertexShader) glDeleteShader(task->vertexShader);
+		if (task->fragShader) glDeleteShader(task->fragShader);
+		if (task->program) glDeleteProgram(task->program);
+		task->vertexShader = task->fragShader = task->program = GL_NONE;
+		return;
+	}
+
+	// 工作线程尚未完成时由其负责删除，已完成则在这里删除
+	std::unique_lock<std::mutex> lock(task->mutex);
+	task->cancelled = true;
+	if (task->workerState == WORKER_DONE)
+	{
+		if (task->sync) glDeleteSync(task->sync);
+		if (task->program) glDeleteProgram(task->program);
+		task->sync = nullptr;
+		task->program = GL_NONE;
+	}
+}
@@ -0,0 +1,89 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_ASYNCPROGRAMBUILDER_H
+#define NDK_OPENGLES_3_0_ASYNCPROGRAMBUILDER_H
+
+#include <GLES3/gl3.h>
+#include <EGL/egl.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+typedef int ProgramBuildHandle;
+
+#define INVALID_PROGRAM_BUILD_HANDLE 0
+
+enum ProgramBuildState
+{
+	PROGRAM_BUILD_PENDING,
+	PROGRAM_BUILD_READY,
+	PROGRAM_BUILD_FAILED,
+	PROGRAM_BUILD_INVALID,
+};
+
+struct ProgramBuildTask;
+class ShaderCompileLooper;
+
+/**
+ * 异步构建 program，避免 Init() 阻塞 GL 线程等待驱动编译链接。
+ * 1. 支持 GL_KHR_parallel_shader_compile 时，提交编译链接后不查询状态，逐帧轮询 GL_COMPLETION_STATUS_KHR；
+ * 2. 否则在共享 EGLContext 的工作线程上调用 GLUtils::CreateProgram，完成后通过 fence 同步到渲染线程；
+ * 3. 两者都不可用时退化为同步编译。
+ * 除 DestroyInstance 外，所有接口都需在持有 GL 上下文的渲染线程调用。
+ *
+ * 用法：
+ *   m_BuildHandle = AsyncProgramBuilder::GetInstance()->CreateProgramAsync(vs, fs);
+ *   ...
+ *   // Draw() 中
+ *   if (AsyncProgramBuilder::GetInstance()->Poll(m_BuildHandle, m_ProgramObj) == PROGRAM_BUILD_PENDING) { 绘制占位内容; return; }
+ */
+class AsyncProgramBuilder
+{
+public:
+	static AsyncProgramBuilder *GetInstance();
+
+	static void DestroyInstance();
+
+	ProgramBuildHandle CreateProgramAsync(const char *pVertexShaderSource, const char *pFragShaderSource);
+
+	// 非阻塞查询，READY 时通过 program 返回结果，并释放 handle（之后再查询返回 PROGRAM_BUILD_INVALID）
+	ProgramBuildState Poll(ProgramBuildHandle handle, GLuint &program);
+
+	// 阻塞等待构建完成，失败返回 0
+	GLuint Wait(ProgramBuildHandle handle);
+
+	// 放弃构建，已生成的 program 会被删除
+	void Cancel(ProgramBuildHandle handle);
+
+	bool IsParallelCompileSupported();
+
+private:
+	AsyncProgramBuilder();
+
+	~AsyncProgramBuilder();
+
+	void ProbeCapabilities();
+
+	void SubmitParallel(std::shared_ptr<ProgramBuildTask> &task);
+
+	bool SubmitToWorker(std::shared_ptr<ProgramBuildTask> &task);
+
+	ProgramBuildState CheckTask(std::shared_ptr<ProgramBuildTask> &task, bool wait);
+
+	void ReleaseTask(std::shared_ptr<ProgramBuildTask> &task);
+
+	static AsyncProgramBuilder *s_Instance;
+	static std::mutex s_InstanceMutex;
+
+	std::map<ProgramBuildHandle, std::shared_ptr<ProgramBuildTask>> m_Tasks;
+	ProgramBuildHandle m_NextHandle;
+	bool m_Probed;
+	bool m_ParallelCompile;
+	ShaderCompileLooper *m_Worker;
+	EGLContext m_WorkerSharedCtx;
+};
+
+#endif //NDK_OPENGLES_3_0_ASYNCPROGRAMBUILDER_H
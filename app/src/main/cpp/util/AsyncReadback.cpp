@@ -0,0 +1,203 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "AsyncReadback.h"
+#include "TraceRecorder.h"
+#include "LogUtil.h"
+
+// 阻塞等待时每次 glClientWaitSync 的超时，超时后继续等待
+#define ASYNC_READBACK_WAIT_TIMEOUT_NS 100000000
+
+AsyncReadback::AsyncReadback(int depth, GLenum target)
+{
+	if (depth < 1) depth = 1;
+	if (depth > ASYNC_READBACK_MAX_DEPTH) depth = ASYNC_READBACK_MAX_DEPTH;
+	m_Target = target;
+	m_Slots.resize(depth);
+	m_Head = 0;
+	m_PendingCount = 0;
+	m_NextFrameId = 0;
+	m_StallCount = 0;
+	m_Callback = nullptr;
+	m_pCallbackContext = nullptr;
+}
+
+AsyncReadback::~AsyncReadback()
+{
+	// 析构可能发生在 GL 上下文销毁之后，不调用 GL，GL 对象由样例的 Destroy() 释放
+}
+
+void AsyncReadback::SetCallback(ReadbackDoneCallback callback, void *pContext)
+{
+	m_Callback = callback;
+	m_pCallbackContext = pContext;
+}
+
+bool AsyncReadback::GetReadSize(int format, int width, int height, int &readWidth, int &readHeight)
+{
+	switch (format)
+	{
+		case IMAGE_FORMAT_RGBA:
+			readWidth = width;
+			readHeight = height;
+			break;
+		case IMAGE_FORMAT_YUYV:
+			if (width % 2 != 0) return false;
+			readWidth = width / 2;
+			readHeight = height;
+			break;
+		case IMAGE_FORMAT_NV21:
+		case IMAGE_FORMAT_NV12:
+		case IMAGE_FORMAT_I420:
+			if (width % 4 != 0 || height % 2 != 0) return false;
+			readWidth = width / 4;
+			readHeight = height * 3 / 2;
+			break;
+		case IMAGE_FORMAT_I444:
+			if (width % 4 != 0) return false;
+			readWidth = width / 4;
+			readHeight = height * 3;
+			break;
+		case IMAGE_FORMAT_GRAY:
+			if (width % 4 != 0) return false;
+			readWidth = width / 4;
+			readHeight = height;
+			break;
+		default:
+			return false;
+	}
+	return readWidth > 0 && readHeight > 0;
+}
+
+int64_t AsyncReadback::Submit(int format, int width, int height)
+{
+	if (m_Target != GL_PIXEL_PACK_BUFFER)
+	{
+		LOGCATE("AsyncReadback::Submit target=0x%x is not GL_PIXEL_PACK_BUFFER", m_Target);
+		return -1;
+	}
+	int readWidth = 0, readHeight = 0;
+	if (!GetReadSize(format, width, height, readWidth, readHeight))
+	{
+		LOGCATE("AsyncReadback::Submit unsupported format=%d, size=%dx%d", format, width, height);
+		return -1;
+	}
+
+	AcquireBuffer((size_t) readWidth * readHeight * 4);
+	glReadPixels(0, 0, readWidth, readHeight, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, GL_NONE);
+	return Commit(format, width, height);
+}
+
+GLuint AsyncReadback::AcquireBuffer(size_t size)
+{
+	int depth = (int) m_Slots.size();
+	if (m_PendingCount == depth)
+	{
+		// 环已满，等待最老的一帧完成后复用它的缓冲区
+		TRACE_INSTANT("AsyncReadbackStall");
+		m_StallCount++;
+		Complete(m_Slots[m_Head], true);
+		m_Head = (m_Head + 1) % depth;
+		m_PendingCount--;
+	}
+
+	ReadbackSlot &slot = m_Slots[(m_Head + m_PendingCount) % depth];
+	if (slot.bufferId == GL_NONE) glGenBuffers(1, &slot.bufferId);
+	glBindBuffer(m_Target, slot.bufferId);
+	if (slot.capacity < size)
+	{
+		glBufferData(m_Target, size, nullptr, GL_STREAM_READ);
+		slot.capacity = size;
+	}
+	return slot.bufferId;
+}
+
+int64_t AsyncReadback::Commit(int format, int width, int height)
+{
+	ReadbackSlot &slot = m_Slots[(m_Head + m_PendingCount) % (int) m_Slots.size()];
+	slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	slot.format = format;
+	slot.width = width;
+	slot.height = height;
+	slot.frameId = m_NextFrameId++;
+	m_PendingCount++;
+	return slot.frameId;
+}
+
+bool AsyncReadback::Complete(ReadbackSlot &slot, bool wait)
+{
+	if (slot.fence)
+	{
+		GLenum status;
+		do
+		{
+			status = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, wait ? ASYNC_READBACK_WAIT_TIMEOUT_NS : 0);
+		} while (wait && status == GL_TIMEOUT_EXPIRED);
+		if (status == GL_TIMEOUT_EXPIRED) return false;
+		if (status == GL_WAIT_FAILED)
+		{
+			LOGCATE("AsyncReadback::Complete glClientWaitSync failed, frameId=%lld", (long long) slot.frameId);
+		}
+		glDeleteSync(slot.fence);
+		slot.fence = nullptr;
+	}
+
+	TRACE_SCOPE("AsyncReadback::Complete");
+	glBindBuffer(m_Target, slot.bufferId);
+	int size = NativeImageUtil::GetPackedSize(slot.format, slot.width, slot.height);
+	uint8_t *pData = static_cast<uint8_t *>(glMapBufferRange(m_Target, 0, size, GL_MAP_READ_BIT));
+	if (pData)
+	{
+		NativeImage image;
+		image.format = slot.format;
+		image.width = slot.width;
+		image.height = slot.height;
+		NativeImageUtil::AttachNativeImage(&image, pData);
+		if (m_Callback) m_Callback(m_pCallbackContext, &image, slot.frameId);
+		glUnmapBuffer(m_Target);
+	}
+	else
+	{
+		LOGCATE("AsyncReadback::Complete glMapBufferRange fail, frameId=%lld", (long long) slot.frameId);
+	}
+	glBindBuffer(m_Target, GL_NONE);
+	return true;
+}
+
+int AsyncReadback::Poll()
+{
+	int depth = (int) m_Slots.size();
+	int completed = 0;
+	while (m_PendingCount > 0 && Complete(m_Slots[m_Head], false))
+	{
+		m_Head = (m_Head + 1) % depth;
+		m_PendingCount--;
+		completed++;
+	}
+	return completed;
+}
+
+void AsyncReadback::Flush()
+{
+	int depth = (int) m_Slots.size();
+	while (m_PendingCount > 0)
+	{
+		Complete(m_Slots[m_Head], true);
+		m_Head = (m_Head + 1) % depth;
+		m_PendingCount--;
+	}
+}
+
+void AsyncReadback::Destroy()
+{
+	for (ReadbackSlot &slot : m_Slots)
+	{
+		if (slot.fence) glDeleteSync(slot.fence);
+		if (slot.bufferId != GL_NONE) glDeleteBuffers(1, &slot.bufferId);
+		slot = ReadbackSlot();
+	}
+	m_Head = 0;
+	m_PendingCount = 0;
+}
@@ -0,0 +1,89 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_ASYNCREADBACK_H
+#define NDK_OPENGLES_3_0_ASYNCREADBACK_H
+
+#include <GLES3/gl3.h>
+#include <vector>
+#include "ImageDef.h"
+
+#define ASYNC_READBACK_DEFAULT_DEPTH 3
+#define ASYNC_READBACK_MAX_DEPTH     8
+
+// pImage 指向映射的 PBO 内存，只在回调内有效，需要保留时通过 NativeImageUtil::CopyNativeImage 拷贝
+typedef void (*ReadbackDoneCallback)(void *pContext, const NativeImage *pImage, int64_t frameId);
+
+struct ReadbackSlot
+{
+	GLuint bufferId = GL_NONE;
+	GLsync fence = nullptr;
+	size_t capacity = 0;
+	int format = 0;
+	int width = 0;
+	int height = 0;
+	int64_t frameId = 0;
+};
+
+/**
+ * 基于缓冲区环形队列的异步回读，替代同步 glReadPixels。
+ * Submit 把当前读 framebuffer 的像素拷到 PBO 并插入 fence 后立即返回，
+ * Poll 在 fence 触发后映射缓冲区并回调，GPU 拷贝与 CPU 后续帧的工作重叠。
+ * 环中 depth 个缓冲区都未完成时会等待最老的一帧，并计入 GetStallCount()。
+ *
+ * target 为 GL_PIXEL_PACK_BUFFER 时使用 Submit；其他 target（如计算着色器写入的 GL_SHADER_STORAGE_BUFFER）
+ * 由调用方在 AcquireBuffer 和 Commit 之间自行写入缓冲区，Poll / Flush / 回调与 PBO 回读相同。
+ *
+ * 回读按 format 的紧凑布局计算 glReadPixels 矩形，与 RGB2*Sample 的打包方式一致：
+ *   RGBA: width x height，YUYV: width/2 x height，NV21/NV12/I420: width/4 x height*3/2，I444: width/4 x height*3
+ * 所有接口都需在持有 GL 上下文的渲染线程调用。
+ */
+class AsyncReadback
+{
+public:
+	AsyncReadback(int depth = ASYNC_READBACK_DEFAULT_DEPTH, GLenum target = GL_PIXEL_PACK_BUFFER);
+
+	~AsyncReadback();
+
+	void SetCallback(ReadbackDoneCallback callback, void *pContext);
+
+	// 从当前绑定的 GL_READ_FRAMEBUFFER 回读 width x height 的 format 图像，返回帧序号，失败返回 -1
+	int64_t Submit(int format, int width, int height);
+
+	// 取环中下一个至少 size 字节的缓冲区并绑定到 target，环满时先完成最老的一帧
+	GLuint AcquireBuffer(size_t size);
+
+	// AcquireBuffer 取到的缓冲区已提交写入命令，插入 fence 入队，返回帧序号
+	int64_t Commit(int format, int width, int height);
+
+	// 非阻塞地完成已就绪的回读并回调，返回完成的个数
+	int Poll();
+
+	// 阻塞等待所有未完成的回读并回调
+	void Flush();
+
+	// 删除 PBO 和 fence，未完成的回读直接丢弃
+	void Destroy();
+
+	int GetPendingCount() const { return m_PendingCount; }
+
+	int GetStallCount() const { return m_StallCount; }
+
+	// format 打包成 RGBA8 后 glReadPixels 的宽高，格式不支持或尺寸未对齐时返回 false
+	static bool GetReadSize(int format, int width, int height, int &readWidth, int &readHeight);
+
+private:
+	bool Complete(ReadbackSlot &slot, bool wait);
+
+	GLenum m_Target;
+	std::vector<ReadbackSlot> m_Slots;
+	int m_Head;          // 最老的未完成回读
+	int m_PendingCount;
+	int64_t m_NextFrameId;
+	int m_StallCount;
+	ReadbackDoneCallback m_Callback;
+	void *m_pCallbackContext;
+};
+
+#endif //NDK_OPENGLES_3_0_ASYNCREADBACK_H
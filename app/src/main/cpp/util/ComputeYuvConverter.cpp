@@ -0,0 +1,236 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "ComputeYuvConverter.h"
+#include <string>
+#include "GLUtils.h"
+#include "LogUtil.h"
+
+#define COMPUTE_YUV_LOCAL_SIZE      256
+#define COMPUTE_YUV_MAX_GROUPS_X    65535
+
+static int s_Backend = YUV_BACKEND_FRAGMENT;
+
+// 每个调用输出一个 uint，按字节从低到高为紧凑布局中的 4 个连续字节
+static const char s_ComputeShaderBody[] = R"(
+layout(local_size_x = 256) in;
+layout(binding = 0) uniform highp sampler2D s_Image;
+layout(std430, binding = 0) writeonly buffer YuvBuffer {
+	uint data[];
+} yuvBuffer;
+uniform ivec2 u_Size;
+uniform uint u_WordCount;
+const vec3 COEF_Y = vec3( 0.257,  0.504,  0.098);
+const vec3 COEF_U = vec3(-0.148, -0.291,  0.439);
+const vec3 COEF_V = vec3( 0.439, -0.368, -0.071);
+
+uint ToByte(float v)
+{
+	return uint(clamp(v, 0.0, 1.0) * 255.0 + 0.5);
+}
+
+uint Pack(uint b0, uint b1, uint b2, uint b3)
+{
+	return b0 | (b1 << 8) | (b2 << 16) | (b3 << 24);
+}
+
+uint Luma(int x, int y)
+{
+	return ToByte(dot(texelFetch(s_Image, ivec2(x, y), 0).rgb, COEF_Y) + 0.063);
+}
+
+// 返回 (U, V)，取 BLOCK_W x BLOCK_H 像素块的均值
+uvec2 Chroma(int cx, int cy)
+{
+	vec3 c = vec3(0.0);
+	for (int j = 0; j < BLOCK_H; ++j)
+	{
+		for (int i = 0; i < BLOCK_W; ++i)
+		{
+			c += texelFetch(s_Image, ivec2(cx * BLOCK_W + i, cy * BLOCK_H + j), 0).rgb;
+		}
+	}
+	c /= float(BLOCK_W * BLOCK_H);
+	return uvec2(ToByte(dot(c, COEF_U) + 0.502), ToByte(dot(c, COEF_V) + 0.502));
+}
+
+uint ConvertWord(int b)
+{
+	int w = u_Size.x;
+#ifdef FORMAT_YUYV
+	// Y0 U Y1 V，每个 uint 正好是一对像素
+	int y = b / (w * 2);
+	int x = (b - y * w * 2) / 2;
+	uvec2 uv = Chroma(x / 2, y);
+	return Pack(Luma(x, y), uv.x, Luma(x + 1, y), uv.y);
+#else
+	int lumaSize = w * u_Size.y;
+	if (b < lumaSize)
+	{
+		int y = b / w;
+		int x = b - y * w;
+		return Pack(Luma(x, y), Luma(x + 1, y), Luma(x + 2, y), Luma(x + 3, y));
+	}
+	b -= lumaSize;
+#ifdef FORMAT_NV21
+	// VU 交错，一行 w 字节，每个 uint 含两对 VU
+	int cy = b / w;
+	int cx = (b - cy * w) / 2;
+	uvec2 uv0 = Chroma(cx, cy);
+	uvec2 uv1 = Chroma(cx + 1, cy);
+	return Pack(uv0.y, uv0.x, uv1.y, uv1.x);
+#else
+	// U、V 两个独立平面
+	int cw = w / BLOCK_W;
+	int planeSize = cw * (u_Size.y / BLOCK_H);
+	int plane = b / planeSize;
+	int index = b - plane * planeSize;
+	int cy = index / cw;
+	int cx = index - cy * cw;
+	uvec4 c;
+	for (int i = 0; i < 4; ++i)
+	{
+		uvec2 uv = Chroma(cx + i, cy);
+		c[i] = plane == 0 ? uv.x : uv.y;
+	}
+	return Pack(c.x, c.y, c.z, c.w);
+#endif
+#endif
+}
+
+void main()
+{
+	uint word = (gl_WorkGroupID.y * gl_NumWorkGroups.x + gl_WorkGroupID.x) * 256u + gl_LocalInvocationIndex;
+	if (word >= u_WordCount) return;
+	yuvBuffer.data[word] = ConvertWord(int(word) * 4);
+}
+)";
+
+ComputeYuvConverter::ComputeYuvConverter(int depth) : m_Readback(depth, GL_SHADER_STORAGE_BUFFER)
+{
+	m_Format = 0;
+	m_ProgramObj = GL_NONE;
+}
+
+ComputeYuvConverter::~ComputeYuvConverter()
+{
+	// 析构可能发生在 GL 上下文销毁之后，不调用 GL，GL 对象由样例的 Destroy() 释放
+}
+
+void ComputeYuvConverter::SetBackend(int backend)
+{
+	s_Backend = backend;
+}
+
+int ComputeYuvConverter::GetBackend()
+{
+	return s_Backend;
+}
+
+const char *ComputeYuvConverter::GetBackendName(int backend)
+{
+	return backend == YUV_BACKEND_COMPUTE ? "compute" : "fragment";
+}
+
+void ComputeYuvConverter::SetCallback(ReadbackDoneCallback callback, void *pContext)
+{
+	m_Readback.SetCallback(callback, pContext);
+}
+
+int ComputeYuvConverter::Init(int format)
+{
+	const char *pDefines;
+	switch (format)
+	{
+		case IMAGE_FORMAT_NV21:
+			pDefines = "#define FORMAT_NV21\n#define BLOCK_W 2\n#define BLOCK_H 2\n";
+			break;
+		case IMAGE_FORMAT_I420:
+			pDefines = "#define FORMAT_I420\n#define BLOCK_W 2\n#define BLOCK_H 2\n";
+			break;
+		case IMAGE_FORMAT_I444:
+			pDefines = "#define FORMAT_I444\n#define BLOCK_W 1\n#define BLOCK_H 1\n";
+			break;
+		case IMAGE_FORMAT_YUYV:
+			pDefines = "#define FORMAT_YUYV\n#define BLOCK_W 2\n#define BLOCK_H 1\n";
+			break;
+		default:
+			LOGCATE("ComputeYuvConverter::Init unsupported format=%d", format);
+			return -1;
+	}
+
+	GLint major = 0, minor = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &major);
+	glGetIntegerv(GL_MINOR_VERSION, &minor);
+	if (major * 10 + minor < 31)
+	{
+		LOGCATE("ComputeYuvConverter::Init need GLES 3.1, current %d.%d", major, minor);
+		return -1;
+	}
+
+	std::string source = std::string("#version 310 es\n") + pDefines + s_ComputeShaderBody;
+	m_ProgramObj = GLUtils::LoadComputeShader(source.c_str());
+	if (m_ProgramObj == GL_NONE)
+	{
+		LOGCATE("ComputeYuvConverter::Init compile fail, format=%d", format);
+		return -1;
+	}
+	m_Format = format;
+	return 0;
+}
+
+int64_t ComputeYuvConverter::Submit(GLuint textureId, int width, int height)
+{
+	if (m_ProgramObj == GL_NONE) return -1;
+	int alignX = m_Format == IMAGE_FORMAT_I420 ? 8 : 4;
+	int alignY = m_Format == IMAGE_FORMAT_NV21 || m_Format == IMAGE_FORMAT_I420 ? 2 : 1;
+	if (width <= 0 || height <= 0 || width % alignX != 0 || height % alignY != 0)
+	{
+		LOGCATE("ComputeYuvConverter::Submit unaligned size=%dx%d, format=%d", width, height, m_Format);
+		return -1;
+	}
+
+	size_t size = (size_t) NativeImageUtil::GetPackedSize(m_Format, width, height);
+	GLuint bufferId = m_Readback.AcquireBuffer(size);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, bufferId);
+
+	GLuint wordCount = (GLuint) (size / 4);
+	GLuint groups = (wordCount + COMPUTE_YUV_LOCAL_SIZE - 1) / COMPUTE_YUV_LOCAL_SIZE;
+	GLuint groupsX = groups < COMPUTE_YUV_MAX_GROUPS_X ? groups : COMPUTE_YUV_MAX_GROUPS_X;
+	GLuint groupsY = (groups + groupsX - 1) / groupsX;
+
+	glUseProgram(m_ProgramObj);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, textureId);
+	GLUtils::setInt(m_ProgramObj, "s_Image", 0);
+	glUniform2i(GLUtils::GetUniformLocation(m_ProgramObj, "u_Size"), width, height);
+	glUniform1ui(GLUtils::GetUniformLocation(m_ProgramObj, "u_WordCount"), wordCount);
+	glDispatchCompute(groupsX, groupsY, 1);
+	// 之后映射 SSBO 需要看到计算着色器的写入
+	glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, GL_NONE);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, GL_NONE);
+	glBindTexture(GL_TEXTURE_2D, GL_NONE);
+	return m_Readback.Commit(m_Format, width, height);
+}
+
+int ComputeYuvConverter::Poll()
+{
+	return m_Readback.Poll();
+}
+
+void ComputeYuvConverter::Flush()
+{
+	m_Readback.Flush();
+}
+
+void ComputeYuvConverter::Destroy()
+{
+	m_Readback.Destroy();
+	if (m_ProgramObj != GL_NONE)
+	{
+		glDeleteProgram(m_ProgramObj);
+		m_ProgramObj = GL_NONE;
+	}
+}
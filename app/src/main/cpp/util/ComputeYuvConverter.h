@@ -0,0 +1,63 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_COMPUTEYUVCONVERTER_H
+#define NDK_OPENGLES_3_0_COMPUTEYUVCONVERTER_H
+
+#include <GLES3/gl31.h>
+#include "ImageDef.h"
+#include "AsyncReadback.h"
+
+#define YUV_BACKEND_FRAGMENT 0   // 片段着色器把 4 个输出字节打包进一个 RGBA 像素，再 glReadPixels
+#define YUV_BACKEND_COMPUTE  1   // 计算着色器直接把平面 YUV 写进 SSBO，映射 SSBO 回读
+
+#define COMPUTE_YUV_DEFAULT_DEPTH 3
+
+/**
+ * 基于计算着色器的 RGBA 转 YUV，输出 NV21 / I420 / I444 / YUYV 的紧凑平面布局。
+ * 每个调用写 SSBO 中的一个 uint（4 个输出字节），色度取对应像素块的均值，
+ * 系数与 RGB2*Sample 的片段着色器一致。结果通过 target 为 GL_SHADER_STORAGE_BUFFER 的 AsyncReadback 环异步回读：
+ * Submit 派发后插入 fence 立即返回，Poll / Flush 映射完成的 SSBO 并回调，回调参数同 AsyncReadback。
+ * 要求 GLES 3.1；宽需为 4 的倍数（I420 为 8 的倍数），色度下采样的方向上尺寸为偶数。
+ */
+class ComputeYuvConverter
+{
+public:
+	ComputeYuvConverter(int depth = COMPUTE_YUV_DEFAULT_DEPTH);
+
+	~ComputeYuvConverter();
+
+	void SetCallback(ReadbackDoneCallback callback, void *pContext);
+
+	// 编译 format 对应的计算着色器，不支持计算着色器或格式时返回 -1
+	int Init(int format);
+
+	// 把 textureId 指向的 width x height RGBA 纹理转换为 Init 时的格式，返回帧序号，失败返回 -1
+	int64_t Submit(GLuint textureId, int width, int height);
+
+	// 非阻塞地完成已就绪的转换并回调，返回完成的个数
+	int Poll();
+
+	// 阻塞等待所有未完成的转换并回调
+	void Flush();
+
+	// 删除程序、SSBO 和 fence
+	void Destroy();
+
+	int GetStallCount() const { return m_Readback.GetStallCount(); }
+
+	// 全局选择 RGB2*Sample 使用的转换后端，样例在 Init 时读取
+	static void SetBackend(int backend);
+
+	static int GetBackend();
+
+	static const char *GetBackendName(int backend);
+
+private:
+	AsyncReadback m_Readback;
+	int m_Format;
+	GLuint m_ProgramObj;
+};
+
+#endif //NDK_OPENGLES_3_0_COMPUTEYUVCONVERTER_H
@@ -0,0 +1,294 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <string.h>
+#include <EGL/egl.h>
+#include <GLES2/gl2ext.h>
+#include "LogUtil.h"
+
+#ifndef GL_TIMESTAMP_EXT
+#define GL_TIMESTAMP_EXT          0x8E28
+#endif
+#ifndef GL_GPU_DISJOINT_EXT
+#define GL_GPU_DISJOINT_EXT       0x8FBB
+#endif
+#ifndef GL_QUERY_COUNTER_BITS_EXT
+#define GL_QUERY_COUNTER_BITS_EXT 0x8864
+#endif
+
+typedef void (GL_APIENTRYP PFN_GL_QUERY_COUNTER_EXT)(GLuint id, GLenum target);
+typedef void (GL_APIENTRYP PFN_GL_GET_QUERY_OBJECT_UI64V_EXT)(GLuint id, GLenum pname, GLuint64 *params);
+
+static PFN_GL_QUERY_COUNTER_EXT s_glQueryCounterEXT = nullptr;
+static PFN_GL_GET_QUERY_OBJECT_UI64V_EXT s_glGetQueryObjectui64vEXT = nullptr;
+
+bool FrameProfiler::s_Enabled = false;
+FrameProfiler *FrameProfiler::s_Instance = nullptr;
+
+FrameProfiler *FrameProfiler::GetInstance()
+{
+	if (s_Instance == nullptr)
+	{
+		s_Instance = new FrameProfiler();
+	}
+	return s_Instance;
+}
+
+void FrameProfiler::DestroyInstance()
+{
+	if (s_Instance)
+	{
+		s_Enabled = false;
+		delete s_Instance;
+		s_Instance = nullptr;
+	}
+}
+
+FrameProfiler::FrameProfiler()
+{
+	m_FrameNumber = 0;
+	m_InFrame = false;
+	m_GpuTimerProbed = false;
+	m_GpuTimerSupported = false;
+}
+
+FrameProfiler::~FrameProfiler()
+{
+	// 查询对象随 GL 上下文一起销毁，这里只丢弃记录
+}
+
+void FrameProfiler::SetEnabled(bool enable)
+{
+	if (!enable && s_Enabled)
+	{
+		ReleaseQueries();
+		m_ScopeStack.clear();
+		m_InFrame = false;
+	}
+	s_Enabled = enable;
+	LOGCATE("FrameProfiler::SetEnabled enable=%d", enable);
+}
+
+void FrameProfiler::ProbeGpuTimer()
+{
+	m_GpuTimerProbed = true;
+	const char *pExtensions = (const char *) glGetString(GL_EXTENSIONS);
+	if (pExtensions == nullptr || strstr(pExtensions, "GL_EXT_disjoint_timer_query") == nullptr) return;
+
+	s_glQueryCounterEXT = (PFN_GL_QUERY_COUNTER_EXT) eglGetProcAddress("glQueryCounterEXT");
+	s_glGetQueryObjectui64vEXT = (PFN_GL_GET_QUERY_OBJECT_UI64V_EXT) eglGetProcAddress("glGetQueryObjectui64vEXT");
+	if (s_glQueryCounterEXT == nullptr || s_glGetQueryObjectui64vEXT == nullptr) return;
+
+	// 部分驱动只支持 TIME_ELAPSED，不支持 timestamp，无法嵌套，此时只统计 CPU
+	GLint counterBits = 0;
+	glGetQueryiv(GL_TIMESTAMP_EXT, GL_QUERY_COUNTER_BITS_EXT, &counterBits);
+	glGetError();
+	m_GpuTimerSupported = counterBits > 0;
+	LOGCATE("FrameProfiler::ProbeGpuTimer timestamp counter bits=%d", counterBits);
+}
+
+GLuint FrameProfiler::AllocQuery(FrameSlot &slot)
+{
+	if (slot.usedQueries == (int) slot.queries.size())
+	{
+		GLuint query = GL_NONE;
+		glGenQueries(1, &query);
+		slot.queries.push_back(query);
+	}
+	return slot.queries[slot.usedQueries++];
+}
+
+void FrameProfiler::ReleaseQueries()
+{
+	for (auto &slot : m_Slots)
+	{
+		if (!slot.queries.empty())
+		{
+			glDeleteQueries((GLsizei) slot.queries.size(), slot.queries.data());
+		}
+		slot.queries.clear();
+		slot.records.clear();
+		slot.usedQueries = 0;
+		slot.pending = false;
+		slot.disjoint = false;
+	}
+}
+
+void FrameProfiler::BeginFrame()
+{
+	if (!m_GpuTimerProbed) ProbeGpuTimer();
+
+	if (m_GpuTimerSupported)
+	{
+		// disjoint 标志读取即清除，只在这里读：置位时无法确定影响了哪一帧，所有未解析的帧都作废
+		GLint disjoint = 0;
+		glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+		if (disjoint)
+		{
+			for (auto &pendingSlot : m_Slots)
+			{
+				if (pendingSlot.pending) pendingSlot.disjoint = true;
+			}
+		}
+	}
+
+	FrameSlot &slot = m_Slots[m_FrameNumber % FRAME_PROFILER_QUERY_LATENCY];
+	if (slot.pending) ResolveSlot(slot);
+
+	slot.records.clear();
+	slot.usedQueries = 0;
+	slot.disjoint = false;
+	m_ScopeStack.clear();
+	m_FrameThread = std::this_thread::get_id();
+	m_InFrame = true;
+}
+
+void FrameProfiler::EndFrame()
+{
+	if (!m_InFrame) return;
+	m_InFrame = false;
+
+	FrameSlot &slot = m_Slots[m_FrameNumber % FRAME_PROFILER_QUERY_LATENCY];
+	slot.pending = true;
+	if (!m_GpuTimerSupported) ResolveSlot(slot);
+
+	if (++m_FrameNumber % FRAME_PROFILER_REPORT_INTERVAL == 0)
+	{
+		DumpReport();
+	}
+}
+
+int FrameProfiler::BeginScope(const char *name)
+{
+	if (!m_InFrame || std::this_thread::get_id() != m_FrameThread) return -1;
+
+	FrameSlot &slot = m_Slots[m_FrameNumber % FRAME_PROFILER_QUERY_LATENCY];
+	ScopeRecord record;
+	record.name = name;
+	record.parent = m_ScopeStack.empty() ? -1 : m_ScopeStack.back();
+	record.cpuEndNs = 0;
+	record.gpuBeginQuery = GL_NONE;
+	record.gpuEndQuery = GL_NONE;
+	if (m_GpuTimerSupported)
+	{
+		record.gpuBeginQuery = AllocQuery(slot);
+		s_glQueryCounterEXT(record.gpuBeginQuery, GL_TIMESTAMP_EXT);
+	}
+	record.cpuBeginNs = GetSysCurrentTimeNs();
+
+	int index = (int) slot.records.size();
+	slot.records.push_back(record);
+	m_ScopeStack.push_back(index);
+	return index;
+}
+
+void FrameProfiler::EndScope(int index)
+{
+	if (!m_InFrame || std::this_thread::get_id() != m_FrameThread) return;
+
+	FrameSlot &slot = m_Slots[m_FrameNumber % FRAME_PROFILER_QUERY_LATENCY];
+	if (index < 0 || index >= (int) slot.records.size()) return;
+
+	ScopeRecord &record = slot.records[index];
+	record.cpuEndNs = GetSysCurrentTimeNs();
+	if (m_GpuTimerSupported)
+	{
+		record.gpuEndQuery = AllocQuery(slot);
+		s_glQueryCounterEXT(record.gpuEndQuery, GL_TIMESTAMP_EXT);
+	}
+	if (!m_ScopeStack.empty() && m_ScopeStack.back() == index) m_ScopeStack.pop_back();
+}
+
+void FrameProfiler::ResolveSlot(FrameSlot &slot)
+{
+	slot.pending = false;
+
+	bool gpuValid = m_GpuTimerSupported && slot.usedQueries > 0 && !slot.disjoint;
+	if (gpuValid)
+	{
+		// 延迟了 FRAME_PROFILER_QUERY_LATENCY 帧，结果通常已就绪；未就绪则放弃本帧 GPU 数据，不阻塞
+		GLuint available = GL_FALSE;
+		glGetQueryObjectuiv(slot.queries[slot.usedQueries - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+		gpuValid = available == GL_TRUE;
+	}
+
+	std::vector<std::string> paths(slot.records.size());
+	for (size_t i = 0; i < slot.records.size(); ++i)
+	{
+		ScopeRecord &record = slot.records[i];
+		if (record.cpuEndNs == 0) continue;
+
+		paths[i] = record.parent >= 0 ? paths[record.parent] + "/" + record.name : record.name;
+		ScopeHistory &history = m_History[paths[i]];
+		history.cpuNs[history.cpuPos] = record.cpuEndNs - record.cpuBeginNs;
+		history.cpuPos = (history.cpuPos + 1) % FRAME_PROFILER_HISTORY;
+		history.cpuCount = std::min(history.cpuCount + 1, FRAME_PROFILER_HISTORY);
+
+		if (gpuValid && record.gpuBeginQuery && record.gpuEndQuery)
+		{
+			GLuint64 begin = 0, end = 0;
+			s_glGetQueryObjectui64vEXT(record.gpuBeginQuery, GL_QUERY_RESULT, &begin);
+			s_glGetQueryObjectui64vEXT(record.gpuEndQuery, GL_QUERY_RESULT, &end);
+			history.gpuNs[history.gpuPos] = end > begin ? (int64_t) (end - begin) : 0;
+			history.gpuPos = (history.gpuPos + 1) % FRAME_PROFILER_HISTORY;
+			history.gpuCount = std::min(history.gpuCount + 1, FRAME_PROFILER_HISTORY);
+		}
+	}
+	slot.records.clear();
+}
+
+static void ComputePercentiles(const int64_t *pValues, int count, int64_t &p50, int64_t &p95, int64_t &max)
+{
+	p50 = p95 = max = 0;
+	if (count <= 0) return;
+	std::vector<int64_t> sorted(pValues, pValues + count);
+	std::sort(sorted.begin(), sorted.end());
+	p50 = sorted[count / 2];
+	p95 = sorted[std::min(count - 1, count * 95 / 100)];
+	max = sorted.back();
+}
+
+void FrameProfiler::GetReport(std::vector<ProfileScopeReport> &reports)
+{
+	reports.clear();
+	for (auto &pair : m_History)
+	{
+		ProfileScopeReport report;
+		report.path = pair.first;
+		report.sampleCount = pair.second.cpuCount;
+		report.gpuSampleCount = pair.second.gpuCount;
+		ComputePercentiles(pair.second.cpuNs, pair.second.cpuCount, report.cpuP50Ns, report.cpuP95Ns, report.cpuMaxNs);
+		ComputePercentiles(pair.second.gpuNs, pair.second.gpuCount, report.gpuP50Ns, report.gpuP95Ns, report.gpuMaxNs);
+		reports.push_back(report);
+	}
+}
+
+void FrameProfiler::DumpReport()
+{
+	std::vector<ProfileScopeReport> reports;
+	GetReport(reports);
+	LOGCATI("FrameProfiler::DumpReport frames=%lld, scopes=%d, gpuTimer=%d", (long long) m_FrameNumber, (int) reports.size(), m_GpuTimerSupported);
+	for (auto &report : reports)
+	{
+		if (report.gpuSampleCount > 0)
+		{
+			LOGCATI("FrameProfiler %s cpu p50=%.3fms p95=%.3fms max=%.3fms | gpu p50=%.3fms p95=%.3fms max=%.3fms",
+					report.path.c_str(), report.cpuP50Ns / 1e6, report.cpuP95Ns / 1e6, report.cpuMaxNs / 1e6,
+					report.gpuP50Ns / 1e6, report.gpuP95Ns / 1e6, report.gpuMaxNs / 1e6);
+		}
+		else
+		{
+			LOGCATI("FrameProfiler %s cpu p50=%.3fms p95=%.3fms max=%.3fms",
+					report.path.c_str(), report.cpuP50Ns / 1e6, report.cpuP95Ns / 1e6, report.cpuMaxNs / 1e6);
+		}
+	}
+}
+
+void FrameProfiler::Reset()
+{
+	m_History.clear();
+	m_FrameNumber = 0;
+}
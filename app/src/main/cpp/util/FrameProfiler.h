@@ -0,0 +1,172 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_FRAMEPROFILER_H
+#define NDK_OPENGLES_3_0_FRAMEPROFILER_H
+
+#include <GLES3/gl3.h>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include "stdint.h"
+#include "TraceRecorder.h"
+
+// 编译期开关，置 0 时 PROFILE_SCOPE 完全展开为空
+#ifndef FRAME_PROFILER_ENABLED
+#define FRAME_PROFILER_ENABLED 1
+#endif
+
+// GPU timestamp 查询结果延迟读取的帧数
+#define FRAME_PROFILER_QUERY_LATENCY    4
+// 每个 scope 保留最近多少帧用于统计分位数
+#define FRAME_PROFILER_HISTORY          128
+// 每隔多少帧输出一次统计
+#define FRAME_PROFILER_REPORT_INTERVAL  300
+
+struct ProfileScopeReport
+{
+	std::string path;   // 嵌套路径，如 "OnDrawFrame/TriangleSample"
+	int sampleCount;
+	int64_t cpuP50Ns;
+	int64_t cpuP95Ns;
+	int64_t cpuMaxNs;
+	int gpuSampleCount; // 为 0 表示没有 GPU 数据（不支持或被 disjoint 丢弃）
+	int64_t gpuP50Ns;
+	int64_t gpuP95Ns;
+	int64_t gpuMaxNs;
+};
+
+/**
+ * 逐帧性能分析：嵌套 scope 记录单调时钟 CPU 耗时（ns），
+ * 支持 GL_EXT_disjoint_timer_query 时用 timestamp 查询记录 GPU 耗时，
+ * 按 scope 聚合最近 FRAME_PROFILER_HISTORY 帧，输出 p50/p95/max。
+ * 只统计调用 BeginFrame 的线程（GL 渲染线程）上的 scope，关闭时每个 scope 只有一次分支判断。
+ */
+class FrameProfiler
+{
+public:
+	static FrameProfiler *GetInstance();
+
+	static void DestroyInstance();
+
+	static inline bool IsEnabled()
+	{
+		return s_Enabled;
+	}
+
+	// 需在 GL 线程调用，关闭时释放查询对象
+	void SetEnabled(bool enable);
+
+	void BeginFrame();
+
+	void EndFrame();
+
+	// 返回 scope 索引，未在帧内或非渲染线程时返回 -1
+	int BeginScope(const char *name);
+
+	void EndScope(int index);
+
+	void GetReport(std::vector<ProfileScopeReport> &reports);
+
+	void DumpReport();
+
+	void Reset();
+
+private:
+	struct ScopeRecord
+	{
+		const char *name;
+		int parent;
+		int64_t cpuBeginNs;
+		int64_t cpuEndNs;
+		GLuint gpuBeginQuery;
+		GLuint gpuEndQuery;
+	};
+
+	struct FrameSlot
+	{
+		std::vector<ScopeRecord> records;
+		std::vector<GLuint> queries;
+		int usedQueries = 0;
+		bool pending = false;
+		bool disjoint = false;  // 提交后到解析前发生过 GPU disjoint 事件，GPU 计时不可信
+	};
+
+	struct ScopeHistory
+	{
+		int64_t cpuNs[FRAME_PROFILER_HISTORY];
+		int64_t gpuNs[FRAME_PROFILER_HISTORY];
+		int cpuCount = 0;
+		int gpuCount = 0;
+		int cpuPos = 0;
+		int gpuPos = 0;
+	};
+
+	FrameProfiler();
+
+	~FrameProfiler();
+
+	void ProbeGpuTimer();
+
+	GLuint AllocQuery(FrameSlot &slot);
+
+	void ResolveSlot(FrameSlot &slot);
+
+	void ReleaseQueries();
+
+	static bool s_Enabled;
+	static FrameProfiler *s_Instance;
+
+	FrameSlot m_Slots[FRAME_PROFILER_QUERY_LATENCY];
+	std::vector<int> m_ScopeStack;
+	std::map<std::string, ScopeHistory> m_History;
+	std::thread::id m_FrameThread;
+	int64_t m_FrameNumber;
+	bool m_InFrame;
+	bool m_GpuTimerProbed;
+	bool m_GpuTimerSupported;
+};
+
+/**
+ * RAII scope，同时作为 trace 区间写入 TraceRecorder，两者都关闭时只读取两个标志
+ */
+class ProfileScope
+{
+public:
+	explicit ProfileScope(const char *name) : m_Index(-1), m_TraceName(nullptr)
+	{
+		if (FrameProfiler::IsEnabled()) m_Index = FrameProfiler::GetInstance()->BeginScope(name);
+		if (TraceRecorder::IsEnabled())
+		{
+			m_TraceName = name;
+			TraceRecorder::Begin(name);
+		}
+	}
+
+	~ProfileScope()
+	{
+		if (m_TraceName) TraceRecorder::End(m_TraceName);
+		if (m_Index >= 0) FrameProfiler::GetInstance()->EndScope(m_Index);
+	}
+
+private:
+	int m_Index;
+	const char *m_TraceName;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if FRAME_PROFILER_ENABLED
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#define PROFILE_FRAME_BEGIN() if (FrameProfiler::IsEnabled()) FrameProfiler::GetInstance()->BeginFrame()
+#define PROFILE_FRAME_END() if (FrameProfiler::IsEnabled()) FrameProfiler::GetInstance()->EndFrame()
+#else
+#define PROFILE_SCOPE(name)
+#define PROFILE_FRAME_BEGIN()
+#define PROFILE_FRAME_END()
+#endif
+
+#endif //NDK_OPENGLES_3_0_FRAMEPROFILER_H
@@ -1,5 +1,6 @@
 #include "GLUtils.h"
 #include "LogUtil.h"
+#include "ProgramBinaryCache.h"
 #include <stdlib.h>
 #include <cstring>
 #include <GLES2/gl2ext.h>
@@ -41,6 +42,16 @@ GLuint GLUtils::LoadShader(GLenum shaderType, const char *pSource)
 GLuint GLUtils::CreateProgram(const char *pVertexShaderSource, const char *pFragShaderSource, GLuint &vertexShaderHandle, GLuint &fragShaderHandle)
 {
     GLuint program = 0;
+    const char *sources[] = {pVertexShaderSource, pFragShaderSource};
+    uint64_t cacheKey = ProgramBinaryCache::MakeKey(sources, 2);
+    program = ProgramBinaryCache::Load(cacheKey);
+    if (program)
+    {
+        vertexShaderHandle = 0;
+        fragShaderHandle = 0;
+        LOGCATE("GLUtils::CreateProgram program binary cache hit, program = %d", program);
+        return program;
+    }
     FUN_BEGIN_TIME("GLUtils::CreateProgram")
         vertexShaderHandle = LoadShader(GL_VERTEX_SHADER, pVertexShaderSource);
         if (!vertexShaderHandle) return program;
@@ -50,6 +61,7 @@ GLuint GLUtils::CreateProgram(const char *pVertexShaderSource, const char *pFrag
         program = glCreateProgram();
         if (program)
         {
+            ProgramBinaryCache::PrepareForLink(program);
             glAttachShader(program, vertexShaderHandle);
             CheckGLError("glAttachShader");
             glAttachShader(program, fragShaderHandle);
@@ -81,7 +93,12 @@ GLuint GLUtils::CreateProgram(const char *pVertexShaderSource, const char *pFrag
                 glDeleteProgram(program);
                 program = 0;
             }
+            else
+            {
+                ProgramBinaryCache::Store(cacheKey, program);
+            }
         }
+        UniformLocationCache::Build(program);
     FUN_END_TIME("GLUtils::CreateProgram")
     LOGCATE("GLUtils::CreateProgram program = %d", program);
 	return program;
@@ -90,6 +107,16 @@ GLuint GLUtils::CreateProgram(const char *pVertexShaderSource, const char *pFrag
 GLuint GLUtils::CreateProgramWithFeedback(const char *pVertexShaderSource, const char *pFragShaderSource, GLuint &vertexShaderHandle, GLuint &fragShaderHandle, GLchar const **varying, int varyingCount)
 {
     GLuint program = 0;
+    const char *sources[] = {pVertexShaderSource, pFragShaderSource};
+    uint64_t cacheKey = ProgramBinaryCache::MakeKey(sources, 2, varying, varyingCount);
+    program = ProgramBinaryCache::Load(cacheKey);
+    if (program)
+    {
+        vertexShaderHandle = 0;
+        fragShaderHandle = 0;
+        LOGCATE("GLUtils::CreateProgramWithFeedback program binary cache hit, program = %d", program);
+        return program;
+    }
     FUN_BEGIN_TIME("GLUtils::CreateProgramWithFeedback")
         vertexShaderHandle = LoadShader(GL_VERTEX_SHADER, pVertexShaderSource);
         if (!vertexShaderHandle) return program;
@@ -100,6 +127,7 @@ GLuint GLUtils::CreateProgramWithFeedback(const char *pVertexShaderSource, const
         program = glCreateProgram();
         if (program)
         {
+            ProgramBinaryCache::PrepareForLink(program);
             glAttachShader(program, vertexShaderHandle);
             CheckGLError("glAttachShader");
             glAttachShader(program, fragShaderHandle);
@@ -136,7 +164,12 @@ GLuint GLUtils::CreateProgramWithFeedback(const char *pVertexShaderSource, const
                 glDeleteProgram(program);
                 program = 0;
             }
+            else
+            {
+                ProgramBinaryCache::Store(cacheKey, program);
+            }
         }
+        UniformLocationCache::Build(program);
     FUN_END_TIME("GLUtils::CreateProgramWithFeedback")
     LOGCATE("GLUtils::CreateProgramWithFeedback program = %d", program);
     return program;
@@ -146,6 +179,14 @@ GLuint GLUtils::CreateProgramWithGeometryShader(const char *pVertexShaderSource,
 {
     GLuint program = GL_NONE;
     GLuint vertexShaderHandle = GL_NONE, fragShaderHandle = GL_NONE, geometryShaderHandle = GL_NONE;
+    const char *sources[] = {pVertexShaderSource, pGeometryShaderSource, pFragShaderSource};
+    uint64_t cacheKey = ProgramBinaryCache::MakeKey(sources, 3);
+    program = ProgramBinaryCache::Load(cacheKey);
+    if (program)
+    {
+        LOGCATE("GLUtils::CreateProgramWithGeometryShader program binary cache hit, program = %d", program);
+        return program;
+    }
     FUN_BEGIN_TIME("GLUtils::CreateProgramWithGeometryShader")
         vertexShaderHandle = LoadShader(GL_VERTEX_SHADER, pVertexShaderSource);
         if (!vertexShaderHandle) return program;
@@ -156,6 +197,7 @@ GLuint GLUtils::CreateProgramWithGeometryShader(const char *pVertexShaderSource,
         program = glCreateProgram();
         if (program)
         {
+            ProgramBinaryCache::PrepareForLink(program);
             glAttachShader(program, vertexShaderHandle);
             CheckGLError("CreateProgramWithGeometryShader::glAttachShader vs");
             glAttachShader(program, geometryShaderHandle);
@@ -192,7 +234,12 @@ GLuint GLUtils::CreateProgramWithGeometryShader(const char *pVertexShaderSource,
                 glDeleteProgram(program);
                 program = 0;
             }
+            else
+            {
+                ProgramBinaryCache::Store(cacheKey, program);
+            }
         }
+        UniformLocationCache::Build(program);
     FUN_END_TIME("GLUtils::CreateProgramWithGeometryShader")
     LOGCATE("GLUtils::CreateProgramWithGeometryShader program = %d", program);
     return program;
@@ -203,6 +250,7 @@ void GLUtils::DeleteProgram(GLuint &program)
     LOGCATE("GLUtils::DeleteProgram");
     if (program)
     {
+        UniformLocationCache::Invalidate(program);
         glUseProgram(0);
         glDeleteProgram(program);
         program = 0;
@@ -251,5 +299,41 @@ GLuint GLUtils::LoadComputeShader(const char* computeShaderSource) {
     }
 
     glDeleteShader(computeShader);
+    UniformLocationCache::Build(computeProgram);
     return computeProgram;
 }
+
+void GLUtils::TexImage2D(GLenum target, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type,
+                         int bytesPerPixel, int lineSize, const void *pPixels)
+{
+    int rowBytes = width * bytesPerPixel;
+    if (pPixels == nullptr || lineSize <= 0 || lineSize == rowBytes)
+    {
+        glTexImage2D(target, 0, internalFormat, width, height, 0, format, type, pPixels);
+        return;
+    }
+
+    GLint unpackAlignment = 4, unpackRowLength = 0;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpackAlignment);
+    glGetIntegerv(GL_UNPACK_ROW_LENGTH, &unpackRowLength);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    if (lineSize % bytesPerPixel == 0)
+    {
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, lineSize / bytesPerPixel);
+        glTexImage2D(target, 0, internalFormat, width, height, 0, format, type, pPixels);
+    }
+    else
+    {
+        //行跨度不是像素大小的整数倍，只能逐行上传
+        glTexImage2D(target, 0, internalFormat, width, height, 0, format, type, nullptr);
+        const uint8_t *pRow = static_cast<const uint8_t *>(pPixels);
+        for (int i = 0; i < height; ++i, pRow += lineSize)
+        {
+            glTexSubImage2D(target, 0, 0, i, width, 1, format, type, pRow);
+        }
+    }
+
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, unpackRowLength);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, unpackAlignment);
+}
@@ -13,6 +13,7 @@
 #include <GLES3/gl31.h>
 #include <string>
 #include <glm.hpp>
+#include "UniformLocationCache.h"
 
 #define SHADER_TO_STRING(s) #s
 
@@ -22,12 +23,15 @@ class GLUtils {
 public:
     static GLuint LoadShader(GLenum shaderType, const char *pSource);
 
+    // 链接后着色器即被 detach 并删除，返回 program 时 vertexShaderHandle/fragShaderHandle 为 0；
+    // program binary 缓存命中时不编译着色器，句柄同样为 0，调用方不能依赖这两个句柄
     static GLuint CreateProgram(const char *pVertexShaderSource, const char *pFragShaderSource,
                                 GLuint &vertexShaderHandle,
                                 GLuint &fragShaderHandle);
 
     static GLuint CreateProgram(const char *pVertexShaderSource, const char *pFragShaderSource);
 
+    // 着色器句柄的约定同 CreateProgram
     static GLuint CreateProgramWithFeedback(
             const char *pVertexShaderSource,
             const char *pFragShaderSource,
@@ -44,52 +48,61 @@ public:
 
     static GLuint LoadComputeShader(const char* computeShaderSource);
 
-    static void setBool(GLuint programId, const std::string &name, bool value) {
-        glUniform1i(glGetUniformLocation(programId, name.c_str()), (int) value);
+    // 上传一个图像平面，lineSize 为源数据行跨度（字节），与 width * bytesPerPixel 不一致时通过 GL_UNPACK_ROW_LENGTH 跳过行尾填充
+    static void TexImage2D(GLenum target, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type,
+                           int bytesPerPixel, int lineSize, const void *pPixels);
+
+    // 基于 UniformLocationCache，稳态下不分配字符串也不调用 glGetUniformLocation
+    static GLint GetUniformLocation(GLuint programId, const GLUniformName &name) {
+        return UniformLocationCache::GetLocation(programId, name.hash, name.name);
+    }
+
+    static void setBool(GLuint programId, const GLUniformName &name, bool value) {
+        glUniform1i(GetUniformLocation(programId, name), (int) value);
     }
 
-    static void setInt(GLuint programId, const std::string &name, int value) {
-        glUniform1i(glGetUniformLocation(programId, name.c_str()), value);
+    static void setInt(GLuint programId, const GLUniformName &name, int value) {
+        glUniform1i(GetUniformLocation(programId, name), value);
     }
 
-    static void setFloat(GLuint programId, const std::string &name, float value) {
-        glUniform1f(glGetUniformLocation(programId, name.c_str()), value);
+    static void setFloat(GLuint programId, const GLUniformName &name, float value) {
+        glUniform1f(GetUniformLocation(programId, name), value);
     }
 
-    static void setVec2(GLuint programId, const std::string &name, const glm::vec2 &value) {
-        glUniform2fv(glGetUniformLocation(programId, name.c_str()), 1, &value[0]);
+    static void setVec2(GLuint programId, const GLUniformName &name, const glm::vec2 &value) {
+        glUniform2fv(GetUniformLocation(programId, name), 1, &value[0]);
     }
 
-    static void setVec2(GLuint programId, const std::string &name, float x, float y) {
-        glUniform2f(glGetUniformLocation(programId, name.c_str()), x, y);
+    static void setVec2(GLuint programId, const GLUniformName &name, float x, float y) {
+        glUniform2f(GetUniformLocation(programId, name), x, y);
     }
 
-    static void setVec3(GLuint programId, const std::string &name, const glm::vec3 &value) {
-        glUniform3fv(glGetUniformLocation(programId, name.c_str()), 1, &value[0]);
+    static void setVec3(GLuint programId, const GLUniformName &name, const glm::vec3 &value) {
+        glUniform3fv(GetUniformLocation(programId, name), 1, &value[0]);
     }
 
-    static void setVec3(GLuint programId, const std::string &name, float x, float y, float z) {
-        glUniform3f(glGetUniformLocation(programId, name.c_str()), x, y, z);
+    static void setVec3(GLuint programId, const GLUniformName &name, float x, float y, float z) {
+        glUniform3f(GetUniformLocation(programId, name), x, y, z);
     }
 
-    static void setVec4(GLuint programId, const std::string &name, const glm::vec4 &value) {
-        glUniform4fv(glGetUniformLocation(programId, name.c_str()), 1, &value[0]);
+    static void setVec4(GLuint programId, const GLUniformName &name, const glm::vec4 &value) {
+        glUniform4fv(GetUniformLocation(programId, name), 1, &value[0]);
     }
 
-    static void setVec4(GLuint programId, const std::string &name, float x, float y, float z, float w) {
-        glUniform4f(glGetUniformLocation(programId, name.c_str()), x, y, z, w);
+    static void setVec4(GLuint programId, const GLUniformName &name, float x, float y, float z, float w) {
+        glUniform4f(GetUniformLocation(programId, name), x, y, z, w);
     }
 
-    static void setMat2(GLuint programId, const std::string &name, const glm::mat2 &mat) {
-        glUniformMatrix2fv(glGetUniformLocation(programId, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+    static void setMat2(GLuint programId, const GLUniformName &name, const glm::mat2 &mat) {
+        glUniformMatrix2fv(GetUniformLocation(programId, name), 1, GL_FALSE, &mat[0][0]);
     }
 
-    static void setMat3(GLuint programId, const std::string &name, const glm::mat3 &mat) {
-        glUniformMatrix3fv(glGetUniformLocation(programId, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+    static void setMat3(GLuint programId, const GLUniformName &name, const glm::mat3 &mat) {
+        glUniformMatrix3fv(GetUniformLocation(programId, name), 1, GL_FALSE, &mat[0][0]);
     }
 
-    static void setMat4(GLuint programId, const std::string &name, const glm::mat4 &mat) {
-        glUniformMatrix4fv(glGetUniformLocation(programId, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+    static void setMat4(GLuint programId, const GLUniformName &name, const glm::mat4 &mat) {
+        glUniformMatrix4fv(GetUniformLocation(programId, name), 1, GL_FALSE, &mat[0][0]);
     }
 
     static glm::vec3 texCoordToVertexCoord(glm::vec2 &texCoord) {
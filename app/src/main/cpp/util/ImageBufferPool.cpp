@@ -0,0 +1,146 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "ImageBufferPool.h"
+#include <stdlib.h>
+#include "LogUtil.h"
+
+void ImageBuffer::Release()
+{
+	if (m_RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		m_pPool->Recycle(this);
+	}
+}
+
+ImageBuffer::ImageBuffer(ImageBufferPool *pPool, uint8_t *pData, size_t capacity)
+		: m_pPool(pPool), m_pData(pData), m_Capacity(capacity), m_RefCount(1)
+{
+}
+
+ImageBuffer::~ImageBuffer()
+{
+	free(m_pData);
+}
+
+ImageBufferPool *ImageBufferPool::GetInstance()
+{
+	// 不析构，避免进程退出时仍有图像持有引用
+	static ImageBufferPool *s_pInstance = new ImageBufferPool();
+	return s_pInstance;
+}
+
+ImageBufferPool::ImageBufferPool() : m_MaxPooledBytes(IMAGE_BUFFER_POOL_MAX_BYTES)
+{
+}
+
+ImageBufferPool::~ImageBufferPool()
+{
+	Trim();
+}
+
+size_t ImageBufferPool::GetBucketSize(size_t size)
+{
+	if (size <= IMAGE_BUFFER_ALIGNMENT * 8) return IMAGE_BUFFER_ALIGNMENT * 8;
+
+	size_t pow2 = 1;
+	while ((pow2 << 1) <= size) pow2 <<= 1;
+	size_t step = pow2 >> 3;
+	return (size + step - 1) / step * step;
+}
+
+ImageBuffer *ImageBufferPool::Acquire(size_t size)
+{
+	if (size == 0) return nullptr;
+	size_t bucket = GetBucketSize(size);
+
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		auto it = m_FreeLists.find(bucket);
+		if (it != m_FreeLists.end() && !it->second.empty())
+		{
+			ImageBuffer *pBuffer = it->second.back();
+			it->second.pop_back();
+			pBuffer->m_RefCount.store(1, std::memory_order_relaxed);
+			m_Stats.hits++;
+			m_Stats.pooledBytes -= bucket;
+			m_Stats.inUseBytes += bucket;
+			return pBuffer;
+		}
+	}
+
+	void *pData = nullptr;
+	if (posix_memalign(&pData, IMAGE_BUFFER_ALIGNMENT, bucket) != 0)
+	{
+		LOGCATE("ImageBufferPool::Acquire posix_memalign fail, size=%zu", bucket);
+		return nullptr;
+	}
+
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	m_Stats.misses++;
+	m_Stats.inUseBytes += bucket;
+	size_t totalBytes = m_Stats.inUseBytes + m_Stats.pooledBytes;
+	if (totalBytes > m_Stats.highWaterBytes) m_Stats.highWaterBytes = totalBytes;
+	return new ImageBuffer(this, static_cast<uint8_t *>(pData), bucket);
+}
+
+void ImageBufferPool::Recycle(ImageBuffer *pBuffer)
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	m_Stats.inUseBytes -= pBuffer->m_Capacity;
+	if (m_Stats.pooledBytes + pBuffer->m_Capacity > m_MaxPooledBytes)
+	{
+		lock.unlock();
+		delete pBuffer;
+		return;
+	}
+	m_Stats.pooledBytes += pBuffer->m_Capacity;
+	m_FreeLists[pBuffer->m_Capacity].push_back(pBuffer);
+}
+
+void ImageBufferPool::Trim()
+{
+	std::map<size_t, std::vector<ImageBuffer *>> freeLists;
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		freeLists.swap(m_FreeLists);
+		m_Stats.pooledBytes = 0;
+	}
+
+	for (auto &freeList : freeLists)
+	{
+		for (ImageBuffer *pBuffer : freeList.second)
+		{
+			delete pBuffer;
+		}
+	}
+}
+
+void ImageBufferPool::SetMaxPooledBytes(size_t maxBytes)
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	m_MaxPooledBytes = maxBytes;
+}
+
+ImageBufferPoolStats ImageBufferPool::GetStats()
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	return m_Stats;
+}
+
+void ImageBufferPool::ResetStats()
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	m_Stats.hits = 0;
+	m_Stats.misses = 0;
+	m_Stats.highWaterBytes = m_Stats.inUseBytes + m_Stats.pooledBytes;
+}
+
+void ImageBufferPool::DumpStats()
+{
+	ImageBufferPoolStats stats = GetStats();
+	LOGCATE("ImageBufferPool::DumpStats hits=%llu, misses=%llu, inUse=%zu, pooled=%zu, highWater=%zu",
+			(unsigned long long) stats.hits, (unsigned long long) stats.misses,
+			stats.inUseBytes, stats.pooledBytes, stats.highWaterBytes);
+}
@@ -0,0 +1,100 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_IMAGEBUFFERPOOL_H
+#define NDK_OPENGLES_3_0_IMAGEBUFFERPOOL_H
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <vector>
+#include "stdint.h"
+
+#define IMAGE_BUFFER_ALIGNMENT      64
+#define IMAGE_BUFFER_POOL_MAX_BYTES (64 * 1024 * 1024)
+
+class ImageBufferPool;
+
+/**
+ * 64 字节对齐的图像内存块，引用计数归零时归还给 ImageBufferPool
+ * 每个 AddRef 都要对应一次 Release；NativeImage 只持有 Acquire 返回的那一个引用
+ */
+class ImageBuffer
+{
+public:
+	uint8_t *GetData() const { return m_pData; }
+
+	size_t GetCapacity() const { return m_Capacity; }
+
+	void AddRef() { m_RefCount.fetch_add(1, std::memory_order_relaxed); }
+
+	void Release();
+
+private:
+	friend class ImageBufferPool;
+
+	ImageBuffer(ImageBufferPool *pPool, uint8_t *pData, size_t capacity);
+	~ImageBuffer();
+
+	ImageBufferPool *m_pPool;
+	uint8_t *m_pData;
+	size_t m_Capacity;
+	std::atomic<int> m_RefCount;
+};
+
+struct ImageBufferPoolStats
+{
+	uint64_t hits;          // 从空闲链表复用的次数
+	uint64_t misses;        // 新分配内存的次数
+	size_t inUseBytes;      // 当前被借出的字节数
+	size_t pooledBytes;     // 当前缓存在池中的字节数
+	size_t highWaterBytes;  // inUseBytes + pooledBytes 的峰值
+
+	ImageBufferPoolStats()
+	{
+		hits = misses = 0;
+		inUseBytes = pooledBytes = highWaterBytes = 0;
+	}
+};
+
+/**
+ * 按尺寸分桶的图像内存池，同尺寸的帧缓冲可以跨帧复用，避免每帧 malloc/free
+ * 桶的粒度为所属 2 的幂区间的 1/8，浪费不超过 12.5%
+ */
+class ImageBufferPool
+{
+public:
+	static ImageBufferPool *GetInstance();
+
+	// 借出一块容量不小于 size 的内存，返回的 ImageBuffer 引用计数为 1
+	ImageBuffer *Acquire(size_t size);
+
+	// 释放所有缓存的空闲内存
+	void Trim();
+
+	void SetMaxPooledBytes(size_t maxBytes);
+
+	ImageBufferPoolStats GetStats();
+
+	void ResetStats();
+
+	void DumpStats();
+
+	static size_t GetBucketSize(size_t size);
+
+private:
+	friend class ImageBuffer;
+
+	ImageBufferPool();
+	~ImageBufferPool();
+
+	void Recycle(ImageBuffer *pBuffer);
+
+	std::mutex m_Mutex;
+	std::map<size_t, std::vector<ImageBuffer *>> m_FreeLists;
+	size_t m_MaxPooledBytes;
+	ImageBufferPoolStats m_Stats;
+};
+
+#endif //NDK_OPENGLES_3_0_IMAGEBUFFERPOOL_H
@@ -0,0 +1,352 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "ImageConverter.h"
+#include <string.h>
+#include <vector>
+#include "ImageKernels.h"
+#include "ThreadPool.h"
+#include "TraceRecorder.h"
+#include "LogUtil.h"
+
+// 10bit 中间值下色度的中性值，对应 8bit 的 128
+#define NEUTRAL_CHROMA_10BIT 512
+
+// P010、GRAY10 的 10bit 数据存放在 16bit 的高位
+#define P010_SHIFT 6
+
+// 解析后的平面首地址和行跨度，只设置了 ppPlane[0] 的图像按平面首尾相连补全
+struct PlaneLayout
+{
+	uint8_t *pPlane[3];
+	int lineSize[3];
+};
+
+// 一对行的 10bit YUV444 中间结果
+struct YuvRowPair
+{
+	uint16_t *pY[2];
+	uint16_t *pU[2];
+	uint16_t *pV[2];
+};
+
+static void ResolvePlanes(const NativeImage *pImage, PlaneLayout &layout)
+{
+	int planeCount = NativeImageUtil::GetPlaneCount(pImage->format);
+	for (int i = 0; i < 3; ++i)
+	{
+		layout.pPlane[i] = i < planeCount ? pImage->ppPlane[i] : nullptr;
+		layout.lineSize[i] = i < planeCount ? NativeImageUtil::GetLineSize(pImage, i) : 0;
+		if (i > 0 && i < planeCount && layout.pPlane[i] == nullptr)
+		{
+			layout.pPlane[i] = layout.pPlane[i - 1] + NativeImageUtil::GetPlaneSize(pImage, i - 1);
+		}
+	}
+}
+
+static inline uint8_t *Row(const PlaneLayout &layout, int plane, int y)
+{
+	return layout.pPlane[plane] + (size_t) layout.lineSize[plane] * y;
+}
+
+static inline uint8_t Clamp8(int value)
+{
+	return (uint8_t) (value > 255 ? 255 : value);
+}
+
+static inline uint16_t Clamp10(int value)
+{
+	return (uint16_t) (value > 1023 ? 1023 : value);
+}
+
+static void Fill(uint16_t *pDst, uint16_t value, int count)
+{
+	for (int i = 0; i < count; ++i) pDst[i] = value;
+}
+
+static void Shr16(const uint16_t *pSrc, uint16_t *pDst, int count, int shift)
+{
+	for (int i = 0; i < count; ++i) pDst[i] = (uint16_t) (pSrc[i] >> shift);
+}
+
+static void Shl16(const uint16_t *pSrc, uint16_t *pDst, int count, int shift)
+{
+	for (int i = 0; i < count; ++i) pDst[i] = (uint16_t) (pSrc[i] << shift);
+}
+
+// 半宽的色度行横向复制一份展开为全宽，step 为相邻色度样本的字节间隔
+static void ExpandChroma8(const uint8_t *pSrc, int step, uint16_t *pDst, int chromaW)
+{
+	for (int x = 0; x < chromaW; ++x)
+	{
+		uint16_t value = (uint16_t) (pSrc[x * step] << 2);
+		pDst[x * 2] = value;
+		pDst[x * 2 + 1] = value;
+	}
+}
+
+static void ExpandChroma16(const uint16_t *pSrc, uint16_t *pDst, int chromaW)
+{
+	for (int x = 0; x < chromaW; ++x)
+	{
+		uint16_t value = (uint16_t) (pSrc[x * 2] >> P010_SHIFT);
+		pDst[x * 2] = value;
+		pDst[x * 2 + 1] = value;
+	}
+}
+
+// 解码第 y、y + 1 行为 10bit YUV444
+static void DecodeRows(int format, const PlaneLayout &src, int width, int y, YuvRowPair &rows)
+{
+	int chromaW = width / 2;
+	switch (format)
+	{
+		case IMAGE_FORMAT_RGBA:
+			for (int j = 0; j < 2; ++j)
+			{
+				ImageKernels::RgbaToYuv10(Row(src, 0, y + j), rows.pY[j], rows.pU[j], rows.pV[j], width);
+			}
+			return;
+		case IMAGE_FORMAT_GRAY:
+		case IMAGE_FORMAT_GRAY10:
+			for (int j = 0; j < 2; ++j)
+			{
+				if (format == IMAGE_FORMAT_GRAY) ImageKernels::Shl8To16(Row(src, 0, y + j), rows.pY[j], width, 2);
+				else Shr16((const uint16_t *) Row(src, 0, y + j), rows.pY[j], width, P010_SHIFT);
+				Fill(rows.pU[j], NEUTRAL_CHROMA_10BIT, width);
+				Fill(rows.pV[j], NEUTRAL_CHROMA_10BIT, width);
+			}
+			return;
+		case IMAGE_FORMAT_I444:
+			for (int j = 0; j < 2; ++j)
+			{
+				ImageKernels::Shl8To16(Row(src, 0, y + j), rows.pY[j], width, 2);
+				ImageKernels::Shl8To16(Row(src, 1, y + j), rows.pU[j], width, 2);
+				ImageKernels::Shl8To16(Row(src, 2, y + j), rows.pV[j], width, 2);
+			}
+			return;
+		case IMAGE_FORMAT_YUYV:
+			for (int j = 0; j < 2; ++j)
+			{
+				const uint8_t *p = Row(src, 0, y + j);
+				for (int x = 0; x < chromaW; ++x, p += 4)
+				{
+					rows.pY[j][x * 2] = (uint16_t) (p[0] << 2);
+					rows.pY[j][x * 2 + 1] = (uint16_t) (p[2] << 2);
+					rows.pU[j][x * 2] = rows.pU[j][x * 2 + 1] = (uint16_t) (p[1] << 2);
+					rows.pV[j][x * 2] = rows.pV[j][x * 2 + 1] = (uint16_t) (p[3] << 2);
+				}
+			}
+			return;
+		case IMAGE_FORMAT_NV21:
+		case IMAGE_FORMAT_NV12:
+		case IMAGE_FORMAT_I420:
+		{
+			for (int j = 0; j < 2; ++j)
+			{
+				ImageKernels::Shl8To16(Row(src, 0, y + j), rows.pY[j], width, 2);
+			}
+			if (format == IMAGE_FORMAT_I420)
+			{
+				ExpandChroma8(Row(src, 1, y / 2), 1, rows.pU[0], chromaW);
+				ExpandChroma8(Row(src, 2, y / 2), 1, rows.pV[0], chromaW);
+			}
+			else
+			{
+				const uint8_t *pUV = Row(src, 1, y / 2);
+				int uIndex = format == IMAGE_FORMAT_NV12 ? 0 : 1;
+				ExpandChroma8(pUV + uIndex, 2, rows.pU[0], chromaW);
+				ExpandChroma8(pUV + 1 - uIndex, 2, rows.pV[0], chromaW);
+			}
+			memcpy(rows.pU[1], rows.pU[0], width * sizeof(uint16_t));
+			memcpy(rows.pV[1], rows.pV[0], width * sizeof(uint16_t));
+			return;
+		}
+		case IMAGE_FORMAT_P010:
+		{
+			for (int j = 0; j < 2; ++j)
+			{
+				Shr16((const uint16_t *) Row(src, 0, y + j), rows.pY[j], width, P010_SHIFT);
+			}
+			const uint16_t *pVU = (const uint16_t *) Row(src, 1, y / 2);
+			ExpandChroma16(pVU, rows.pV[0], chromaW);
+			ExpandChroma16(pVU + 1, rows.pU[0], chromaW);
+			memcpy(rows.pU[1], rows.pU[0], width * sizeof(uint16_t));
+			memcpy(rows.pV[1], rows.pV[0], width * sizeof(uint16_t));
+			return;
+		}
+		default:
+			return;
+	}
+}
+
+// 2x2 块色度均值，返回 10bit
+static inline int AverageChroma(const uint16_t *const *ppRows, int x)
+{
+	return ppRows[0][x * 2] + ppRows[0][x * 2 + 1] + ppRows[1][x * 2] + ppRows[1][x * 2 + 1];
+}
+
+// 把第 y、y + 1 行的 10bit YUV444 编码为目标格式
+static void EncodeRows(int format, const PlaneLayout &dst, int width, int y, const YuvRowPair &rows)
+{
+	int chromaW = width / 2;
+	switch (format)
+	{
+		case IMAGE_FORMAT_RGBA:
+			for (int j = 0; j < 2; ++j)
+			{
+				ImageKernels::Yuv10ToRgba(rows.pY[j], rows.pU[j], rows.pV[j], Row(dst, 0, y + j), width);
+			}
+			return;
+		case IMAGE_FORMAT_GRAY:
+			for (int j = 0; j < 2; ++j)
+			{
+				ImageKernels::Round16To8(rows.pY[j], Row(dst, 0, y + j), width, 2);
+			}
+			return;
+		case IMAGE_FORMAT_GRAY10:
+			for (int j = 0; j < 2; ++j)
+			{
+				Shl16(rows.pY[j], (uint16_t *) Row(dst, 0, y + j), width, P010_SHIFT);
+			}
+			return;
+		case IMAGE_FORMAT_I444:
+			for (int j = 0; j < 2; ++j)
+			{
+				ImageKernels::Round16To8(rows.pY[j], Row(dst, 0, y + j), width, 2);
+				ImageKernels::Round16To8(rows.pU[j], Row(dst, 1, y + j), width, 2);
+				ImageKernels::Round16To8(rows.pV[j], Row(dst, 2, y + j), width, 2);
+			}
+			return;
+		case IMAGE_FORMAT_YUYV:
+			for (int j = 0; j < 2; ++j)
+			{
+				uint8_t *p = Row(dst, 0, y + j);
+				const uint16_t *pY = rows.pY[j], *pU = rows.pU[j], *pV = rows.pV[j];
+				for (int x = 0; x < chromaW; ++x, p += 4)
+				{
+					p[0] = Clamp8((pY[x * 2] + 2) >> 2);
+					p[1] = Clamp8((pU[x * 2] + pU[x * 2 + 1] + 4) >> 3);
+					p[2] = Clamp8((pY[x * 2 + 1] + 2) >> 2);
+					p[3] = Clamp8((pV[x * 2] + pV[x * 2 + 1] + 4) >> 3);
+				}
+			}
+			return;
+		case IMAGE_FORMAT_NV21:
+		case IMAGE_FORMAT_NV12:
+		case IMAGE_FORMAT_I420:
+		{
+			for (int j = 0; j < 2; ++j)
+			{
+				ImageKernels::Round16To8(rows.pY[j], Row(dst, 0, y + j), width, 2);
+			}
+			if (format == IMAGE_FORMAT_I420)
+			{
+				uint8_t *pU = Row(dst, 1, y / 2), *pV = Row(dst, 2, y / 2);
+				for (int x = 0; x < chromaW; ++x)
+				{
+					pU[x] = Clamp8((AverageChroma(rows.pU, x) + 8) >> 4);
+					pV[x] = Clamp8((AverageChroma(rows.pV, x) + 8) >> 4);
+				}
+			}
+			else
+			{
+				uint8_t *pUV = Row(dst, 1, y / 2);
+				int uIndex = format == IMAGE_FORMAT_NV12 ? 0 : 1;
+				for (int x = 0; x < chromaW; ++x)
+				{
+					pUV[x * 2 + uIndex] = Clamp8((AverageChroma(rows.pU, x) + 8) >> 4);
+					pUV[x * 2 + 1 - uIndex] = Clamp8((AverageChroma(rows.pV, x) + 8) >> 4);
+				}
+			}
+			return;
+		}
+		case IMAGE_FORMAT_P010:
+		{
+			for (int j = 0; j < 2; ++j)
+			{
+				Shl16(rows.pY[j], (uint16_t *) Row(dst, 0, y + j), width, P010_SHIFT);
+			}
+			uint16_t *pVU = (uint16_t *) Row(dst, 1, y / 2);
+			for (int x = 0; x < chromaW; ++x)
+			{
+				pVU[x * 2] = (uint16_t) (Clamp10((AverageChroma(rows.pV, x) + 2) >> 2) << P010_SHIFT);
+				pVU[x * 2 + 1] = (uint16_t) (Clamp10((AverageChroma(rows.pU, x) + 2) >> 2) << P010_SHIFT);
+			}
+			return;
+		}
+		default:
+			return;
+	}
+}
+
+// 同格式时按行对拷贝 [pairBegin, pairEnd) 覆盖的各平面行
+static void CopyRowPairs(const NativeImage *pImage, const PlaneLayout &src, const PlaneLayout &dst, int pairBegin, int pairEnd)
+{
+	int pairCount = pImage->height / 2;
+	for (int i = 0; i < NativeImageUtil::GetPlaneCount(pImage->format); ++i)
+	{
+		int planeHeight = NativeImageUtil::GetPlaneHeight(pImage->format, pImage->height, i);
+		int rowBegin = pairBegin * planeHeight / pairCount;
+		int rowEnd = pairEnd * planeHeight / pairCount;
+		NativeImageUtil::CopyPlane(Row(src, i, rowBegin), src.lineSize[i], Row(dst, i, rowBegin), dst.lineSize[i],
+								   NativeImageUtil::GetPlaneRowBytes(pImage->format, pImage->width, i), rowEnd - rowBegin);
+	}
+}
+
+bool ImageConverter::IsSupported(int format)
+{
+	return NativeImageUtil::GetPlaneCount(format) > 0;
+}
+
+int ImageConverter::Convert(const NativeImage *pSrc, NativeImage *pDst)
+{
+	if (pSrc == nullptr || pDst == nullptr || pSrc->ppPlane[0] == nullptr
+		|| !IsSupported(pSrc->format) || !IsSupported(pDst->format))
+	{
+		LOGCATE("ImageConverter::Convert invalid image or unsupported format");
+		return -1;
+	}
+	if (pSrc->width != pDst->width || pSrc->height != pDst->height
+		|| pSrc->width <= 0 || pSrc->height <= 0 || pSrc->width % 2 != 0 || pSrc->height % 2 != 0)
+	{
+		LOGCATE("ImageConverter::Convert size mismatch or odd size, src=%dx%d, dst=%dx%d",
+				pSrc->width, pSrc->height, pDst->width, pDst->height);
+		return -1;
+	}
+	if (pDst->ppPlane[0] == nullptr)
+	{
+		NativeImageUtil::AllocNativeImage(pDst);
+		if (pDst->ppPlane[0] == nullptr) return -1;
+	}
+
+	TRACE_SCOPE("ImageConverter::Convert");
+	PlaneLayout src, dst;
+	ResolvePlanes(pSrc, src);
+	ResolvePlanes(pDst, dst);
+	int width = pSrc->width;
+	int srcFormat = pSrc->format, dstFormat = pDst->format;
+
+	ThreadPool::GetInstance()->ParallelFor(pSrc->height / 2, IMAGE_CONVERT_GRAIN_ROW_PAIRS, [&](int pairBegin, int pairEnd) {
+		if (srcFormat == dstFormat)
+		{
+			CopyRowPairs(pSrc, src, dst, pairBegin, pairEnd);
+			return;
+		}
+		std::vector<uint16_t> buffer((size_t) width * 6);
+		YuvRowPair rows;
+		for (int j = 0; j < 2; ++j)
+		{
+			rows.pY[j] = buffer.data() + width * j;
+			rows.pU[j] = buffer.data() + width * (2 + j);
+			rows.pV[j] = buffer.data() + width * (4 + j);
+		}
+		for (int pair = pairBegin; pair < pairEnd; ++pair)
+		{
+			DecodeRows(srcFormat, src, width, pair * 2, rows);
+			EncodeRows(dstFormat, dst, width, pair * 2, rows);
+		}
+	});
+	return 0;
+}
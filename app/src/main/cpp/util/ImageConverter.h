@@ -0,0 +1,30 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_IMAGECONVERTER_H
+#define NDK_OPENGLES_3_0_IMAGECONVERTER_H
+
+#include "ImageDef.h"
+
+// 每个并行段至少包含的行对数，过小时线程调度的开销超过转换本身
+#define IMAGE_CONVERT_GRAIN_ROW_PAIRS 8
+
+/**
+ * CPU 上的图像格式转换矩阵，支持 RGBA、NV21、NV12、I420、I444、YUYV、P010、GRAY、GRAY10 之间任意互转。
+ * 每次处理一对行：先解码为 10bit 的 YUV444 中间行，再编码为目标格式；色度上采样取最近的样本，下采样取像素块均值，
+ * 因此色度分辨率和位深不降低的 YUV 互转可以无损往返。RGB 与 YUV 之间按 BT.601 TV range，与 RGB2* / Render* 样例的着色器一致，
+ * GRAY、GRAY10 视为只有亮度平面、色度为 128 的 YUV。P010 的色度与 NV21 一样 V 在前。
+ * 行对按段分配到 ThreadPool 上并行执行，逐像素运算使用 ImageKernels 的 SIMD 实现。
+ */
+class ImageConverter
+{
+public:
+	static bool IsSupported(int format);
+
+	// 转换为 pDst->format，宽高需与 pSrc 一致且为偶数；pDst->ppPlane[0] 为空时按紧凑布局分配，由调用方 FreeNativeImage
+	// 成功返回 0，失败返回 -1
+	static int Convert(const NativeImage *pSrc, NativeImage *pDst);
+};
+
+#endif //NDK_OPENGLES_3_0_IMAGECONVERTER_H
@@ -16,6 +16,8 @@
 #include "sys/stat.h"
 #include "stdint.h"
 #include "LogUtil.h"
+#include "ImageKernels.h"
+#include "ImageBufferPool.h"
 
 #define IMAGE_FORMAT_RGBA           0x01
 #define IMAGE_FORMAT_NV21           0x02
@@ -65,6 +67,10 @@ struct NativeImage
 	int height;
 	int format;
 	uint8_t *ppPlane[3];
+	int pLineSize[3]; //每个平面一行所占字节数（含行尾填充），0 表示紧凑排列
+	//AllocNativeImage 从内存池借出的内存，只有一个所有者：结构体拷贝不增加引用，
+	//拷贝出的 NativeImage 只能借用数据，只对原图调用 FreeNativeImage，否则同一块内存会被释放两次
+	ImageBuffer *pBuffer;
 
 	NativeImage()
 	{
@@ -74,74 +80,180 @@ struct NativeImage
 		ppPlane[0] = nullptr;
 		ppPlane[1] = nullptr;
 		ppPlane[2] = nullptr;
+		pLineSize[0] = 0;
+		pLineSize[1] = 0;
+		pLineSize[2] = 0;
+		pBuffer = nullptr;
 	}
 };
 
 class NativeImageUtil
 {
 public:
-	static void AllocNativeImage(NativeImage *pImage)
+	static int GetPlaneCount(int format)
 	{
-		if (pImage->height == 0 || pImage->width == 0) return;
-
-		switch (pImage->format)
+		switch (format)
 		{
 			case IMAGE_FORMAT_RGBA:
-			{
-				pImage->ppPlane[0] = static_cast<uint8_t *>(malloc(pImage->width * pImage->height * 4));
-			}
-				break;
 			case IMAGE_FORMAT_YUYV:
-			{
-				pImage->ppPlane[0] = static_cast<uint8_t *>(malloc(pImage->width * pImage->height * 2));
-			}
-				break;
+			case IMAGE_FORMAT_GRAY:
+			case IMAGE_FORMAT_GRAY10:
+				return 1;
 			case IMAGE_FORMAT_NV12:
 			case IMAGE_FORMAT_NV21:
-			{
-				pImage->ppPlane[0] = static_cast<uint8_t *>(malloc(pImage->width * pImage->height * 1.5));
-				pImage->ppPlane[1] = pImage->ppPlane[0] + pImage->width * pImage->height;
-			}
-				break;
+			case IMAGE_FORMAT_P010:
+				return 2;
 			case IMAGE_FORMAT_I420:
-			{
-				pImage->ppPlane[0] = static_cast<uint8_t *>(malloc(pImage->width * pImage->height * 1.5));
-				pImage->ppPlane[1] = pImage->ppPlane[0] + pImage->width * pImage->height;
-				pImage->ppPlane[2] = pImage->ppPlane[1] + pImage->width * (pImage->height >> 2);
-			}
-				break;
+			case IMAGE_FORMAT_I444:
+				return 3;
+			default:
+				return 0;
+		}
+	}
+
+	//平面一行有效像素所占的字节数（不含填充）
+	static int GetPlaneRowBytes(int format, int width, int plane)
+	{
+		switch (format)
+		{
+			case IMAGE_FORMAT_RGBA:
+				return width * 4;
+			case IMAGE_FORMAT_YUYV:
+			case IMAGE_FORMAT_GRAY10:
+			case IMAGE_FORMAT_P010:
+				return width * 2;
 			case IMAGE_FORMAT_GRAY:
-			{
-				pImage->ppPlane[0] = static_cast<uint8_t *>(malloc(pImage->width * pImage->height));
-			}
-				break;
+			case IMAGE_FORMAT_NV12:
+			case IMAGE_FORMAT_NV21:
 			case IMAGE_FORMAT_I444:
-			{
-				pImage->ppPlane[0] = static_cast<uint8_t *>(malloc(pImage->width * pImage->height * 3));
-			}
-				break;
+				return width;
+			case IMAGE_FORMAT_I420:
+				return plane == 0 ? width : width >> 1;
+			default:
+				return 0;
+		}
+	}
+
+	static int GetPlaneHeight(int format, int height, int plane)
+	{
+		switch (format)
+		{
+			case IMAGE_FORMAT_NV12:
+			case IMAGE_FORMAT_NV21:
 			case IMAGE_FORMAT_P010:
+			case IMAGE_FORMAT_I420:
+				return plane == 0 ? height : height >> 1;
+			default:
+				return height;
+		}
+	}
+
+	static int GetLineSize(const NativeImage *pImage, int plane)
+	{
+		if (pImage->pLineSize[plane] > 0) return pImage->pLineSize[plane];
+		return GetPlaneRowBytes(pImage->format, pImage->width, plane);
+	}
+
+	//平面占用的字节数，最后一行不要求包含行尾填充
+	static int GetPlaneSize(const NativeImage *pImage, int plane)
+	{
+		int planeHeight = GetPlaneHeight(pImage->format, pImage->height, plane);
+		if (planeHeight <= 0) return 0;
+		return GetLineSize(pImage, plane) * (planeHeight - 1) + GetPlaneRowBytes(pImage->format, pImage->width, plane);
+	}
+
+	//所有平面无行尾填充且首尾相连，可以作为一整块内存处理
+	static bool IsPacked(const NativeImage *pImage)
+	{
+		int planeCount = GetPlaneCount(pImage->format);
+		for (int i = 0; i < planeCount; ++i)
+		{
+			if (GetLineSize(pImage, i) != GetPlaneRowBytes(pImage->format, pImage->width, i)) return false;
+			//只设置了 ppPlane[0] 的图像按首尾相连处理
+			if (i > 0 && pImage->ppPlane[i] != nullptr
+				&& pImage->ppPlane[i] != pImage->ppPlane[i - 1] + GetPlaneSize(pImage, i - 1)) return false;
+		}
+		return true;
+	}
+
+	//紧凑排列时整幅图像的字节数
+	static int GetPackedSize(int format, int width, int height)
+	{
+		int size = 0;
+		int planeCount = GetPlaneCount(format);
+		for (int i = 0; i < planeCount; ++i)
+		{
+			size += GetPlaneRowBytes(format, width, i) * GetPlaneHeight(format, height, i);
+		}
+		return size;
+	}
+
+	/**
+	 * 按行跨度和平面偏移量把一块连续内存映射到 NativeImage，不拷贝数据
+	 * pLineSize 为 nullptr 时按紧凑排列，pOffset 为 nullptr 时平面首尾相连
+	 */
+	static void AttachNativeImage(NativeImage *pImage, uint8_t *pData, const int *pLineSize = nullptr, const int *pOffset = nullptr)
+	{
+		int planeCount = GetPlaneCount(pImage->format);
+		if (planeCount == 0) planeCount = 1;
+		int offset = 0;
+		for (int i = 0; i < 3; ++i)
+		{
+			if (i >= planeCount)
 			{
-				pImage->ppPlane[0] = static_cast<uint8_t *>(malloc(pImage->width * pImage->height * 3));
-				pImage->ppPlane[1] = pImage->ppPlane[0] + pImage->width * pImage->height * 2;
-			}
-				break;
-			case IMAGE_FORMAT_GRAY10:
-			{
-				pImage->ppPlane[0] = static_cast<uint8_t *>(malloc(pImage->width * pImage->height * 2));
+				pImage->ppPlane[i] = nullptr;
+				pImage->pLineSize[i] = 0;
+				continue;
 			}
-				break;
-			default:
-				LOGCATE("NativeImageUtil::AllocNativeImage do not support the format. Format = %d", pImage->format);
-				break;
+			pImage->pLineSize[i] = pLineSize != nullptr && pLineSize[i] > 0 ? pLineSize[i] : GetPlaneRowBytes(pImage->format, pImage->width, i);
+			if (pOffset != nullptr) offset = pOffset[i];
+			pImage->ppPlane[i] = pData + offset;
+			offset += pImage->pLineSize[i] * GetPlaneHeight(pImage->format, pImage->height, i);
+		}
+	}
+
+	/**
+	 * 分配图像内存，pLineSize 预先设置时按给定行跨度分配，否则紧凑排列
+	 * 内存从 ImageBufferPool 借出，首地址 64 字节对齐，FreeNativeImage 时归还
+	 */
+	static void AllocNativeImage(NativeImage *pImage)
+	{
+		if (pImage->height == 0 || pImage->width == 0) return;
+
+		int planeCount = GetPlaneCount(pImage->format);
+		if (planeCount == 0)
+		{
+			LOGCATE("NativeImageUtil::AllocNativeImage do not support the format. Format = %d", pImage->format);
+			return;
+		}
+
+		int lineSize[3] = {0};
+		size_t totalSize = 0;
+		for (int i = 0; i < planeCount; ++i)
+		{
+			lineSize[i] = GetLineSize(pImage, i);
+			totalSize += static_cast<size_t>(lineSize[i]) * GetPlaneHeight(pImage->format, pImage->height, i);
 		}
+
+		ImageBuffer *pBuffer = ImageBufferPool::GetInstance()->Acquire(totalSize);
+		if (pBuffer == nullptr) return;
+		pImage->pBuffer = pBuffer;
+		AttachNativeImage(pImage, pBuffer->GetData(), lineSize);
 	}
 
 	static void FreeNativeImage(NativeImage *pImage)
 	{
 		if (pImage == nullptr || pImage->ppPlane[0] == nullptr) return;
 
-		free(pImage->ppPlane[0]);
+		if (pImage->pBuffer != nullptr && pImage->pBuffer->GetData() == pImage->ppPlane[0])
+		{
+			pImage->pBuffer->Release();
+		}
+		else
+		{
+			free(pImage->ppPlane[0]);
+		}
+		pImage->pBuffer = nullptr;
 		pImage->ppPlane[0] = nullptr;
 		pImage->ppPlane[1] = nullptr;
 		pImage->ppPlane[2] = nullptr;
@@ -157,48 +269,41 @@ public:
 
 		if(pDstImg->ppPlane[0] == nullptr) AllocNativeImage(pDstImg);
 
-		switch (pSrcImg->format)
+		int planeCount = GetPlaneCount(pSrcImg->format);
+		if (planeCount == 0)
 		{
-			case IMAGE_FORMAT_I420:
-			case IMAGE_FORMAT_NV21:
-			case IMAGE_FORMAT_NV12:
-			{
-				memcpy(pDstImg->ppPlane[0], pSrcImg->ppPlane[0], pSrcImg->width * pSrcImg->height * 1.5);
-			}
-				break;
-			case IMAGE_FORMAT_YUYV:
-			{
-				memcpy(pDstImg->ppPlane[0], pSrcImg->ppPlane[0], pSrcImg->width * pSrcImg->height * 2);
-			}
-				break;
-			case IMAGE_FORMAT_RGBA:
-			{
-				memcpy(pDstImg->ppPlane[0], pSrcImg->ppPlane[0], pSrcImg->width * pSrcImg->height * 4);
-			}
-				break;
-			case IMAGE_FORMAT_GRAY:
-			{
-				memcpy(pDstImg->ppPlane[0], pSrcImg->ppPlane[0], pSrcImg->width * pSrcImg->height);
-			}
-				break;
-			case IMAGE_FORMAT_P010:
-			case IMAGE_FORMAT_I444:
-			{
-				memcpy(pDstImg->ppPlane[0], pSrcImg->ppPlane[0], pSrcImg->width * pSrcImg->height * 3);
-			}
-				break;
-			case IMAGE_FORMAT_GRAY10:
-			{
-				memcpy(pDstImg->ppPlane[0], pSrcImg->ppPlane[0], pSrcImg->width * pSrcImg->height * 2);
-			}
-				break;
-			default:
-			{
-				LOGCATE("NativeImageUtil::CopyNativeImage do not support the format. Format = %d", pSrcImg->format);
-			}
-				break;
+			LOGCATE("NativeImageUtil::CopyNativeImage do not support the format. Format = %d", pSrcImg->format);
+			return;
+		}
+
+		if (IsPacked(pSrcImg) && IsPacked(pDstImg))
+		{
+			memcpy(pDstImg->ppPlane[0], pSrcImg->ppPlane[0], GetPackedSize(pSrcImg->format, pSrcImg->width, pSrcImg->height));
+			return;
+		}
+
+		for (int i = 0; i < planeCount; ++i)
+		{
+			CopyPlane(pSrcImg->ppPlane[i], GetLineSize(pSrcImg, i),
+					  pDstImg->ppPlane[i], GetLineSize(pDstImg, i),
+					  GetPlaneRowBytes(pSrcImg->format, pSrcImg->width, i),
+					  GetPlaneHeight(pSrcImg->format, pSrcImg->height, i));
+		}
+	}
+
+	static void CopyPlane(const uint8_t *pSrc, int srcLineSize, uint8_t *pDst, int dstLineSize, int rowBytes, int rows)
+	{
+		if (rows <= 0) return;
+		if (srcLineSize == dstLineSize)
+		{
+			memcpy(pDst, pSrc, static_cast<size_t>(srcLineSize) * (rows - 1) + rowBytes);
+			return;
 		}
 
+		for (int i = 0; i < rows; ++i)
+		{
+			memcpy(pDst + dstLineSize * i, pSrc + srcLineSize * i, rowBytes);
+		}
 	}
 
 	static void DumpNativeImage(NativeImage *pSrcImg, const char *pPath, const char *pFileName)
@@ -254,73 +359,28 @@ public:
 
 		if(fp)
 		{
-			switch (pSrcImg->format)
+			int planeCount = GetPlaneCount(pSrcImg->format);
+			if (planeCount == 0)
 			{
-				case IMAGE_FORMAT_I420:
-				{
-					fwrite(pSrcImg->ppPlane[0],
-						   static_cast<size_t>(pSrcImg->width * pSrcImg->height), 1, fp);
-					fwrite(pSrcImg->ppPlane[1],
-						   static_cast<size_t>((pSrcImg->width >> 1) * (pSrcImg->height >> 1)), 1, fp);
-					fwrite(pSrcImg->ppPlane[2],
-							static_cast<size_t>((pSrcImg->width >> 1) * (pSrcImg->height >> 1)),1,fp);
-					break;
-				}
-				case IMAGE_FORMAT_NV21:
-				case IMAGE_FORMAT_NV12:
-				{
-					fwrite(pSrcImg->ppPlane[0],
-						   static_cast<size_t>(pSrcImg->width * pSrcImg->height), 1, fp);
-					fwrite(pSrcImg->ppPlane[1],
-						   static_cast<size_t>(pSrcImg->width * (pSrcImg->height >> 1)), 1, fp);
-					break;
-				}
-				case IMAGE_FORMAT_RGBA:
-				{
-					fwrite(pSrcImg->ppPlane[0],
-						   static_cast<size_t>(pSrcImg->width * pSrcImg->height * 4), 1, fp);
-					break;
-				}
-				case IMAGE_FORMAT_YUYV:
-				{
-					fwrite(pSrcImg->ppPlane[0],
-						   static_cast<size_t>(pSrcImg->width * pSrcImg->height * 2), 1, fp);
-					break;
-				}
-				case IMAGE_FORMAT_GRAY:
-				{
-					fwrite(pSrcImg->ppPlane[0],
-						   static_cast<size_t>(pSrcImg->width * pSrcImg->height), 1, fp);
-					break;
-				}
-				case IMAGE_FORMAT_P010:
-				{
-					fwrite(pSrcImg->ppPlane[0],
-						   static_cast<size_t>(pSrcImg->width * pSrcImg->height * 3), 1, fp);
-					break;
-				}
-				case IMAGE_FORMAT_I444:
-				{
-					fwrite(pSrcImg->ppPlane[0],
-						   static_cast<size_t>(pSrcImg->width * pSrcImg->height), 1, fp);
-					fwrite(pSrcImg->ppPlane[1],
-						   static_cast<size_t>(pSrcImg->width * pSrcImg->height), 1, fp);
-					fwrite(pSrcImg->ppPlane[2],
-						   static_cast<size_t>(pSrcImg->width * pSrcImg->height), 1, fp);
-					break;
-				}
-				case IMAGE_FORMAT_GRAY10:
+				fwrite(pSrcImg->ppPlane[0],
+					   static_cast<size_t>(pSrcImg->width * pSrcImg->height), 1, fp);
+				LOGCATE("DumpNativeImage default");
+			}
+
+			//文件中的数据总是紧凑排列
+			for (int i = 0; i < planeCount; ++i)
+			{
+				int rowBytes = GetPlaneRowBytes(pSrcImg->format, pSrcImg->width, i);
+				int rows = GetPlaneHeight(pSrcImg->format, pSrcImg->height, i);
+				int lineSize = GetLineSize(pSrcImg, i);
+				if (lineSize == rowBytes)
 				{
-					fwrite(pSrcImg->ppPlane[0],
-						   static_cast<size_t>(pSrcImg->width * pSrcImg->height * 2), 1, fp);
-					break;
+					fwrite(pSrcImg->ppPlane[i], static_cast<size_t>(rowBytes * rows), 1, fp);
+					continue;
 				}
-				default:
+				for (int j = 0; j < rows; ++j)
 				{
-					fwrite(pSrcImg->ppPlane[0],
-						   static_cast<size_t>(pSrcImg->width * pSrcImg->height), 1, fp);
-					LOGCATE("DumpNativeImage default");
-					break;
+					fwrite(pSrcImg->ppPlane[i] + lineSize * j, static_cast<size_t>(rowBytes), 1, fp);
 				}
 			}
 
@@ -335,54 +395,28 @@ public:
 
 		FILE *fp = fopen(pPath, "rb");
 		LOGCATE("LoadNativeImage fp=%p, file=%s", fp, pPath);
-		int dataSize = 0;
 		if(fp)
 		{
-			switch (pSrcImg->format)
+			int planeCount = GetPlaneCount(pSrcImg->format);
+			if (planeCount == 0)
 			{
-				case IMAGE_FORMAT_I420:
-				case IMAGE_FORMAT_NV21:
-				case IMAGE_FORMAT_NV12:
-				{
-					dataSize = pSrcImg->width * pSrcImg->height * 1.5;
-					fread(pSrcImg->ppPlane[0], dataSize, 1, fp);
-					break;
-				}
-				case IMAGE_FORMAT_RGBA:
-				{
-					dataSize = pSrcImg->width * pSrcImg->height * 4;
-					fread(pSrcImg->ppPlane[0], dataSize, 1, fp);
-					break;
-				}
-				case IMAGE_FORMAT_YUYV:
-				{
-					dataSize = pSrcImg->width * pSrcImg->height * 2;
-					fread(pSrcImg->ppPlane[0], dataSize, 1, fp);
-					break;
-				}
-				case IMAGE_FORMAT_GRAY:
-				{
-					dataSize = pSrcImg->width * pSrcImg->height;
-					fread(pSrcImg->ppPlane[0], dataSize, 1, fp);
-					break;
-				}
-				case IMAGE_FORMAT_P010:
-				case IMAGE_FORMAT_I444:
-				{
-					dataSize = pSrcImg->width * pSrcImg->height * 3;
-					fread(pSrcImg->ppPlane[0], dataSize, 1, fp);
-					break;
-				}
-				case IMAGE_FORMAT_GRAY10:
+				LOGCATE("LoadNativeImage not support the format %d.", pSrcImg->format);
+			}
+
+			//文件中的数据紧凑排列，按目标图像的行跨度读入
+			for (int i = 0; i < planeCount; ++i)
+			{
+				int rowBytes = GetPlaneRowBytes(pSrcImg->format, pSrcImg->width, i);
+				int rows = GetPlaneHeight(pSrcImg->format, pSrcImg->height, i);
+				int lineSize = GetLineSize(pSrcImg, i);
+				if (lineSize == rowBytes)
 				{
-					dataSize = pSrcImg->width * pSrcImg->height * 2;
-					fread(pSrcImg->ppPlane[0], dataSize, 1, fp);
-					break;
+					fread(pSrcImg->ppPlane[i], static_cast<size_t>(rowBytes * rows), 1, fp);
+					continue;
 				}
-				default:
+				for (int j = 0; j < rows; ++j)
 				{
-					LOGCATE("LoadNativeImage not support the format %d.", pSrcImg->format);
-					break;
+					fread(pSrcImg->ppPlane[i] + lineSize * j, static_cast<size_t>(rowBytes), 1, fp);
 				}
 			}
 
@@ -398,22 +432,21 @@ public:
 		|| pNV21Img->format != IMAGE_FORMAT_NV21) return -1;
 
 		int width = pP010Img->width, height = pP010Img->height;
+		int p010LineSize[2] = {GetLineSize(pP010Img, 0), GetLineSize(pP010Img, 1)};
+		int nv21LineSize[2] = {GetLineSize(pNV21Img, 0), GetLineSize(pNV21Img, 1)};
 		for (int i = 0; i < height; ++i) {
-			uint16_t *pu16YData = (uint16_t *)(pP010Img->ppPlane[0] + pP010Img->width * 2 * i);
-			uint8_t  *pu8YData = pNV21Img->ppPlane[0] + pNV21Img->width * i;
-			for (int j = 0; j < width; j++, pu8YData++, pu16YData++) {
-				*pu8YData = (u_int8_t)(*pu16YData >> 8);
-			}
+			uint16_t *pu16YData = (uint16_t *)(pP010Img->ppPlane[0] + p010LineSize[0] * i);
+			uint8_t  *pu8YData = pNV21Img->ppPlane[0] + nv21LineSize[0] * i;
+			ImageKernels::Shr16To8(pu16YData, pu8YData, width);
 		}
 
-		width /= 2; height /= 2;
+		//UV 交错存储，一行共 (width / 2) * 2 个分量
+		int uvCount = (width / 2) * 2;
+		height /= 2;
 		for (int i = 0; i < height; ++i) {
-			uint16_t *pu16UVData = (uint16_t *)(pP010Img->ppPlane[1] + pP010Img->width * 2 * i);
-			uint8_t  *pu8UVData = pNV21Img->ppPlane[1] + pNV21Img->width * i;
-			for (int j = 0; j < width; ++j, pu8UVData+=2, pu16UVData+=2) {
-				*pu8UVData = *pu16UVData >> 8;
-				*(pu8UVData + 1) = *(pu16UVData + 1) >> 8;
-			}
+			uint16_t *pu16UVData = (uint16_t *)(pP010Img->ppPlane[1] + p010LineSize[1] * i);
+			uint8_t  *pu8UVData = pNV21Img->ppPlane[1] + nv21LineSize[1] * i;
+			ImageKernels::Shr16To8(pu16UVData, pu8UVData, uvCount);
 		}
 		return 0;
 	}
@@ -425,11 +458,7 @@ public:
 		   || height <= 0) return;
 
 		for (int i = 0; i < height; ++i) {
-			uint16_t *pu16YData = pSrcData + width * i;
-			uint8_t  *pu8YData = pDstData + width * i;
-			for (int j = 0; j < width; j++, pu8YData++, pu16YData++) {
-				*pu8YData = (u_int8_t)(*pu16YData >> 8);
-			}
+			ImageKernels::Shr16To8(pSrcData + width * i, pDstData + width * i, width);
 		}
 	}
 
@@ -440,22 +469,20 @@ public:
 		   || pNV21Img->format != IMAGE_FORMAT_NV21) return -1;
 
 		int width = pP010Img->width, height = pP010Img->height;
+		int p010LineSize[2] = {GetLineSize(pP010Img, 0), GetLineSize(pP010Img, 1)};
+		int nv21LineSize[2] = {GetLineSize(pNV21Img, 0), GetLineSize(pNV21Img, 1)};
 		for (int i = 0; i < height; ++i) {
-			uint16_t *pu16YData = (uint16_t *)(pP010Img->ppPlane[0] + pP010Img->width * 2 * i);
-			uint8_t  *pu8YData = pNV21Img->ppPlane[0] + pNV21Img->width * i;
-			for (int j = 0; j < width; j++, pu8YData++, pu16YData++) {
-				*pu16YData = (u_int16_t)*pu8YData << 6;
-			}
+			uint16_t *pu16YData = (uint16_t *)(pP010Img->ppPlane[0] + p010LineSize[0] * i);
+			uint8_t  *pu8YData = pNV21Img->ppPlane[0] + nv21LineSize[0] * i;
+			ImageKernels::Shl8To16(pu8YData, pu16YData, width, 6);
 		}
 
-		width /= 2; height /= 2;
+		int uvCount = (width / 2) * 2;
+		height /= 2;
 		for (int i = 0; i < height; ++i) {
-			uint16_t *pu16UVData = (uint16_t *)(pP010Img->ppPlane[1] + pP010Img->width * 2 * i);
-			uint8_t  *pu8UVData = pNV21Img->ppPlane[1] + pNV21Img->width * i;
-			for (int j = 0; j < width; ++j, pu8UVData+=2, pu16UVData+=2) {
-				*pu16UVData = (u_int16_t)*pu8UVData << 8;
-				*(pu16UVData + 1) = (u_int16_t)*(pu8UVData + 1) << 8;
-			}
+			uint16_t *pu16UVData = (uint16_t *)(pP010Img->ppPlane[1] + p010LineSize[1] * i);
+			uint8_t  *pu8UVData = pNV21Img->ppPlane[1] + nv21LineSize[1] * i;
+			ImageKernels::Shl8To16(pu8UVData, pu16UVData, uvCount, 8);
 		}
 
 		return 0;
@@ -0,0 +1,396 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "ImageKernels.h"
+
+#if defined(__aarch64__) || (defined(__ARM_NEON) && defined(__arm__))
+#define IMAGE_KERNELS_NEON 1
+#include <arm_neon.h>
+#if defined(__arm__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#elif defined(__SSE2__)
+#define IMAGE_KERNELS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+typedef void (*Shr16To8Func)(const uint16_t *, uint8_t *, int);
+typedef void (*Shl8To16Func)(const uint8_t *, uint16_t *, int, int);
+typedef void (*Round16To8Func)(const uint16_t *, uint8_t *, int, int);
+typedef void (*RgbaToYuv10Func)(const uint8_t *, uint16_t *, uint16_t *, uint16_t *, int);
+typedef void (*Yuv10ToRgbaFunc)(const uint16_t *, const uint16_t *, const uint16_t *, uint8_t *, int);
+
+// RGB 转 YUV：系数乘 256 取整，结果再右移 6 位得到 10bit；偏移量 16.065、128.01 同样乘 256 并加上舍入的 32。
+// U、V 的中间值在 16bit 无符号范围内，SIMD 里按 16bit 回绕运算与标量结果一致
+#define RGB2Y_R 66
+#define RGB2Y_G 129
+#define RGB2Y_B 25
+#define RGB2Y_OFFSET (4113 + 32)
+#define RGB2U_R 38
+#define RGB2U_G 74
+#define RGB2V_G 94
+#define RGB2V_B 18
+#define RGB2UV_MAX 112
+#define RGB2UV_OFFSET (32771 + 32)
+
+// YUV 转 RGB：输入减去偏移后左移 5 位，与乘 2048 的系数相乘取高 16 位得到 10bit 结果，
+// 系数取偶数，NEON 的 vqdmulh 用一半的系数可得到相同结果
+#define YUV2RGB_Y 2384
+#define YUV2RGB_RV 3268
+#define YUV2RGB_GU 802
+#define YUV2RGB_GV 1666
+#define YUV2RGB_BU 4130
+#define YUV2RGB_Y_OFFSET 64
+#define YUV2RGB_UV_OFFSET 512
+
+#if IMAGE_KERNELS_NEON
+static void Shr16To8_NEON(const uint16_t *pSrc, uint8_t *pDst, int count)
+{
+	int i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		uint16x8_t lo = vld1q_u16(pSrc + i);
+		uint16x8_t hi = vld1q_u16(pSrc + i + 8);
+		vst1q_u8(pDst + i, vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+	}
+	ImageKernels::Shr16To8_C(pSrc + i, pDst + i, count - i);
+}
+
+static void Shl8To16_NEON(const uint8_t *pSrc, uint16_t *pDst, int count, int shift)
+{
+	int16x8_t vShift = vdupq_n_s16((int16_t) shift);
+	int i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		uint8x16_t v = vld1q_u8(pSrc + i);
+		vst1q_u16(pDst + i, vshlq_u16(vmovl_u8(vget_low_u8(v)), vShift));
+		vst1q_u16(pDst + i + 8, vshlq_u16(vmovl_u8(vget_high_u8(v)), vShift));
+	}
+	ImageKernels::Shl8To16_C(pSrc + i, pDst + i, count - i, shift);
+}
+
+static void Round16To8_NEON(const uint16_t *pSrc, uint8_t *pDst, int count, int shift)
+{
+	uint16x8_t vHalf = vdupq_n_u16((uint16_t) (1 << (shift - 1)));
+	int16x8_t vShift = vdupq_n_s16((int16_t) -shift);
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		uint16x8_t v = vshlq_u16(vqaddq_u16(vld1q_u16(pSrc + i), vHalf), vShift);
+		vst1_u8(pDst + i, vqmovn_u16(v));
+	}
+	ImageKernels::Round16To8_C(pSrc + i, pDst + i, count - i, shift);
+}
+
+static void RgbaToYuv10_NEON(const uint8_t *pRgba, uint16_t *pY, uint16_t *pU, uint16_t *pV, int count)
+{
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		uint8x8x4_t rgba = vld4_u8(pRgba + i * 4);
+		uint16x8_t y = vmull_u8(rgba.val[0], vdup_n_u8(RGB2Y_R));
+		y = vmlal_u8(y, rgba.val[1], vdup_n_u8(RGB2Y_G));
+		y = vmlal_u8(y, rgba.val[2], vdup_n_u8(RGB2Y_B));
+		vst1q_u16(pY + i, vshrq_n_u16(vaddq_u16(y, vdupq_n_u16(RGB2Y_OFFSET)), 6));
+
+		uint16x8_t u = vmull_u8(rgba.val[2], vdup_n_u8(RGB2UV_MAX));
+		u = vmlsl_u8(u, rgba.val[0], vdup_n_u8(RGB2U_R));
+		u = vmlsl_u8(u, rgba.val[1], vdup_n_u8(RGB2U_G));
+		vst1q_u16(pU + i, vshrq_n_u16(vaddq_u16(u, vdupq_n_u16(RGB2UV_OFFSET)), 6));
+
+		uint16x8_t v = vmull_u8(rgba.val[0], vdup_n_u8(RGB2UV_MAX));
+		v = vmlsl_u8(v, rgba.val[1], vdup_n_u8(RGB2V_G));
+		v = vmlsl_u8(v, rgba.val[2], vdup_n_u8(RGB2V_B));
+		vst1q_u16(pV + i, vshrq_n_u16(vaddq_u16(v, vdupq_n_u16(RGB2UV_OFFSET)), 6));
+	}
+	ImageKernels::RgbaToYuv10_C(pRgba + i * 4, pY + i, pU + i, pV + i, count - i);
+}
+
+static void Yuv10ToRgba_NEON(const uint16_t *pY, const uint16_t *pU, const uint16_t *pV, uint8_t *pRgba, int count)
+{
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		int16x8_t c = vshlq_n_s16(vsubq_s16(vreinterpretq_s16_u16(vld1q_u16(pY + i)), vdupq_n_s16(YUV2RGB_Y_OFFSET)), 5);
+		int16x8_t d = vshlq_n_s16(vsubq_s16(vreinterpretq_s16_u16(vld1q_u16(pU + i)), vdupq_n_s16(YUV2RGB_UV_OFFSET)), 5);
+		int16x8_t e = vshlq_n_s16(vsubq_s16(vreinterpretq_s16_u16(vld1q_u16(pV + i)), vdupq_n_s16(YUV2RGB_UV_OFFSET)), 5);
+		int16x8_t y = vqdmulhq_n_s16(c, YUV2RGB_Y / 2);
+		int16x8_t r = vaddq_s16(y, vqdmulhq_n_s16(e, YUV2RGB_RV / 2));
+		int16x8_t g = vsubq_s16(vsubq_s16(y, vqdmulhq_n_s16(d, YUV2RGB_GU / 2)), vqdmulhq_n_s16(e, YUV2RGB_GV / 2));
+		int16x8_t b = vaddq_s16(y, vqdmulhq_n_s16(d, YUV2RGB_BU / 2));
+		uint8x8x4_t rgba;
+		rgba.val[0] = vqmovun_s16(vrshrq_n_s16(r, 2));
+		rgba.val[1] = vqmovun_s16(vrshrq_n_s16(g, 2));
+		rgba.val[2] = vqmovun_s16(vrshrq_n_s16(b, 2));
+		rgba.val[3] = vdup_n_u8(255);
+		vst4_u8(pRgba + i * 4, rgba);
+	}
+	ImageKernels::Yuv10ToRgba_C(pY + i, pU + i, pV + i, pRgba + i * 4, count - i);
+}
+
+static bool CpuHasSimd()
+{
+#if defined(__aarch64__)
+	return true;
+#else
+	return (getauxval(AT_HWCAP) & HWCAP_NEON) != 0;
+#endif
+}
+
+static const char *SIMD_NAME = "NEON";
+#define Shr16To8_SIMD Shr16To8_NEON
+#define Shl8To16_SIMD Shl8To16_NEON
+#define Round16To8_SIMD Round16To8_NEON
+#define RgbaToYuv10_SIMD RgbaToYuv10_NEON
+#define Yuv10ToRgba_SIMD Yuv10ToRgba_NEON
+
+#elif IMAGE_KERNELS_SSE2
+static void Shr16To8_SSE2(const uint16_t *pSrc, uint8_t *pDst, int count)
+{
+	int i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		__m128i lo = _mm_srli_epi16(_mm_loadu_si128((const __m128i *) (pSrc + i)), 8);
+		__m128i hi = _mm_srli_epi16(_mm_loadu_si128((const __m128i *) (pSrc + i + 8)), 8);
+		_mm_storeu_si128((__m128i *) (pDst + i), _mm_packus_epi16(lo, hi));
+	}
+	ImageKernels::Shr16To8_C(pSrc + i, pDst + i, count - i);
+}
+
+static void Shl8To16_SSE2(const uint8_t *pSrc, uint16_t *pDst, int count, int shift)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i vShift = _mm_cvtsi32_si128(shift);
+	int i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i *) (pSrc + i));
+		_mm_storeu_si128((__m128i *) (pDst + i), _mm_sll_epi16(_mm_unpacklo_epi8(v, zero), vShift));
+		_mm_storeu_si128((__m128i *) (pDst + i + 8), _mm_sll_epi16(_mm_unpackhi_epi8(v, zero), vShift));
+	}
+	ImageKernels::Shl8To16_C(pSrc + i, pDst + i, count - i, shift);
+}
+
+static void Round16To8_SSE2(const uint16_t *pSrc, uint8_t *pDst, int count, int shift)
+{
+	const __m128i vHalf = _mm_set1_epi16((short) (1 << (shift - 1)));
+	const __m128i vShift = _mm_cvtsi32_si128(shift);
+	int i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		// shift >= 1 时右移后不超过 32767，packus 的有符号饱和等同于截到 255
+		__m128i lo = _mm_srl_epi16(_mm_adds_epu16(_mm_loadu_si128((const __m128i *) (pSrc + i)), vHalf), vShift);
+		__m128i hi = _mm_srl_epi16(_mm_adds_epu16(_mm_loadu_si128((const __m128i *) (pSrc + i + 8)), vHalf), vShift);
+		_mm_storeu_si128((__m128i *) (pDst + i), _mm_packus_epi16(lo, hi));
+	}
+	ImageKernels::Round16To8_C(pSrc + i, pDst + i, count - i, shift);
+}
+
+static void RgbaToYuv10_SSE2(const uint8_t *pRgba, uint16_t *pY, uint16_t *pU, uint16_t *pV, int count)
+{
+	const __m128i mask = _mm_set1_epi32(0xFF);
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m128i p0 = _mm_loadu_si128((const __m128i *) (pRgba + i * 4));
+		__m128i p1 = _mm_loadu_si128((const __m128i *) (pRgba + i * 4 + 16));
+		__m128i r = _mm_packs_epi32(_mm_and_si128(p0, mask), _mm_and_si128(p1, mask));
+		__m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 8), mask), _mm_and_si128(_mm_srli_epi32(p1, 8), mask));
+		__m128i b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 16), mask), _mm_and_si128(_mm_srli_epi32(p1, 16), mask));
+
+		__m128i y = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(RGB2Y_R)), _mm_mullo_epi16(g, _mm_set1_epi16(RGB2Y_G)));
+		y = _mm_add_epi16(y, _mm_add_epi16(_mm_mullo_epi16(b, _mm_set1_epi16(RGB2Y_B)), _mm_set1_epi16((short) RGB2Y_OFFSET)));
+		_mm_storeu_si128((__m128i *) (pY + i), _mm_srli_epi16(y, 6));
+
+		__m128i u = _mm_sub_epi16(_mm_mullo_epi16(b, _mm_set1_epi16(RGB2UV_MAX)), _mm_mullo_epi16(r, _mm_set1_epi16(RGB2U_R)));
+		u = _mm_add_epi16(_mm_sub_epi16(u, _mm_mullo_epi16(g, _mm_set1_epi16(RGB2U_G))), _mm_set1_epi16((short) RGB2UV_OFFSET));
+		_mm_storeu_si128((__m128i *) (pU + i), _mm_srli_epi16(u, 6));
+
+		__m128i v = _mm_sub_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(RGB2UV_MAX)), _mm_mullo_epi16(g, _mm_set1_epi16(RGB2V_G)));
+		v = _mm_add_epi16(_mm_sub_epi16(v, _mm_mullo_epi16(b, _mm_set1_epi16(RGB2V_B))), _mm_set1_epi16((short) RGB2UV_OFFSET));
+		_mm_storeu_si128((__m128i *) (pV + i), _mm_srli_epi16(v, 6));
+	}
+	ImageKernels::RgbaToYuv10_C(pRgba + i * 4, pY + i, pU + i, pV + i, count - i);
+}
+
+static void Yuv10ToRgba_SSE2(const uint16_t *pY, const uint16_t *pU, const uint16_t *pV, uint8_t *pRgba, int count)
+{
+	const __m128i two = _mm_set1_epi16(2);
+	const __m128i alpha = _mm_set1_epi8((char) 0xFF);
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m128i c = _mm_slli_epi16(_mm_sub_epi16(_mm_loadu_si128((const __m128i *) (pY + i)), _mm_set1_epi16(YUV2RGB_Y_OFFSET)), 5);
+		__m128i d = _mm_slli_epi16(_mm_sub_epi16(_mm_loadu_si128((const __m128i *) (pU + i)), _mm_set1_epi16(YUV2RGB_UV_OFFSET)), 5);
+		__m128i e = _mm_slli_epi16(_mm_sub_epi16(_mm_loadu_si128((const __m128i *) (pV + i)), _mm_set1_epi16(YUV2RGB_UV_OFFSET)), 5);
+		__m128i y = _mm_mulhi_epi16(c, _mm_set1_epi16(YUV2RGB_Y));
+		__m128i r = _mm_add_epi16(y, _mm_mulhi_epi16(e, _mm_set1_epi16(YUV2RGB_RV)));
+		__m128i g = _mm_sub_epi16(_mm_sub_epi16(y, _mm_mulhi_epi16(d, _mm_set1_epi16(YUV2RGB_GU))),
+								  _mm_mulhi_epi16(e, _mm_set1_epi16(YUV2RGB_GV)));
+		__m128i b = _mm_add_epi16(y, _mm_mulhi_epi16(d, _mm_set1_epi16(YUV2RGB_BU)));
+		r = _mm_srai_epi16(_mm_add_epi16(r, two), 2);
+		g = _mm_srai_epi16(_mm_add_epi16(g, two), 2);
+		b = _mm_srai_epi16(_mm_add_epi16(b, two), 2);
+
+		// 低 8 字节为饱和到 [0, 255] 的结果，交错成 RGBA
+		__m128i rg = _mm_unpacklo_epi8(_mm_packus_epi16(r, r), _mm_packus_epi16(g, g));
+		__m128i ba = _mm_unpacklo_epi8(_mm_packus_epi16(b, b), alpha);
+		_mm_storeu_si128((__m128i *) (pRgba + i * 4), _mm_unpacklo_epi16(rg, ba));
+		_mm_storeu_si128((__m128i *) (pRgba + i * 4 + 16), _mm_unpackhi_epi16(rg, ba));
+	}
+	ImageKernels::Yuv10ToRgba_C(pY + i, pU + i, pV + i, pRgba + i * 4, count - i);
+}
+
+static bool CpuHasSimd()
+{
+	// SSE2 是 x86_64 的基线指令集，Android x86 ABI 也要求支持
+	return true;
+}
+
+static const char *SIMD_NAME = "SSE2";
+#define Shr16To8_SIMD Shr16To8_SSE2
+#define Shl8To16_SIMD Shl8To16_SSE2
+#define Round16To8_SIMD Round16To8_SSE2
+#define RgbaToYuv10_SIMD RgbaToYuv10_SSE2
+#define Yuv10ToRgba_SIMD Yuv10ToRgba_SSE2
+#endif
+
+struct KernelTable
+{
+	Shr16To8Func shr16To8;
+	Shl8To16Func shl8To16;
+	Round16To8Func round16To8;
+	RgbaToYuv10Func rgbaToYuv10;
+	Yuv10ToRgbaFunc yuv10ToRgba;
+	bool simd;
+};
+
+static KernelTable MakeKernelTable(bool enableSimd)
+{
+	KernelTable table;
+	table.shr16To8 = ImageKernels::Shr16To8_C;
+	table.shl8To16 = ImageKernels::Shl8To16_C;
+	table.round16To8 = ImageKernels::Round16To8_C;
+	table.rgbaToYuv10 = ImageKernels::RgbaToYuv10_C;
+	table.yuv10ToRgba = ImageKernels::Yuv10ToRgba_C;
+	table.simd = false;
+#if defined(Shr16To8_SIMD)
+	if (enableSimd && CpuHasSimd())
+	{
+		table.shr16To8 = Shr16To8_SIMD;
+		table.shl8To16 = Shl8To16_SIMD;
+		table.round16To8 = Round16To8_SIMD;
+		table.rgbaToYuv10 = RgbaToYuv10_SIMD;
+		table.yuv10ToRgba = Yuv10ToRgba_SIMD;
+		table.simd = true;
+	}
+#endif
+	return table;
+}
+
+static KernelTable g_Kernels = MakeKernelTable(true);
+
+void ImageKernels::Shr16To8(const uint16_t *pSrc, uint8_t *pDst, int count)
+{
+	g_Kernels.shr16To8(pSrc, pDst, count);
+}
+
+void ImageKernels::Shl8To16(const uint8_t *pSrc, uint16_t *pDst, int count, int shift)
+{
+	g_Kernels.shl8To16(pSrc, pDst, count, shift);
+}
+
+void ImageKernels::Round16To8(const uint16_t *pSrc, uint8_t *pDst, int count, int shift)
+{
+	g_Kernels.round16To8(pSrc, pDst, count, shift);
+}
+
+void ImageKernels::RgbaToYuv10(const uint8_t *pRgba, uint16_t *pY, uint16_t *pU, uint16_t *pV, int count)
+{
+	g_Kernels.rgbaToYuv10(pRgba, pY, pU, pV, count);
+}
+
+void ImageKernels::Yuv10ToRgba(const uint16_t *pY, const uint16_t *pU, const uint16_t *pV, uint8_t *pRgba, int count)
+{
+	g_Kernels.yuv10ToRgba(pY, pU, pV, pRgba, count);
+}
+
+void ImageKernels::Shr16To8_C(const uint16_t *pSrc, uint8_t *pDst, int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		pDst[i] = (uint8_t) (pSrc[i] >> 8);
+	}
+}
+
+void ImageKernels::Shl8To16_C(const uint8_t *pSrc, uint16_t *pDst, int count, int shift)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		pDst[i] = (uint16_t) (pSrc[i] << shift);
+	}
+}
+
+void ImageKernels::Round16To8_C(const uint16_t *pSrc, uint8_t *pDst, int count, int shift)
+{
+	int half = 1 << (shift - 1);
+	for (int i = 0; i < count; ++i)
+	{
+		int v = pSrc[i] + half;
+		v = (v > 0xFFFF ? 0xFFFF : v) >> shift;
+		pDst[i] = (uint8_t) (v > 255 ? 255 : v);
+	}
+}
+
+void ImageKernels::RgbaToYuv10_C(const uint8_t *pRgba, uint16_t *pY, uint16_t *pU, uint16_t *pV, int count)
+{
+	for (int i = 0; i < count; ++i, pRgba += 4)
+	{
+		int r = pRgba[0], g = pRgba[1], b = pRgba[2];
+		pY[i] = (uint16_t) ((RGB2Y_R * r + RGB2Y_G * g + RGB2Y_B * b + RGB2Y_OFFSET) >> 6);
+		pU[i] = (uint16_t) ((RGB2UV_MAX * b - RGB2U_R * r - RGB2U_G * g + RGB2UV_OFFSET) >> 6);
+		pV[i] = (uint16_t) ((RGB2UV_MAX * r - RGB2V_G * g - RGB2V_B * b + RGB2UV_OFFSET) >> 6);
+	}
+}
+
+static inline uint8_t ClampRound10To8(int value)
+{
+	value = (value + 2) >> 2;
+	return (uint8_t) (value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+void ImageKernels::Yuv10ToRgba_C(const uint16_t *pY, const uint16_t *pU, const uint16_t *pV, uint8_t *pRgba, int count)
+{
+	for (int i = 0; i < count; ++i, pRgba += 4)
+	{
+		// 与 SIMD 的 16bit 乘法取高位一致：左移 5 位后相乘再算术右移 16 位
+		int c = (pY[i] - YUV2RGB_Y_OFFSET) * 32;
+		int d = (pU[i] - YUV2RGB_UV_OFFSET) * 32;
+		int e = (pV[i] - YUV2RGB_UV_OFFSET) * 32;
+		int y = (c * YUV2RGB_Y) >> 16;
+		pRgba[0] = ClampRound10To8(y + ((e * YUV2RGB_RV) >> 16));
+		pRgba[1] = ClampRound10To8(y - ((d * YUV2RGB_GU) >> 16) - ((e * YUV2RGB_GV) >> 16));
+		pRgba[2] = ClampRound10To8(y + ((d * YUV2RGB_BU) >> 16));
+		pRgba[3] = 255;
+	}
+}
+
+bool ImageKernels::IsSimdEnabled()
+{
+	return g_Kernels.simd;
+}
+
+void ImageKernels::SetSimdEnabled(bool enable)
+{
+	g_Kernels = MakeKernelTable(enable);
+}
+
+const char *ImageKernels::GetSimdName()
+{
+#if defined(Shr16To8_SIMD)
+	if (g_Kernels.simd) return SIMD_NAME;
+#endif
+	return "C";
+}
@@ -0,0 +1,47 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_IMAGEKERNELS_H
+#define NDK_OPENGLES_3_0_IMAGEKERNELS_H
+
+#include "stdint.h"
+
+/**
+ * 像素级转换内核，运行时选择 NEON / SSE2 实现，不支持时回退到标量实现。
+ * 所有实现的输出逐位一致。
+ */
+class ImageKernels
+{
+public:
+	// pDst[i] = pSrc[i] >> 8
+	static void Shr16To8(const uint16_t *pSrc, uint8_t *pDst, int count);
+
+	// pDst[i] = pSrc[i] << shift, shift 取值 [0, 8]
+	static void Shl8To16(const uint8_t *pSrc, uint16_t *pDst, int count, int shift);
+
+	// pDst[i] = min(255, sat16(pSrc[i] + (1 << (shift - 1))) >> shift), shift 取值 [1, 8]
+	static void Round16To8(const uint16_t *pSrc, uint8_t *pDst, int count, int shift);
+
+	// RGBA 转 10bit（8bit 值乘 4）的 Y、U、V，BT.601 TV range，系数与 RGB2*Sample 着色器一致
+	static void RgbaToYuv10(const uint8_t *pRgba, uint16_t *pY, uint16_t *pU, uint16_t *pV, int count);
+
+	// 10bit 的 Y、U、V（取值 [0, 1023]）转 RGBA，alpha 填 255，系数与 Render*Sample 着色器一致
+	static void Yuv10ToRgba(const uint16_t *pY, const uint16_t *pU, const uint16_t *pV, uint8_t *pRgba, int count);
+
+	static void Shr16To8_C(const uint16_t *pSrc, uint8_t *pDst, int count);
+	static void Shl8To16_C(const uint8_t *pSrc, uint16_t *pDst, int count, int shift);
+	static void Round16To8_C(const uint16_t *pSrc, uint8_t *pDst, int count, int shift);
+	static void RgbaToYuv10_C(const uint8_t *pRgba, uint16_t *pY, uint16_t *pU, uint16_t *pV, int count);
+	static void Yuv10ToRgba_C(const uint16_t *pY, const uint16_t *pU, const uint16_t *pV, uint8_t *pRgba, int count);
+
+	// 当前是否使用 SIMD 实现
+	static bool IsSimdEnabled();
+
+	// 强制关闭/开启 SIMD（CPU 不支持时开启无效），便于对比标量输出
+	static void SetSimdEnabled(bool enable);
+
+	static const char *GetSimdName();
+};
+
+#endif //NDK_OPENGLES_3_0_IMAGEKERNELS_H
@@ -11,31 +11,47 @@
 
 #include<android/log.h>
 #include <sys/time.h>
+#include <time.h>
 
 #define  LOG_TAG "ByteFlow"
 
-#define  LOGCATE(...)  __android_log_print(ANDROID_LOG_ERROR,LOG_TAG,__VA_ARGS__)
-#define  LOGCATV(...)  __android_log_print(ANDROID_LOG_VERBOSE,LOG_TAG,__VA_ARGS__)
-#define  LOGCATD(...)  __android_log_print(ANDROID_LOG_DEBUG,LOG_TAG,__VA_ARGS__)
-#define  LOGCATI(...)  __android_log_print(ANDROID_LOG_INFO,LOG_TAG,__VA_ARGS__)
+// 编译期日志级别，低于该级别的 LOGCAT* 调用连同参数求值一起被编译器消除
+// Release 默认只保留 INFO 及以上，可通过 -DBYTEFLOW_LOG_LEVEL=ANDROID_LOG_VERBOSE 等覆盖
+#ifndef BYTEFLOW_LOG_LEVEL
+#ifdef NDEBUG
+#define BYTEFLOW_LOG_LEVEL ANDROID_LOG_INFO
+#else
+#define BYTEFLOW_LOG_LEVEL ANDROID_LOG_VERBOSE
+#endif
+#endif
 
+// 保留下来的日志经 AsyncLogger 的环形缓冲由后台线程输出，见 AsyncLogger.h
+void ByteFlowLogPrint(int prio, const char *tag, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+#define  BYTEFLOW_LOG(prio, ...) do { if ((prio) >= BYTEFLOW_LOG_LEVEL) ByteFlowLogPrint(prio, LOG_TAG, __VA_ARGS__); } while (0)
+
+#define  LOGCATE(...)  BYTEFLOW_LOG(ANDROID_LOG_ERROR, __VA_ARGS__)
+#define  LOGCATW(...)  BYTEFLOW_LOG(ANDROID_LOG_WARN, __VA_ARGS__)
+#define  LOGCATI(...)  BYTEFLOW_LOG(ANDROID_LOG_INFO, __VA_ARGS__)
+#define  LOGCATD(...)  BYTEFLOW_LOG(ANDROID_LOG_DEBUG, __VA_ARGS__)
+#define  LOGCATV(...)  BYTEFLOW_LOG(ANDROID_LOG_VERBOSE, __VA_ARGS__)
+
+// 一次性耗时统计（编译着色器、读像素等），单调时钟、纳秒精度；逐帧的耗时请使用 FrameProfiler 的 PROFILE_SCOPE
 #define FUN_BEGIN_TIME(FUN) {\
-    LOGCATE("%s:%s func start", __FILE__, FUN); \
-    long long t0 = GetSysCurrentTime();
+    long long t0 = GetSysCurrentTimeNs();
 
 #define FUN_END_TIME(FUN) \
-    long long t1 = GetSysCurrentTime(); \
-    LOGCATE("%s:%s func cost time %ldms", __FILE__, FUN, (long)(t1-t0));}
+    long long t1 = GetSysCurrentTimeNs(); \
+    LOGCATD("%s:%s func cost time %.3fms", __FILE__, FUN, (t1-t0)/1e6);}
 
 #define BEGIN_TIME(FUN) {\
-    LOGCATE("%s func start", FUN); \
-    long long t0 = GetSysCurrentTime();
+    long long t0 = GetSysCurrentTimeNs();
 
 #define END_TIME(FUN) \
-    long long t1 = GetSysCurrentTime(); \
-    LOGCATE("%s func cost time %ldms", FUN, (long)(t1-t0));}
+    long long t1 = GetSysCurrentTimeNs(); \
+    LOGCATD("%s func cost time %.3fms", FUN, (t1-t0)/1e6);}
 
-static long long GetSysCurrentTime()
+static inline long long GetSysCurrentTime()
 {
 	struct timeval time;
 	gettimeofday(&time, NULL);
@@ -43,7 +59,16 @@ static long long GetSysCurrentTime()
 	return curTime;
 }
 
-#define GO_CHECK_GL_ERROR(...)   LOGCATE("CHECK_GL_ERROR %s glGetError = %d, line = %d, ",  __FUNCTION__, glGetError(), __LINE__)
+static inline long long GetSysCurrentTimeNs()
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return ((long long)(time.tv_sec))*1000000000LL+time.tv_nsec;
+}
+
+// 只在 glGetError 返回错误时输出错误码
+#define GO_CHECK_GL_ERROR(...)   do { GLenum glError = glGetError(); \
+    if (glError != GL_NO_ERROR) LOGCATE("CHECK_GL_ERROR %s glGetError = 0x%x, line = %d", __FUNCTION__, glError, __LINE__); } while (0)
 
 #define DEBUG_LOGCATE(...) LOGCATE("DEBUG_LOGCATE %s line = %d",  __FUNCTION__, __LINE__)
 
@@ -0,0 +1,220 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "ProgramBinaryCache.h"
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <vector>
+#include "LogUtil.h"
+#include "UniformLocationCache.h"
+
+#define PROGRAM_CACHE_MAGIC   0x42504642 // "BFPB"
+#define PROGRAM_CACHE_VERSION 1
+
+struct ProgramCacheHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;
+	uint32_t binaryFormat;
+	uint32_t binarySize;
+	uint64_t checksum;
+};
+
+bool ProgramBinaryCache::s_Enabled = true;
+bool ProgramBinaryCache::s_Supported = false;
+bool ProgramBinaryCache::s_Probed = false;
+std::string ProgramBinaryCache::s_CacheDir;
+std::mutex ProgramBinaryCache::s_Mutex;
+
+static uint64_t HashBytes(const void *pData, size_t size, uint64_t hash = 14695981039346656037ULL)
+{
+	const uint8_t *p = static_cast<const uint8_t *>(pData);
+	for (size_t i = 0; i < size; ++i)
+	{
+		hash = (hash ^ p[i]) * 1099511628211ULL;
+	}
+	return hash;
+}
+
+static uint64_t HashString(const char *pStr, uint64_t hash)
+{
+	// 追加分隔符，避免 "ab"+"c" 与 "a"+"bc" 得到相同的哈希
+	if (pStr != nullptr) hash = HashBytes(pStr, strlen(pStr), hash);
+	return HashBytes("\0", 1, hash);
+}
+
+void ProgramBinaryCache::SetCacheDir(const char *pDir)
+{
+	std::unique_lock<std::mutex> lock(s_Mutex);
+	s_CacheDir = pDir != nullptr ? pDir : "";
+}
+
+void ProgramBinaryCache::SetEnabled(bool enable)
+{
+	std::unique_lock<std::mutex> lock(s_Mutex);
+	s_Enabled = enable;
+}
+
+bool ProgramBinaryCache::IsEnabled()
+{
+	std::unique_lock<std::mutex> lock(s_Mutex);
+	if (!s_Probed)
+	{
+		// 需要在有 GL 上下文的线程上探测
+		GLint formatCount = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+		s_Supported = formatCount > 0;
+		s_Probed = true;
+		LOGCATE("ProgramBinaryCache::IsEnabled binary formats=%d, dir=%s", formatCount, s_CacheDir.c_str());
+	}
+	return s_Enabled && s_Supported && !s_CacheDir.empty();
+}
+
+uint64_t ProgramBinaryCache::MakeKey(const char *const *pSources, int sourceCount, const char *const *pVaryings, int varyingCount)
+{
+	uint64_t hash = HashBytes("ProgramBinaryCache", 18);
+	hash = HashString(reinterpret_cast<const char *>(glGetString(GL_VENDOR)), hash);
+	hash = HashString(reinterpret_cast<const char *>(glGetString(GL_RENDERER)), hash);
+	hash = HashString(reinterpret_cast<const char *>(glGetString(GL_VERSION)), hash);
+	for (int i = 0; i < sourceCount; ++i)
+	{
+		hash = HashString(pSources[i], hash);
+	}
+	for (int i = 0; i < varyingCount; ++i)
+	{
+		hash = HashString(pVaryings[i], hash);
+	}
+	return hash;
+}
+
+std::string ProgramBinaryCache::GetFilePath(uint64_t key)
+{
+	char fileName[32] = {0};
+	snprintf(fileName, sizeof(fileName), "/%016llx.bin", (unsigned long long) key);
+	std::unique_lock<std::mutex> lock(s_Mutex);
+	return s_CacheDir + fileName;
+}
+
+bool ProgramBinaryCache::MakeDirs(const std::string &dir)
+{
+	// 逐级创建，已存在的目录跳过
+	for (size_t pos = dir.find('/', 1); ; pos = dir.find('/', pos + 1))
+	{
+		std::string path = dir.substr(0, pos);
+		if (!path.empty() && mkdir(path.c_str(), 0777) != 0 && errno != EEXIST)
+		{
+			LOGCATE("ProgramBinaryCache::MakeDirs mkdir fail, dir=%s, error=%s", path.c_str(), strerror(errno));
+			return false;
+		}
+		if (pos == std::string::npos) return true;
+	}
+}
+
+GLuint ProgramBinaryCache::Load(uint64_t key)
+{
+	if (!IsEnabled()) return GL_NONE;
+
+	std::string path = GetFilePath(key);
+	FILE *fp = fopen(path.c_str(), "rb");
+	if (fp == nullptr) return GL_NONE;
+
+	ProgramCacheHeader header;
+	std::vector<uint8_t> binary;
+	bool valid = fread(&header, sizeof(header), 1, fp) == 1
+			&& header.magic == PROGRAM_CACHE_MAGIC
+			&& header.version == PROGRAM_CACHE_VERSION
+			&& header.key == key
+			&& header.binarySize > 0;
+	if (valid)
+	{
+		binary.resize(header.binarySize);
+		valid = fread(binary.data(), binary.size(), 1, fp) == 1
+				&& HashBytes(binary.data(), binary.size()) == header.checksum;
+	}
+	fclose(fp);
+
+	GLuint program = GL_NONE;
+	if (valid)
+	{
+		program = glCreateProgram();
+		glProgramBinary(program, header.binaryFormat, binary.data(), header.binarySize);
+		GLint linkStatus = GL_FALSE;
+		glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+		if (linkStatus != GL_TRUE)
+		{
+			// 驱动拒绝（例如系统更新后格式变化），回退到源码编译
+			glDeleteProgram(program);
+			program = GL_NONE;
+			valid = false;
+		}
+	}
+
+	if (!valid)
+	{
+		LOGCATE("ProgramBinaryCache::Load invalid cache file, remove %s", path.c_str());
+		unlink(path.c_str());
+		return GL_NONE;
+	}
+
+	UniformLocationCache::Build(program);
+	return program;
+}
+
+void ProgramBinaryCache::PrepareForLink(GLuint program)
+{
+	if (!IsEnabled()) return;
+	glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+}
+
+void ProgramBinaryCache::Store(uint64_t key, GLuint program)
+{
+	if (program == GL_NONE || !IsEnabled()) return;
+
+	GLint binaryLength = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+	if (binaryLength <= 0) return;
+
+	std::vector<uint8_t> binary(static_cast<size_t>(binaryLength));
+	GLenum binaryFormat = GL_NONE;
+	GLsizei length = 0;
+	glGetProgramBinary(program, binaryLength, &length, &binaryFormat, binary.data());
+	if (length <= 0) return;
+
+	ProgramCacheHeader header;
+	header.magic = PROGRAM_CACHE_MAGIC;
+	header.version = PROGRAM_CACHE_VERSION;
+	header.key = key;
+	header.binaryFormat = binaryFormat;
+	header.binarySize = static_cast<uint32_t>(length);
+	header.checksum = HashBytes(binary.data(), static_cast<size_t>(length));
+
+	std::string dir;
+	{
+		std::unique_lock<std::mutex> lock(s_Mutex);
+		dir = s_CacheDir;
+	}
+	if (access(dir.c_str(), 0) == -1 && !MakeDirs(dir)) return;
+
+	// 先写临时文件再 rename，避免进程中途退出留下不完整的缓存
+	std::string path = GetFilePath(key);
+	std::string tmpPath = path + ".tmp";
+	FILE *fp = fopen(tmpPath.c_str(), "wb");
+	if (fp == nullptr)
+	{
+		LOGCATE("ProgramBinaryCache::Store open fail, file=%s, error=%s", tmpPath.c_str(), strerror(errno));
+		return;
+	}
+	bool ok = fwrite(&header, sizeof(header), 1, fp) == 1
+			&& fwrite(binary.data(), static_cast<size_t>(length), 1, fp) == 1;
+	ok = fclose(fp) == 0 && ok;
+	if (!ok || rename(tmpPath.c_str(), path.c_str()) != 0)
+	{
+		LOGCATE("ProgramBinaryCache::Store write fail, file=%s, error=%s", path.c_str(), strerror(errno));
+		unlink(tmpPath.c_str());
+	}
+}
@@ -0,0 +1,57 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_PROGRAMBINARYCACHE_H
+#define NDK_OPENGLES_3_0_PROGRAMBINARYCACHE_H
+
+#include <GLES3/gl3.h>
+#include <mutex>
+#include <string>
+#include "stdint.h"
+
+// 应用缓存目录（Context.getCacheDir()）下的子目录名
+#define PROGRAM_CACHE_DIR_NAME "program_cache"
+
+/**
+ * 持久化的 program binary 缓存，GLUtils::CreateProgram* 在编译着色器前先查询。
+ * key 为所有着色器源码、transform feedback varying 以及 GL_VENDOR/GL_RENDERER/GL_VERSION 的哈希，
+ * 驱动升级后 key 自然失效；文件带校验和，glProgramBinary 失败时删除文件并回退到源码编译。
+ * 未调用 SetCacheDir 时缓存不生效：Android 上由 Java 层通过 native_SetCacheDir 传入 Context.getCacheDir()，
+ * 主机由 --program-cache 指定。
+ */
+class ProgramBinaryCache
+{
+public:
+	// 目录不存在时在第一次写入前逐级创建
+	static void SetCacheDir(const char *pDir);
+
+	static void SetEnabled(bool enable);
+
+	static bool IsEnabled();
+
+	// 计算缓存 key，pSources/pVaryings 中允许出现 nullptr（按空串处理）
+	static uint64_t MakeKey(const char *const *pSources, int sourceCount, const char *const *pVaryings = nullptr, int varyingCount = 0);
+
+	// 命中时返回已链接的 program，否则返回 0
+	static GLuint Load(uint64_t key);
+
+	// 链接前调用，要求驱动保留 binary
+	static void PrepareForLink(GLuint program);
+
+	// 链接成功后调用，写入缓存
+	static void Store(uint64_t key, GLuint program);
+
+private:
+	static std::string GetFilePath(uint64_t key);
+
+	static bool MakeDirs(const std::string &dir);
+
+	static bool s_Enabled;
+	static bool s_Supported;
+	static bool s_Probed;
+	static std::string s_CacheDir;
+	static std::mutex s_Mutex;
+};
+
+#endif //NDK_OPENGLES_3_0_PROGRAMBINARYCACHE_H
@@ -0,0 +1,246 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "StreamingTextureUploader.h"
+#include "TraceRecorder.h"
+#include "LogUtil.h"
+
+// 等待 PBO 可复用时每次 glClientWaitSync 的超时，超时后继续等待
+#define STREAMING_UPLOAD_WAIT_TIMEOUT_NS 100000000
+
+StreamingTextureUploader::StreamingTextureUploader(int depth)
+{
+	if (depth < 1) depth = 1;
+	if (depth > STREAMING_UPLOAD_MAX_DEPTH) depth = STREAMING_UPLOAD_MAX_DEPTH;
+	m_Slots.resize(depth);
+	m_SlotIndex = 0;
+	m_StallCount = 0;
+	m_PlaneCount = 0;
+	for (int i = 0; i < STREAMING_UPLOAD_MAX_PLANES; ++i)
+	{
+		m_TextureIds[i] = GL_NONE;
+	}
+}
+
+StreamingTextureUploader::~StreamingTextureUploader()
+{
+	// 析构可能发生在 GL 上下文销毁之后，不调用 GL，GL 对象由样例的 Destroy() 释放
+}
+
+int StreamingTextureUploader::GetTexelSize(GLenum format, GLenum type)
+{
+	int channels, channelSize;
+	switch (format)
+	{
+		case GL_RED:
+		case GL_RED_INTEGER:
+		case GL_LUMINANCE:
+		case GL_ALPHA:
+			channels = 1;
+			break;
+		case GL_RG:
+		case GL_RG_INTEGER:
+		case GL_LUMINANCE_ALPHA:
+			channels = 2;
+			break;
+		case GL_RGBA:
+		case GL_RGBA_INTEGER:
+			channels = 4;
+			break;
+		default:
+			return 0;
+	}
+	switch (type)
+	{
+		case GL_UNSIGNED_BYTE:
+			channelSize = 1;
+			break;
+		case GL_UNSIGNED_SHORT:
+		case GL_HALF_FLOAT:
+			channelSize = 2;
+			break;
+		case GL_FLOAT:
+			channelSize = 4;
+			break;
+		default:
+			return 0;
+	}
+	return channels * channelSize;
+}
+
+GLuint StreamingTextureUploader::GetTextureId(int plane) const
+{
+	if (plane < 0 || plane >= m_PlaneCount) return GL_NONE;
+	return m_TextureIds[plane];
+}
+
+int StreamingTextureUploader::AllocTextures(const StreamingPlaneDesc *pPlanes, int planeCount)
+{
+	DeleteTextures();
+	glGenTextures(planeCount, m_TextureIds);
+	for (int i = 0; i < planeCount; ++i)
+	{
+		const StreamingPlaneDesc &plane = pPlanes[i];
+		glBindTexture(GL_TEXTURE_2D, m_TextureIds[i]);
+		glTexStorage2D(GL_TEXTURE_2D, 1, plane.internalFormat, plane.width, plane.height);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, plane.filter);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, plane.filter);
+		m_Planes[i] = plane;
+	}
+	glBindTexture(GL_TEXTURE_2D, GL_NONE);
+	m_PlaneCount = planeCount;
+
+	GLenum error = glGetError();
+	if (error != GL_NO_ERROR)
+	{
+		LOGCATE("StreamingTextureUploader::AllocTextures glTexStorage2D error=0x%x", error);
+		DeleteTextures();
+		return -1;
+	}
+	return 0;
+}
+
+void StreamingTextureUploader::DeleteTextures()
+{
+	if (m_PlaneCount > 0) glDeleteTextures(m_PlaneCount, m_TextureIds);
+	for (int i = 0; i < STREAMING_UPLOAD_MAX_PLANES; ++i)
+	{
+		m_TextureIds[i] = GL_NONE;
+	}
+	m_PlaneCount = 0;
+}
+
+bool StreamingTextureUploader::WaitSlot(UploadSlot &slot)
+{
+	if (slot.fence == nullptr) return true;
+
+	GLenum status = glClientWaitSync(slot.fence, 0, 0);
+	if (status == GL_TIMEOUT_EXPIRED)
+	{
+		// depth 帧之前的上传还没被 GPU 消费完，只能等待
+		TRACE_INSTANT("StreamingUploadStall");
+		m_StallCount++;
+		do
+		{
+			status = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, STREAMING_UPLOAD_WAIT_TIMEOUT_NS);
+		} while (status == GL_TIMEOUT_EXPIRED);
+	}
+	glDeleteSync(slot.fence);
+	slot.fence = nullptr;
+	if (status == GL_WAIT_FAILED)
+	{
+		LOGCATE("StreamingTextureUploader::WaitSlot glClientWaitSync failed");
+		return false;
+	}
+	return true;
+}
+
+int StreamingTextureUploader::Upload(const NativeImage *pImage, const StreamingPlaneDesc *pPlanes, int planeCount)
+{
+	if (pImage == nullptr || pImage->ppPlane[0] == nullptr || planeCount < 1 || planeCount > STREAMING_UPLOAD_MAX_PLANES)
+	{
+		LOGCATE("StreamingTextureUploader::Upload invalid image or planeCount=%d", planeCount);
+		return -1;
+	}
+
+	// 各平面描述必须落在紧凑排列的图像范围内
+	size_t imageSize = (size_t) NativeImageUtil::GetPackedSize(pImage->format, pImage->width, pImage->height);
+	bool changed = planeCount != m_PlaneCount;
+	for (int i = 0; i < planeCount; ++i)
+	{
+		const StreamingPlaneDesc &plane = pPlanes[i];
+		int texelSize = GetTexelSize(plane.format, plane.type);
+		if (texelSize == 0 || plane.width <= 0 || plane.height <= 0
+			|| plane.offset + (size_t) plane.width * plane.height * texelSize > imageSize)
+		{
+			LOGCATE("StreamingTextureUploader::Upload plane %d out of range, format=0x%x, size=%dx%d, offset=%zu",
+					i, plane.format, plane.width, plane.height, plane.offset);
+			return -1;
+		}
+		const StreamingPlaneDesc &current = m_Planes[i];
+		changed = changed || plane.internalFormat != current.internalFormat || plane.width != current.width
+				  || plane.height != current.height || plane.filter != current.filter;
+	}
+	if (changed && AllocTextures(pPlanes, planeCount) != 0) return -1;
+	// 格式和类型不影响存储，只更新描述
+	for (int i = 0; i < planeCount; ++i)
+	{
+		m_Planes[i] = pPlanes[i];
+	}
+
+	TRACE_SCOPE("StreamingTextureUploader::Upload");
+	UploadSlot &slot = m_Slots[m_SlotIndex];
+	m_SlotIndex = (m_SlotIndex + 1) % (int) m_Slots.size();
+	if (!WaitSlot(slot)) return -1;
+
+	if (slot.pboId == GL_NONE) glGenBuffers(1, &slot.pboId);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.pboId);
+	if (slot.capacity < imageSize)
+	{
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, imageSize, nullptr, GL_STREAM_DRAW);
+		slot.capacity = imageSize;
+	}
+
+	// fence 已保证 GPU 不再读取这块 PBO，映射时不需要驱动再做同步
+	uint8_t *pData = static_cast<uint8_t *>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, imageSize,
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+	if (pData == nullptr)
+	{
+		LOGCATE("StreamingTextureUploader::Upload glMapBufferRange fail, size=%zu", imageSize);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, GL_NONE);
+		return -1;
+	}
+
+	if (NativeImageUtil::IsPacked(pImage))
+	{
+		memcpy(pData, pImage->ppPlane[0], imageSize);
+	}
+	else
+	{
+		uint8_t *pDst = pData;
+		int planes = NativeImageUtil::GetPlaneCount(pImage->format);
+		for (int i = 0; i < planes; ++i)
+		{
+			int rowBytes = NativeImageUtil::GetPlaneRowBytes(pImage->format, pImage->width, i);
+			int rows = NativeImageUtil::GetPlaneHeight(pImage->format, pImage->height, i);
+			NativeImageUtil::CopyPlane(pImage->ppPlane[i], NativeImageUtil::GetLineSize(pImage, i), pDst, rowBytes, rowBytes, rows);
+			pDst += (size_t) rowBytes * rows;
+		}
+	}
+	if (!glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER))
+	{
+		LOGCATE("StreamingTextureUploader::Upload glUnmapBuffer fail, PBO data lost");
+	}
+
+	GLint unpackAlignment = 4;
+	glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpackAlignment);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	for (int i = 0; i < planeCount; ++i)
+	{
+		const StreamingPlaneDesc &plane = m_Planes[i];
+		glBindTexture(GL_TEXTURE_2D, m_TextureIds[i]);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, plane.width, plane.height, plane.format, plane.type,
+						reinterpret_cast<const void *>(plane.offset));
+	}
+	glBindTexture(GL_TEXTURE_2D, GL_NONE);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, unpackAlignment);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, GL_NONE);
+
+	slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	return 0;
+}
+
+void StreamingTextureUploader::Destroy()
+{
+	for (UploadSlot &slot : m_Slots)
+	{
+		if (slot.fence) glDeleteSync(slot.fence);
+		if (slot.pboId != GL_NONE) glDeleteBuffers(1, &slot.pboId);
+		slot = UploadSlot();
+	}
+	m_SlotIndex = 0;
+	DeleteTextures();
+}
@@ -0,0 +1,86 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_STREAMINGTEXTUREUPLOADER_H
+#define NDK_OPENGLES_3_0_STREAMINGTEXTUREUPLOADER_H
+
+#include <GLES3/gl3.h>
+#include <vector>
+#include "ImageDef.h"
+
+#define STREAMING_UPLOAD_DEFAULT_DEPTH 3
+#define STREAMING_UPLOAD_MAX_DEPTH     8
+#define STREAMING_UPLOAD_MAX_PLANES    3
+
+/**
+ * 一个纹理平面的描述。offset 为该平面在紧凑排列图像中的字节偏移，
+ * 纹理的一行为 width * 像素字节数，可以跨越 NativeImage 的平面边界，
+ * 例如 NV21 整幅图作为 width x height*3/2 的单通道纹理上传。
+ * internalFormat 必须是 glTexStorage2D 支持的 sized 格式，
+ * GL_LUMINANCE / GL_LUMINANCE_ALPHA 对应改用 GL_R8 / GL_RG8，着色器中的 .a 改为 .g。
+ */
+struct StreamingPlaneDesc
+{
+	GLenum internalFormat = GL_R8;
+	GLenum format = GL_RED;
+	GLenum type = GL_UNSIGNED_BYTE;
+	int width = 0;
+	int height = 0;
+	size_t offset = 0;
+	GLint filter = GL_LINEAR;    // 整数纹理需要 GL_NEAREST
+};
+
+struct UploadSlot
+{
+	GLuint pboId = GL_NONE;
+	GLsync fence = nullptr;
+	size_t capacity = 0;
+};
+
+/**
+ * 流式纹理上传，替代每帧 glTexImage2D 重新分配存储。
+ * 纹理只在平面描述变化时用 glTexStorage2D 分配一次不可变存储，
+ * 每帧数据先 memcpy 到 PBO 环中的下一个 PBO，再从 PBO 偏移 glTexSubImage2D 到各平面纹理。
+ * PBO 写入前只等待 depth 帧之前插入的 fence，CPU 拷贝与上一帧的绘制重叠，
+ * PBO 到纹理的拷贝由驱动异步完成；fence 未触发时计入 GetStallCount()。
+ * 所有接口都需在持有 GL 上下文的渲染线程调用。
+ */
+class StreamingTextureUploader
+{
+public:
+	StreamingTextureUploader(int depth = STREAMING_UPLOAD_DEFAULT_DEPTH);
+
+	~StreamingTextureUploader();
+
+	// 把 pImage 按 pPlanes 描述上传到各平面纹理，描述与上次不同时重新分配纹理，成功返回 0
+	int Upload(const NativeImage *pImage, const StreamingPlaneDesc *pPlanes, int planeCount);
+
+	GLuint GetTextureId(int plane) const;
+
+	int GetPlaneCount() const { return m_PlaneCount; }
+
+	int GetStallCount() const { return m_StallCount; }
+
+	// 删除纹理、PBO 和 fence
+	void Destroy();
+
+	// format + type 组合下一个像素所占的字节数，不支持时返回 0
+	static int GetTexelSize(GLenum format, GLenum type);
+
+private:
+	int AllocTextures(const StreamingPlaneDesc *pPlanes, int planeCount);
+
+	void DeleteTextures();
+
+	bool WaitSlot(UploadSlot &slot);
+
+	std::vector<UploadSlot> m_Slots;
+	int m_SlotIndex;     // 下一次写入的 PBO
+	int m_StallCount;
+	StreamingPlaneDesc m_Planes[STREAMING_UPLOAD_MAX_PLANES];
+	GLuint m_TextureIds[STREAMING_UPLOAD_MAX_PLANES];
+	int m_PlaneCount;
+};
+
+#endif //NDK_OPENGLES_3_0_STREAMINGTEXTUREUPLOADER_H
@@ -0,0 +1,151 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "Texture16Support.h"
+#include <string.h>
+#include <GLES2/gl2ext.h>
+#include "LogUtil.h"
+
+static int s_ForcedPath = TEXTURE16_PATH_AUTO;
+
+// 低字节在 r/b，高字节在 g/a；线性过滤会分别插值高低字节，边缘处有误差
+static const char s_PackedPrefix[] = R"(#version 300 es
+precision highp float;
+#define SAMPLER16 sampler2D
+vec4 Sample16(sampler2D tex, vec2 uv)
+{
+	vec4 c = texture(tex, uv);
+	return vec4((c.rb * 255.0 + c.ga * 65280.0) / 65535.0, 0.0, 1.0);
+}
+)";
+
+static const char s_UintPrefix[] = R"(#version 300 es
+precision highp float;
+precision highp usampler2D;
+#define SAMPLER16 usampler2D
+vec4 Sample16(usampler2D tex, vec2 uv)
+{
+	ivec2 size = textureSize(tex, 0);
+	ivec2 pos = clamp(ivec2(uv * vec2(size)), ivec2(0), size - 1);
+	return vec4(vec2(texelFetch(tex, pos, 0).rg) / 65535.0, 0.0, 1.0);
+}
+)";
+
+static const char s_NormPrefix[] = R"(#version 300 es
+precision highp float;
+#define SAMPLER16 sampler2D
+vec4 Sample16(sampler2D tex, vec2 uv)
+{
+	return vec4(texture(tex, uv).rg, 0.0, 1.0);
+}
+)";
+
+void Texture16Support::SetForcedPath(int path)
+{
+	s_ForcedPath = path;
+}
+
+const char *Texture16Support::GetPathName(int path)
+{
+	switch (path)
+	{
+		case TEXTURE16_PATH_PACKED: return "packed";
+		case TEXTURE16_PATH_UINT: return "uint";
+		case TEXTURE16_PATH_NORM: return "norm";
+		default: return "auto";
+	}
+}
+
+bool Texture16Support::ParsePath(const char *pName, int &path)
+{
+	for (int i = TEXTURE16_PATH_AUTO; i <= TEXTURE16_PATH_NORM; ++i)
+	{
+		if (strcmp(pName, GetPathName(i)) == 0)
+		{
+			path = i;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool Texture16Support::IsSupported(int path)
+{
+	if (path == TEXTURE16_PATH_PACKED) return true;
+	if (path == TEXTURE16_PATH_NORM)
+	{
+		const char *pExtensions = (const char *) glGetString(GL_EXTENSIONS);
+		if (pExtensions == nullptr || strstr(pExtensions, "GL_EXT_texture_norm16") == nullptr) return false;
+	}
+
+	// 扩展或核心格式在部分驱动上声明了但分配失败，试建一个 1x1 纹理确认
+	while (glGetError() != GL_NO_ERROR);
+	StreamingPlaneDesc desc;
+	GetPlaneDesc(path, 2, 1, 1, 0, desc);
+	GLuint textureId = GL_NONE;
+	glGenTextures(1, &textureId);
+	glBindTexture(GL_TEXTURE_2D, textureId);
+	glTexStorage2D(GL_TEXTURE_2D, 1, desc.internalFormat, 1, 1);
+	uint16_t texel[2] = {0};
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, desc.format, desc.type, texel);
+	glBindTexture(GL_TEXTURE_2D, GL_NONE);
+	glDeleteTextures(1, &textureId);
+	GLenum error = glGetError();
+	if (error != GL_NO_ERROR)
+	{
+		LOGCATE("Texture16Support::IsSupported path=%s error=0x%x", GetPathName(path), error);
+		return false;
+	}
+	return true;
+}
+
+int Texture16Support::ProbePath()
+{
+	int path = s_ForcedPath == TEXTURE16_PATH_AUTO ? TEXTURE16_PATH_NORM : s_ForcedPath;
+	while (path > TEXTURE16_PATH_PACKED && !IsSupported(path))
+	{
+		path--;
+	}
+	LOGCATE("Texture16Support::ProbePath path=%s", GetPathName(path));
+	return path;
+}
+
+void Texture16Support::GetPlaneDesc(int path, int channels, int width, int height, size_t offset, StreamingPlaneDesc &desc)
+{
+	bool rg = channels > 1;
+	switch (path)
+	{
+		case TEXTURE16_PATH_NORM:
+			desc.internalFormat = rg ? GL_RG16_EXT : GL_R16_EXT;
+			desc.format = rg ? GL_RG : GL_RED;
+			desc.type = GL_UNSIGNED_SHORT;
+			desc.filter = GL_LINEAR;
+			break;
+		case TEXTURE16_PATH_UINT:
+			desc.internalFormat = rg ? GL_RG16UI : GL_R16UI;
+			desc.format = rg ? GL_RG_INTEGER : GL_RED_INTEGER;
+			desc.type = GL_UNSIGNED_SHORT;
+			desc.filter = GL_NEAREST;
+			break;
+		default:
+			desc.internalFormat = rg ? GL_RGBA8 : GL_RG8;
+			desc.format = rg ? GL_RGBA : GL_RG;
+			desc.type = GL_UNSIGNED_BYTE;
+			desc.filter = GL_LINEAR;
+			break;
+	}
+	desc.width = width;
+	desc.height = height;
+	desc.offset = offset;
+}
+
+const char *Texture16Support::GetShaderPrefix(int path)
+{
+	switch (path)
+	{
+		case TEXTURE16_PATH_NORM: return s_NormPrefix;
+		case TEXTURE16_PATH_UINT: return s_UintPrefix;
+		default: return s_PackedPrefix;
+	}
+}
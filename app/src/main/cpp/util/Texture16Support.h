@@ -0,0 +1,46 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_TEXTURE16SUPPORT_H
+#define NDK_OPENGLES_3_0_TEXTURE16SUPPORT_H
+
+#include <GLES3/gl3.h>
+#include "StreamingTextureUploader.h"
+
+#define TEXTURE16_PATH_AUTO   -1
+#define TEXTURE16_PATH_PACKED  0   // 高低字节当作 RG8/RGBA8 上传，着色器里重组
+#define TEXTURE16_PATH_UINT    1   // GL_R16UI / GL_RG16UI，texelFetch 取整数，只能最近邻采样
+#define TEXTURE16_PATH_NORM    2   // GL_EXT_texture_norm16 的 GL_R16_EXT / GL_RG16_EXT，硬件归一化并支持线性过滤
+
+/**
+ * 16bit 纹理（P010、GRAY10 等）的上传路径选择。
+ * ProbePath 在当前上下文上试建 1x1 纹理，按 NORM > UINT > PACKED 选出第一个可用的路径；
+ * 各路径共用 GetShaderPrefix 提供的 SAMPLER16 类型和 Sample16(tex, uv)，
+ * 样例的着色器主体只写一份，Sample16 返回 [0, 1] 归一化的前两个 16bit 通道。
+ */
+class Texture16Support
+{
+public:
+	// 在持有 GL 上下文的线程调用，指定了 SetForcedPath 时从该路径开始向下探测
+	static int ProbePath();
+
+	// TEXTURE16_PATH_AUTO 恢复自动选择
+	static void SetForcedPath(int path);
+
+	static const char *GetPathName(int path);
+
+	// 按名字（packed / uint / norm / auto）解析路径，无法识别时返回 false
+	static bool ParsePath(const char *pName, int &path);
+
+	// channels 为每个像素的 16bit 通道数，1 或 2
+	static void GetPlaneDesc(int path, int channels, int width, int height, size_t offset, StreamingPlaneDesc &desc);
+
+	// 片段着色器前缀，包含 #version、默认精度、SAMPLER16 和 Sample16 的定义
+	static const char *GetShaderPrefix(int path);
+
+private:
+	static bool IsSupported(int path);
+};
+
+#endif //NDK_OPENGLES_3_0_TEXTURE16SUPPORT_H
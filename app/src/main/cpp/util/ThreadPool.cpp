@@ -0,0 +1,175 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "ThreadPool.h"
+#include <algorithm>
+#include "LogUtil.h"
+
+// 当前线程正在执行某个 ParallelFor 的段，嵌套调用时串行执行，避免等待自己
+static thread_local bool t_InParallelFor = false;
+
+ThreadPool *ThreadPool::s_Instance = nullptr;
+std::mutex ThreadPool::s_InstanceMutex;
+
+ThreadPool *ThreadPool::GetInstance()
+{
+	if (s_Instance == nullptr)
+	{
+		std::unique_lock<std::mutex> lock(s_InstanceMutex);
+		if (s_Instance == nullptr)
+		{
+			s_Instance = new ThreadPool();
+		}
+	}
+	return s_Instance;
+}
+
+void ThreadPool::DestroyInstance()
+{
+	std::unique_lock<std::mutex> lock(s_InstanceMutex);
+	if (s_Instance)
+	{
+		delete s_Instance;
+		s_Instance = nullptr;
+	}
+}
+
+ThreadPool::ThreadPool()
+{
+	m_Generation = 0;
+	m_ActiveWorkers = 0;
+	m_Quit = false;
+	m_pFunc = nullptr;
+	m_Count = 0;
+	m_BandSize = 0;
+	m_BandCount = 0;
+	m_NextBand = 0;
+	m_DoneBands = 0;
+	StartWorkers(0);
+}
+
+ThreadPool::~ThreadPool()
+{
+	StopWorkers();
+}
+
+void ThreadPool::StartWorkers(int threadCount)
+{
+	if (threadCount <= 0)
+	{
+		threadCount = std::min((int) std::thread::hardware_concurrency(), THREAD_POOL_MAX_THREADS);
+		threadCount = std::max(threadCount, 1);
+	}
+	m_Quit = false;
+	// 调用线程也参与计算，只需 threadCount - 1 个工作线程
+	for (int i = 1; i < threadCount; ++i)
+	{
+		m_Workers.emplace_back(&ThreadPool::WorkerLoop, this);
+	}
+	LOGCATE("ThreadPool::StartWorkers threadCount=%d", threadCount);
+}
+
+void ThreadPool::StopWorkers()
+{
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_Quit = true;
+	}
+	m_WorkCond.notify_all();
+	for (auto &worker : m_Workers)
+	{
+		worker.join();
+	}
+	m_Workers.clear();
+}
+
+int ThreadPool::GetThreadCount()
+{
+	std::unique_lock<std::mutex> lock(m_RunMutex);
+	return (int) m_Workers.size() + 1;
+}
+
+void ThreadPool::SetThreadCount(int count)
+{
+	std::unique_lock<std::mutex> lock(m_RunMutex);
+	StopWorkers();
+	StartWorkers(count);
+}
+
+void ThreadPool::WorkerLoop()
+{
+	t_InParallelFor = true;
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	uint64_t generation = m_Generation;
+	while (true)
+	{
+		m_WorkCond.wait(lock, [&] { return m_Quit || m_Generation != generation; });
+		if (m_Quit) return;
+		generation = m_Generation;
+		m_ActiveWorkers++;
+		lock.unlock();
+		RunBands();
+		lock.lock();
+		if (--m_ActiveWorkers == 0) m_DoneCond.notify_all();
+	}
+}
+
+void ThreadPool::RunBands()
+{
+	while (true)
+	{
+		int band = m_NextBand.fetch_add(1);
+		if (band >= m_BandCount) return;
+		int begin = band * m_BandSize;
+		int end = std::min(begin + m_BandSize, m_Count);
+		(*m_pFunc)(begin, end);
+		if (m_DoneBands.fetch_add(1) + 1 == m_BandCount)
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_DoneCond.notify_all();
+		}
+	}
+}
+
+void ThreadPool::ParallelFor(int count, int grain, const ParallelForFunc &func)
+{
+	if (count <= 0) return;
+	grain = std::max(grain, 1);
+	if (t_InParallelFor || count <= grain)
+	{
+		func(0, count);
+		return;
+	}
+
+	std::unique_lock<std::mutex> runLock(m_RunMutex);
+	int threadCount = (int) m_Workers.size() + 1;
+	int bandCount = std::min((count + grain - 1) / grain, threadCount * THREAD_POOL_BANDS_PER_THREAD);
+	if (threadCount == 1 || bandCount <= 1)
+	{
+		runLock.unlock();
+		func(0, count);
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	// 上一个任务中醒得晚的工作线程可能还没退出 RunBands，等它们空闲后再改任务状态
+	m_DoneCond.wait(lock, [&] { return m_ActiveWorkers == 0; });
+	m_pFunc = &func;
+	m_Count = count;
+	m_BandSize = (count + bandCount - 1) / bandCount;
+	m_BandCount = (count + m_BandSize - 1) / m_BandSize;
+	m_NextBand = 0;
+	m_DoneBands = 0;
+	m_Generation++;
+	lock.unlock();
+	m_WorkCond.notify_all();
+
+	t_InParallelFor = true;
+	RunBands();
+	t_InParallelFor = false;
+
+	// 所有段都已领取并完成后，醒得晚的工作线程只会领到越界的段号，不会再调用 func
+	lock.lock();
+	m_DoneCond.wait(lock, [&] { return m_DoneBands == m_BandCount; });
+}
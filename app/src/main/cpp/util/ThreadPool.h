@@ -0,0 +1,76 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_THREADPOOL_H
+#define NDK_OPENGLES_3_0_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 默认线程数的上限，移动端大小核混排，再多的线程会落到小核上拖慢整体
+#define THREAD_POOL_MAX_THREADS 8
+
+// 每个线程分到的段数，段数多于线程数时先完成的线程可以继续领取，平衡大小核的速度差异
+#define THREAD_POOL_BANDS_PER_THREAD 4
+
+typedef std::function<void(int begin, int end)> ParallelForFunc;
+
+/**
+ * 数据并行的线程池：ParallelFor 把 [0, count) 切成若干段，工作线程和调用线程一起领取执行，
+ * 全部完成后返回。多个线程同时调用 ParallelFor 时依次执行；在工作线程内嵌套调用时直接串行执行。
+ */
+class ThreadPool
+{
+public:
+	static ThreadPool *GetInstance();
+
+	static void DestroyInstance();
+
+	// 每段至少 grain 个元素，func 在不同线程上并发执行，不能依赖执行顺序
+	void ParallelFor(int count, int grain, const ParallelForFunc &func);
+
+	// 参与计算的线程数，包括调用线程
+	int GetThreadCount();
+
+	// count <= 0 时按 CPU 核数，修改后重建工作线程
+	void SetThreadCount(int count);
+
+private:
+	ThreadPool();
+
+	~ThreadPool();
+
+	void StartWorkers(int threadCount);
+
+	void StopWorkers();
+
+	void WorkerLoop();
+
+	void RunBands();
+
+	static ThreadPool *s_Instance;
+	static std::mutex s_InstanceMutex;
+
+	std::mutex m_RunMutex;     // 串行化 ParallelFor 和 SetThreadCount
+	std::mutex m_Mutex;        // 保护以下任务状态
+	std::condition_variable m_WorkCond;
+	std::condition_variable m_DoneCond;
+	std::vector<std::thread> m_Workers;
+	uint64_t m_Generation;
+	int m_ActiveWorkers;
+	bool m_Quit;
+
+	const ParallelForFunc *m_pFunc;
+	int m_Count;
+	int m_BandSize;
+	int m_BandCount;
+	std::atomic<int> m_NextBand;
+	std::atomic<int> m_DoneBands;
+};
+
+#endif //NDK_OPENGLES_3_0_THREADPOOL_H
@@ -0,0 +1,185 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "TraceRecorder.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#include "LogUtil.h"
+
+std::atomic<bool> TraceRecorder::s_Enabled(false);
+std::atomic<uint32_t> TraceRecorder::s_Session(0);
+std::mutex TraceRecorder::s_Mutex;
+std::vector<TraceThreadBuffer *> TraceRecorder::s_Buffers;
+
+static thread_local TraceThreadBuffer *t_TraceBuffer = nullptr;
+// 超出 TRACE_MAX_THREADS 的线程只尝试注册一次
+static thread_local bool t_TraceRejected = false;
+
+void TraceRecorder::Start()
+{
+	s_Session.fetch_add(1, std::memory_order_acq_rel);
+	s_Enabled.store(true, std::memory_order_release);
+	LOGCATE("TraceRecorder::Start session=%u", s_Session.load());
+}
+
+void TraceRecorder::Stop()
+{
+	s_Enabled.store(false, std::memory_order_release);
+	LOGCATE("TraceRecorder::Stop session=%u", s_Session.load());
+}
+
+TraceThreadBuffer *TraceRecorder::GetThreadBuffer()
+{
+	if (t_TraceBuffer) return t_TraceBuffer;
+	if (t_TraceRejected) return nullptr;
+
+	std::unique_lock<std::mutex> lock(s_Mutex);
+	if (s_Buffers.size() >= TRACE_MAX_THREADS)
+	{
+		t_TraceRejected = true;
+		LOGCATE("TraceRecorder::GetThreadBuffer too many threads, max=%d", TRACE_MAX_THREADS);
+		return nullptr;
+	}
+
+	TraceThreadBuffer *pBuffer = new TraceThreadBuffer();
+	pBuffer->tid = (int) syscall(__NR_gettid);
+	memset(pBuffer->threadName, 0, sizeof(pBuffer->threadName));
+	prctl(PR_GET_NAME, pBuffer->threadName, 0, 0, 0);
+	pBuffer->session.store(0, std::memory_order_relaxed);
+	pBuffer->count.store(0, std::memory_order_relaxed);
+	pBuffer->dropped.store(0, std::memory_order_relaxed);
+	s_Buffers.push_back(pBuffer);
+	t_TraceBuffer = pBuffer;
+	return pBuffer;
+}
+
+void TraceRecorder::Record(char type, const char *name, int64_t value)
+{
+	TraceThreadBuffer *pBuffer = GetThreadBuffer();
+	if (pBuffer == nullptr) return;
+
+	// 新的录制开始后由写者自己清空缓冲，避免跨线程重置
+	uint32_t session = s_Session.load(std::memory_order_acquire);
+	if (pBuffer->session.load(std::memory_order_relaxed) != session)
+	{
+		pBuffer->count.store(0, std::memory_order_relaxed);
+		pBuffer->dropped.store(0, std::memory_order_relaxed);
+		pBuffer->session.store(session, std::memory_order_release);
+	}
+
+	uint32_t count = pBuffer->count.load(std::memory_order_relaxed);
+	if (count >= TRACE_BUFFER_EVENTS)
+	{
+		pBuffer->dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	TraceEvent &event = pBuffer->events[count];
+	event.name = name;
+	event.timestampNs = GetSysCurrentTimeNs();
+	event.value = value;
+	event.type = type;
+	pBuffer->count.store(count + 1, std::memory_order_release);
+}
+
+void TraceRecorder::Begin(const char *name)
+{
+	Record(TRACE_EVENT_BEGIN, name, 0);
+}
+
+void TraceRecorder::End(const char *name)
+{
+	Record(TRACE_EVENT_END, name, 0);
+}
+
+void TraceRecorder::Instant(const char *name)
+{
+	Record(TRACE_EVENT_INSTANT, name, 0);
+}
+
+void TraceRecorder::Counter(const char *name, int64_t value)
+{
+	Record(TRACE_EVENT_COUNTER, name, value);
+}
+
+void TraceRecorder::SetThreadName(const char *name)
+{
+	TraceThreadBuffer *pBuffer = GetThreadBuffer();
+	if (pBuffer == nullptr || name == nullptr) return;
+
+	std::unique_lock<std::mutex> lock(s_Mutex);
+	strncpy(pBuffer->threadName, name, sizeof(pBuffer->threadName) - 1);
+	pBuffer->threadName[sizeof(pBuffer->threadName) - 1] = '\0';
+}
+
+static void WriteJsonString(FILE *fp, const char *str)
+{
+	fputc('"', fp);
+	for (const char *p = str; p && *p; ++p)
+	{
+		unsigned char c = (unsigned char) *p;
+		if (c == '"' || c == '\\') fprintf(fp, "\\%c", c);
+		else if (c < 0x20) fprintf(fp, "\\u%04x", c);
+		else fputc(c, fp);
+	}
+	fputc('"', fp);
+}
+
+int TraceRecorder::Flush(const char *path)
+{
+	FILE *fp = fopen(path, "w");
+	if (fp == nullptr)
+	{
+		LOGCATE("TraceRecorder::Flush open %s fail", path);
+		return -1;
+	}
+
+	int pid = getpid();
+	uint32_t session = s_Session.load(std::memory_order_acquire);
+	long totalEvents = 0, totalDropped = 0;
+	bool first = true;
+
+	fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+	std::unique_lock<std::mutex> lock(s_Mutex);
+	for (TraceThreadBuffer *pBuffer : s_Buffers)
+	{
+		if (pBuffer->session.load(std::memory_order_acquire) != session) continue;
+		uint32_t count = pBuffer->count.load(std::memory_order_acquire);
+
+		fprintf(fp, "%s{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":",
+				first ? "" : ",\n", pid, pBuffer->tid);
+		WriteJsonString(fp, pBuffer->threadName);
+		fprintf(fp, "}}");
+		first = false;
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const TraceEvent &event = pBuffer->events[i];
+			fprintf(fp, ",\n{\"ph\":\"%c\",\"name\":", event.type);
+			WriteJsonString(fp, event.name);
+			fprintf(fp, ",\"ts\":%.3f,\"pid\":%d,\"tid\":%d", event.timestampNs / 1000.0, pid, pBuffer->tid);
+			if (event.type == TRACE_EVENT_INSTANT)
+			{
+				fprintf(fp, ",\"s\":\"t\"");
+			}
+			else if (event.type == TRACE_EVENT_COUNTER)
+			{
+				fprintf(fp, ",\"args\":{\"value\":%lld}", (long long) event.value);
+			}
+			fputc('}', fp);
+		}
+		totalEvents += count;
+		totalDropped += pBuffer->dropped.load(std::memory_order_relaxed);
+	}
+	lock.unlock();
+
+	fprintf(fp, "\n]}\n");
+	fclose(fp);
+	LOGCATE("TraceRecorder::Flush path=%s, events=%ld, dropped=%ld", path, totalEvents, totalDropped);
+	return 0;
+}
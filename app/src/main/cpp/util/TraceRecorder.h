@@ -0,0 +1,140 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_TRACERECORDER_H
+#define NDK_OPENGLES_3_0_TRACERECORDER_H
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "stdint.h"
+
+// 编译期开关，置 0 时 TRACE_* 宏完全展开为空
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 1
+#endif
+
+// 每个线程缓冲的事件数，写满后丢弃并计数
+#define TRACE_BUFFER_EVENTS  8192
+// 最多记录的线程数，超出的线程不记录
+#define TRACE_MAX_THREADS    64
+
+#define DEFAULT_TRACE_PATH "/sdcard/Android/data/com.byteflow.app/cache/trace.json"
+
+enum TraceEventType
+{
+	TRACE_EVENT_BEGIN   = 'B',
+	TRACE_EVENT_END     = 'E',
+	TRACE_EVENT_INSTANT = 'i',
+	TRACE_EVENT_COUNTER = 'C',
+};
+
+struct TraceEvent
+{
+	const char *name;    // 必须是静态生命周期的字符串
+	int64_t timestampNs; // CLOCK_MONOTONIC
+	int64_t value;       // 仅 counter 事件使用
+	char type;
+};
+
+/**
+ * 单写者事件缓冲：只有所属线程写入，写完后 release 发布 count，
+ * Flush 线程 acquire 读取 count 后读取已发布的事件，整个写入路径无锁、不分配内存。
+ */
+struct TraceThreadBuffer
+{
+	int tid;
+	char threadName[32];
+	std::atomic<uint32_t> session;
+	std::atomic<uint32_t> count;
+	std::atomic<uint32_t> dropped;
+	TraceEvent events[TRACE_BUFFER_EVENTS];
+};
+
+/**
+ * 跨线程时间线记录，Flush 输出 Chrome trace-event JSON，可直接在 Perfetto / chrome://tracing 打开。
+ * 缓冲在线程第一次记录事件时创建并常驻到进程结束，线程退出后其事件仍可导出。
+ */
+class TraceRecorder
+{
+public:
+	static inline bool IsEnabled()
+	{
+		return s_Enabled.load(std::memory_order_relaxed);
+	}
+
+	// 开始新的录制，之前的事件被丢弃
+	static void Start();
+
+	static void Stop();
+
+	// 将当前录制写为 JSON 文件，可在录制中或停止后调用，成功返回 0
+	static int Flush(const char *path);
+
+	static void Begin(const char *name);
+
+	static void End(const char *name);
+
+	static void Instant(const char *name);
+
+	static void Counter(const char *name, int64_t value);
+
+	// name 会被拷贝，未设置时使用系统线程名
+	static void SetThreadName(const char *name);
+
+private:
+	static TraceThreadBuffer *GetThreadBuffer();
+
+	static void Record(char type, const char *name, int64_t value);
+
+	static std::atomic<bool> s_Enabled;
+	static std::atomic<uint32_t> s_Session;
+	static std::mutex s_Mutex;
+	static std::vector<TraceThreadBuffer *> s_Buffers;
+};
+
+/**
+ * RAII 区间，关闭时只读取一个原子标志
+ */
+class TraceScope
+{
+public:
+	explicit TraceScope(const char *name) : m_Name(nullptr)
+	{
+		if (TraceRecorder::IsEnabled())
+		{
+			m_Name = name;
+			TraceRecorder::Begin(name);
+		}
+	}
+
+	~TraceScope()
+	{
+		if (m_Name) TraceRecorder::End(m_Name);
+	}
+
+private:
+	const char *m_Name;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+#if TRACE_ENABLED
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope_, __LINE__)(name)
+#define TRACE_BEGIN(name) if (TraceRecorder::IsEnabled()) TraceRecorder::Begin(name)
+#define TRACE_END(name) if (TraceRecorder::IsEnabled()) TraceRecorder::End(name)
+#define TRACE_INSTANT(name) if (TraceRecorder::IsEnabled()) TraceRecorder::Instant(name)
+#define TRACE_COUNTER(name, value) if (TraceRecorder::IsEnabled()) TraceRecorder::Counter(name, value)
+#define TRACE_THREAD_NAME(name) TraceRecorder::SetThreadName(name)
+#else
+#define TRACE_SCOPE(name)
+#define TRACE_BEGIN(name)
+#define TRACE_END(name)
+#define TRACE_INSTANT(name)
+#define TRACE_COUNTER(name, value)
+#define TRACE_THREAD_NAME(name)
+#endif
+
+#endif //NDK_OPENGLES_3_0_TRACERECORDER_H
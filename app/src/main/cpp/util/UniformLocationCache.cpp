@@ -0,0 +1,112 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#include "UniformLocationCache.h"
+#include <stdio.h>
+#include <string>
+#include <string.h>
+#include <vector>
+#include "LogUtil.h"
+
+std::mutex UniformLocationCache::s_Mutex;
+std::unordered_map<UniformLocationCache::ProgramKey, UniformLocationCache::ProgramUniforms,
+		UniformLocationCache::ProgramKeyHash> UniformLocationCache::s_Programs;
+
+void UniformLocationCache::Insert(ProgramUniforms &uniforms, const char *name, GLint location)
+{
+	uint64_t hash = HashUniformName(name);
+	if (uniforms.collisions.count(hash)) return;
+
+	auto it = uniforms.locations.find(hash);
+	if (it != uniforms.locations.end() && it->second != location)
+	{
+		LOGCATE("UniformLocationCache::Insert hash collision, name=%s", name);
+		uniforms.locations.erase(it);
+		uniforms.collisions.insert(hash);
+		return;
+	}
+	uniforms.locations[hash] = location;
+}
+
+void UniformLocationCache::Build(GLuint program)
+{
+	if (program == GL_NONE) return;
+
+	ProgramUniforms uniforms;
+	GLint uniformCount = 0, maxNameLength = 0;
+	glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniformCount);
+	glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+	std::vector<char> name(static_cast<size_t>(maxNameLength > 0 ? maxNameLength : 1) + 16);
+	for (GLint i = 0; i < uniformCount; ++i)
+	{
+		GLsizei length = 0;
+		GLint size = 0;
+		GLenum type = GL_NONE;
+		glGetActiveUniform(program, static_cast<GLuint>(i), maxNameLength, &length, &size, &type, name.data());
+		GLint location = glGetUniformLocation(program, name.data());
+		if (location < 0) continue; // uniform block 中的成员没有 location
+
+		Insert(uniforms, name.data(), location);
+
+		// 数组 "a[0]" 同时登记 "a" 以及 "a[1]" ... "a[n-1]"
+		char *pBracket = length > 3 ? strstr(name.data(), "[0]") : nullptr;
+		if (pBracket != nullptr && pBracket[3] == '\0')
+		{
+			*pBracket = '\0';
+			Insert(uniforms, name.data(), location);
+			std::string baseName(name.data());
+			for (GLint j = 1; j < size; ++j)
+			{
+				char elementName[256] = {0};
+				snprintf(elementName, sizeof(elementName), "%s[%d]", baseName.c_str(), j);
+				Insert(uniforms, elementName, glGetUniformLocation(program, elementName));
+			}
+		}
+	}
+
+	ProgramKey key = GetKey(program);
+	std::unique_lock<std::mutex> lock(s_Mutex);
+	s_Programs[key] = std::move(uniforms);
+}
+
+void UniformLocationCache::Invalidate(GLuint program)
+{
+	ProgramKey key = GetKey(program);
+	std::unique_lock<std::mutex> lock(s_Mutex);
+	s_Programs.erase(key);
+}
+
+void UniformLocationCache::InvalidateContext(EGLContext context)
+{
+	std::unique_lock<std::mutex> lock(s_Mutex);
+	for (auto it = s_Programs.begin(); it != s_Programs.end();)
+	{
+		if (it->first.context == context) it = s_Programs.erase(it);
+		else ++it;
+	}
+}
+
+GLint UniformLocationCache::GetLocation(GLuint program, uint64_t nameHash, const char *name)
+{
+	ProgramKey key = GetKey(program);
+	{
+		std::unique_lock<std::mutex> lock(s_Mutex);
+		auto programIt = s_Programs.find(key);
+		if (programIt != s_Programs.end())
+		{
+			ProgramUniforms &uniforms = programIt->second;
+			auto it = uniforms.locations.find(nameHash);
+			if (it != uniforms.locations.end()) return it->second;
+			if (uniforms.collisions.count(nameHash)) return glGetUniformLocation(program, name);
+		}
+	}
+
+	// 不在缓存中：未经 GLUtils 创建的 program，或者名字不是 active uniform，
+	// 查询一次后记下结果（包括 -1），之后同样不再访问驱动
+	GLint location = glGetUniformLocation(program, name);
+	std::unique_lock<std::mutex> lock(s_Mutex);
+	Insert(s_Programs[key], name, location);
+	return location;
+}
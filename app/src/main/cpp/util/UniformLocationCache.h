@@ -0,0 +1,99 @@
+//
+// Created by ByteFlow on 2026/10/16.
+//
+
+#ifndef NDK_OPENGLES_3_0_UNIFORMLOCATIONCACHE_H
+#define NDK_OPENGLES_3_0_UNIFORMLOCATIONCACHE_H
+
+#include <GLES3/gl3.h>
+#include <EGL/egl.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include "stdint.h"
+
+// FNV-1a 64 位哈希，C++11 constexpr 只允许单条 return，所以写成递归形式
+constexpr uint64_t HashUniformName(const char *name, uint64_t hash = 14695981039346656037ULL)
+{
+	return *name == '\0' ? hash : HashUniformName(name + 1, (hash ^ (uint8_t) *name) * 1099511628211ULL);
+}
+
+/**
+ * 带哈希的 uniform 名称，GLUtils/Shader 的 setter 以它为参数。
+ * 可由字符串字面量、std::string 隐式构造，也可以在编译期预先构造：
+ * static constexpr GLUniformName U_MVP_MATRIX("u_MVPMatrix");
+ */
+struct GLUniformName
+{
+	const char *name;
+	uint64_t hash;
+
+	constexpr GLUniformName(const char *n) : name(n), hash(HashUniformName(n)) {}
+
+	GLUniformName(const std::string &n) : name(n.c_str()), hash(HashUniformName(n.c_str())) {}
+};
+
+/**
+ * 按 (当前 EGLContext, program) 缓存 uniform location，链接成功后枚举 GL_ACTIVE_UNIFORMS 一次性填充，
+ * 之后查询只做哈希查找，不再调用 glGetUniformLocation。
+ * 不共享的上下文（如 EGLRender 的离屏上下文与主 surface）各自分配 program 名，同名 program 互不相干，
+ * 所以缓存项归属于创建/查询时的当前上下文；销毁上下文前调用 InvalidateContext 丢弃它的缓存项
+ */
+class UniformLocationCache
+{
+public:
+	// 链接成功后调用，重新枚举 program 的所有 active uniform（program id 可能被复用）
+	static void Build(GLuint program);
+
+	static void Invalidate(GLuint program);
+
+	// 丢弃 context 下的所有缓存项，在 eglDestroyContext 之前调用
+	static void InvalidateContext(EGLContext context);
+
+	static GLint GetLocation(GLuint program, uint64_t nameHash, const char *name);
+
+	static GLint GetLocation(GLuint program, const char *name)
+	{
+		return GetLocation(program, HashUniformName(name), name);
+	}
+
+private:
+	struct ProgramUniforms
+	{
+		std::unordered_map<uint64_t, GLint> locations;
+		std::unordered_set<uint64_t> collisions; // 哈希冲突的名字退回 glGetUniformLocation
+	};
+
+	struct ProgramKey
+	{
+		EGLContext context;
+		GLuint program;
+
+		bool operator==(const ProgramKey &other) const
+		{
+			return context == other.context && program == other.program;
+		}
+	};
+
+	struct ProgramKeyHash
+	{
+		size_t operator()(const ProgramKey &key) const
+		{
+			return std::hash<const void *>()(key.context) ^ (std::hash<GLuint>()(key.program) << 1);
+		}
+	};
+
+	static ProgramKey GetKey(GLuint program)
+	{
+		ProgramKey key = {eglGetCurrentContext(), program};
+		return key;
+	}
+
+	static void Insert(ProgramUniforms &uniforms, const char *name, GLint location);
+
+	static std::mutex s_Mutex;
+	static std::unordered_map<ProgramKey, ProgramUniforms, ProgramKeyHash> s_Programs;
+};
+
+#endif //NDK_OPENGLES_3_0_UNIFORMLOCATIONCACHE_H
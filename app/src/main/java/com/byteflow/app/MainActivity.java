@@ -205,7 +205,7 @@ public class MainActivity extends AppCompatActivity implements AudioCollector.Ca
         mRootView = (ViewGroup) findViewById(R.id.rootView);
         mRootView.getViewTreeObserver().addOnGlobalLayoutListener(this);
         mSensorManager = (SensorManager) getSystemService(SENSOR_SERVICE);
-        mGLRender.init();
+        mGLRender.init(getCacheDir().getAbsolutePath());
 
     }
 
@@ -597,10 +597,9 @@ public class MainActivity extends AppCompatActivity implements AudioCollector.Ca
             bitmap = BitmapFactory.decodeStream(is);
             if (bitmap != null) {
                 int bytes = bitmap.getByteCount();
-                ByteBuffer buf = ByteBuffer.allocate(bytes);
+                ByteBuffer buf = ByteBuffer.allocateDirect(bytes);
                 bitmap.copyPixelsToBuffer(buf);
-                byte[] byteArray = buf.array();
-                mGLRender.setImageData(IMAGE_FORMAT_RGBA, bitmap.getWidth(), bitmap.getHeight(), byteArray);
+                mGLRender.setImageData(IMAGE_FORMAT_RGBA, bitmap.getWidth(), bitmap.getHeight(), buf, null);
             }
         }
         finally
@@ -624,10 +623,9 @@ public class MainActivity extends AppCompatActivity implements AudioCollector.Ca
             bitmap = BitmapFactory.decodeStream(is);
             if (bitmap != null) {
                 int bytes = bitmap.getByteCount();
-                ByteBuffer buf = ByteBuffer.allocate(bytes);
+                ByteBuffer buf = ByteBuffer.allocateDirect(bytes);
                 bitmap.copyPixelsToBuffer(buf);
-                byte[] byteArray = buf.array();
-                mGLRender.setImageDataWithIndex(index, IMAGE_FORMAT_RGBA, bitmap.getWidth(), bitmap.getHeight(), byteArray);
+                mGLRender.setImageDataWithIndex(index, IMAGE_FORMAT_RGBA, bitmap.getWidth(), bitmap.getHeight(), buf, null);
             }
         }
         finally
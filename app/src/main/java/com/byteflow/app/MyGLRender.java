@@ -3,6 +3,8 @@ package com.byteflow.app;
 import android.opengl.GLSurfaceView;
 import android.util.Log;
 
+import java.nio.ByteBuffer;
+
 import javax.microedition.khronos.egl.EGLConfig;
 import javax.microedition.khronos.opengles.GL10;
 
@@ -37,8 +39,9 @@ public class MyGLRender implements GLSurfaceView.Renderer {
 
     }
 
-    public void init() {
+    public void init(String cacheDir) {
         mNativeRender.native_Init();
+        mNativeRender.native_SetCacheDir(cacheDir);
     }
 
     public void unInit() {
@@ -69,6 +72,14 @@ public class MyGLRender implements GLSurfaceView.Renderer {
         mNativeRender.native_SetImageDataWithIndex(index, format, width, height, bytes);
     }
 
+    public void setImageData(int format, int width, int height, ByteBuffer buffer, int[] lineSizes) {
+        mNativeRender.native_SetDirectImageData(-1, format, width, height, buffer, lineSizes);
+    }
+
+    public void setImageDataWithIndex(int index, int format, int width, int height, ByteBuffer buffer, int[] lineSizes) {
+        mNativeRender.native_SetDirectImageData(index, format, width, height, buffer, lineSizes);
+    }
+
     public void setAudioData(short[] audioData) {
         mNativeRender.native_SetAudioData(audioData);
     }
@@ -8,6 +8,8 @@
 
 package com.byteflow.app;
 
+import java.nio.ByteBuffer;
+
 public class MyNativeRender {
     public static final int SAMPLE_TYPE  =  200;
 
@@ -77,6 +79,12 @@ public class MyNativeRender {
 
     public static final int SAMPLE_TYPE_SET_TOUCH_LOC           = SAMPLE_TYPE + 999;
     public static final int SAMPLE_TYPE_SET_GRAVITY_XY          = SAMPLE_TYPE + 1000;
+    public static final int SAMPLE_TYPE_SET_TRACE               = SAMPLE_TYPE + 1001;
+    // value0 为 YUV_BACKEND_*，对之后选中的 RGB2* 样例生效
+    public static final int SAMPLE_TYPE_SET_YUV_BACKEND         = SAMPLE_TYPE + 1002;
+
+    public static final int YUV_BACKEND_FRAGMENT                = 0;
+    public static final int YUV_BACKEND_COMPUTE                 = 1;
 
 
     static {
@@ -87,6 +95,9 @@ public class MyNativeRender {
 
     public native void native_UnInit();
 
+    // 传入 Context.getCacheDir()，program binary 缓存写在其下的 program_cache 目录
+    public native void native_SetCacheDir(String cacheDir);
+
     public native void native_SetParamsInt(int paramType, int value0, int value1);
 
     public native void native_SetParamsFloat(int paramType, float value0, float value1);
@@ -97,6 +108,12 @@ public class MyNativeRender {
 
     public native void native_SetImageDataWithIndex(int index, int format, int width, int height, byte[] bytes);
 
+    // buffer 必须是 direct ByteBuffer，index < 0 表示不带索引；lineSizes 为各平面行跨度，可为 null
+    public native void native_SetDirectImageData(int index, int format, int width, int height, ByteBuffer buffer, int[] lineSizes);
+
+    // 默认关闭：临界区内 LoadImage 会等锁，可能阻塞 GC，仅用于对比测量
+    public native void native_SetCriticalArrayEnabled(boolean enable);
+
     public native void native_SetAudioData(short[] audioData);
 
     public native void native_OnSurfaceCreated();